@@ -17,11 +17,25 @@
 #include "GDCore/Project/Layout.h"
 #include "GDCore/Project/ObjectsContainer.h"
 #include "GDCore/Project/Project.h"
+#include "GDCore/Tools/Symbol.h"
 
 using namespace std;
 
 namespace gd {
 
+namespace {
+// Types of parameters compared when generating the code of instructions.
+const gd::Symbol relationalOperatorType("relationalOperator");
+const gd::Symbol operatorType("operator");
+const gd::Symbol conditionInvertedType("conditionInverted");
+const gd::Symbol keyType("key");
+const gd::Symbol passwordType("password"), musicFileType("musicfile"),
+    soundFileType("soundfile"), policeType("police");
+const gd::Symbol mouseType("mouse");
+const gd::Symbol yesOrNoType("yesorno"), trueOrFalseType("trueorfalse");
+const gd::Symbol inlineCodeType("inlineCode");
+}  // namespace
+
 /**
  * Generate call using a relational operator.
  * Relational operator position is deduced from parameters type.
@@ -43,7 +57,7 @@ gd::String EventsCodeGenerator::GenerateRelationalOperatorCall(
   std::size_t relationalOperatorIndex = instrInfos.parameters.size();
   for (std::size_t i = startFromArgument; i < instrInfos.parameters.size();
        ++i) {
-    if (instrInfos.parameters[i].type == "relationalOperator")
+    if (instrInfos.parameters[i].type == relationalOperatorType)
       relationalOperatorIndex = i;
   }
   // Ensure that there is at least one parameter after the relational operator
@@ -95,7 +109,7 @@ gd::String EventsCodeGenerator::GenerateOperatorCall(
   std::size_t operatorIndex = instrInfos.parameters.size();
   for (std::size_t i = startFromArgument; i < instrInfos.parameters.size();
        ++i) {
-    if (instrInfos.parameters[i].type == "operator") operatorIndex = i;
+    if (instrInfos.parameters[i].type == operatorType) operatorIndex = i;
   }
 
   // Ensure that there is at least one parameter after the operator
@@ -164,7 +178,7 @@ gd::String EventsCodeGenerator::GenerateCompoundOperatorCall(
   std::size_t operatorIndex = instrInfos.parameters.size();
   for (std::size_t i = startFromArgument; i < instrInfos.parameters.size();
        ++i) {
-    if (instrInfos.parameters[i].type == "operator") operatorIndex = i;
+    if (instrInfos.parameters[i].type == operatorType) operatorIndex = i;
   }
 
   // Ensure that there is at least one parameter after the operator
@@ -215,7 +229,7 @@ gd::String EventsCodeGenerator::GenerateMutatorCall(
   std::size_t operatorIndex = instrInfos.parameters.size();
   for (std::size_t i = startFromArgument; i < instrInfos.parameters.size();
        ++i) {
-    if (instrInfos.parameters[i].type == "operator") operatorIndex = i;
+    if (instrInfos.parameters[i].type == operatorType) operatorIndex = i;
   }
 
   // Ensure that there is at least one parameter after the operator
@@ -611,7 +625,7 @@ gd::String EventsCodeGenerator::GenerateParameterCodes(
     // It would be possible to run a gd::ExpressionCodeGenerator if later
     // objects can have nested objects, or function returning objects.
     argOutput = GenerateObject(parameter, metadata.type, context);
-  } else if (metadata.type == "relationalOperator") {
+  } else if (metadata.type == relationalOperatorType) {
     argOutput += parameter == "=" ? "==" : parameter;
     if (argOutput != "==" && argOutput != "<" && argOutput != ">" &&
         argOutput != "<=" && argOutput != ">=" && argOutput != "!=") {
@@ -620,7 +634,7 @@ gd::String EventsCodeGenerator::GenerateParameterCodes(
     }
 
     argOutput = "\"" + argOutput + "\"";
-  } else if (metadata.type == "operator") {
+  } else if (metadata.type == operatorType) {
     argOutput += parameter;
     if (argOutput != "=" && argOutput != "+" && argOutput != "-" &&
         argOutput != "/" && argOutput != "*") {
@@ -631,23 +645,23 @@ gd::String EventsCodeGenerator::GenerateParameterCodes(
     argOutput = "\"" + argOutput + "\"";
   } else if (ParameterMetadata::IsBehavior(metadata.type)) {
     argOutput = GenerateGetBehaviorNameCode(parameter);
-  } else if (metadata.type == "key") {
+  } else if (metadata.type == keyType) {
     argOutput = "\"" + ConvertToString(parameter) + "\"";
-  } else if (metadata.type == "password" || metadata.type == "musicfile" ||
-             metadata.type == "soundfile" || metadata.type == "police") {
+  } else if (metadata.type == passwordType || metadata.type == musicFileType ||
+             metadata.type == soundFileType || metadata.type == policeType) {
     argOutput = "\"" + ConvertToString(parameter) + "\"";
-  } else if (metadata.type == "mouse") {
+  } else if (metadata.type == mouseType) {
     argOutput = "\"" + ConvertToString(parameter) + "\"";
-  } else if (metadata.type == "yesorno") {
+  } else if (metadata.type == yesOrNoType) {
     argOutput += (parameter == "yes" || parameter == "oui") ? GenerateTrue()
                                                             : GenerateFalse();
-  } else if (metadata.type == "trueorfalse") {
+  } else if (metadata.type == trueOrFalseType) {
     // This is duplicated in AdvancedExtension.cpp for GDJS
     argOutput += (parameter == "True" || parameter == "Vrai") ? GenerateTrue()
                                                               : GenerateFalse();
   }
   // Code only parameter type
-  else if (metadata.type == "inlineCode") {
+  else if (metadata.type == inlineCodeType) {
     argOutput += metadata.supplementaryInformation;
   } else {
     // Try supplementary types if provided
@@ -937,7 +951,7 @@ gd::String EventsCodeGenerator::GenerateFreeCondition(
   for (std::size_t i = 0; i < instrInfos.parameters.size();
        ++i)  // Some conditions already have a "conditionInverted" parameter
   {
-    if (instrInfos.parameters[i].type == "conditionInverted")
+    if (instrInfos.parameters[i].type == conditionInvertedType)
       conditionAlreadyTakeCareOfInversion = true;
   }
   if (!conditionAlreadyTakeCareOfInversion && conditionInverted)
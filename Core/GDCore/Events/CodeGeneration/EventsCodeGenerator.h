@@ -12,6 +12,7 @@
 
 #include "GDCore/Events/Event.h"
 #include "GDCore/Events/Instruction.h"
+#include "GDCore/Events/Parsers/ExpressionParser2Cache.h"
 #include "GDCore/String.h"
 namespace gd {
 class EventsList;
@@ -317,6 +318,13 @@ class GD_CORE_API EventsCodeGenerator {
    */
   const gd::Platform& GetPlatform() const { return platform; }
 
+  /**
+   * \brief Get the cache of the expressions parsed during code generation.
+   */
+  gd::ExpressionParser2Cache& GetExpressionParserCache() {
+    return expressionParserCache;
+  }
+
   /**
    * \brief Convert a group name to the full list of objects contained in the
    * group.
@@ -762,6 +770,8 @@ class GD_CORE_API EventsCodeGenerator {
       instructionUniqueIds;  ///< The unique ids generated for instructions.
   size_t eventsListNextUniqueId;  ///< The next identifier to use for an events
                                   ///< list function name.
+  gd::ExpressionParser2Cache
+      expressionParserCache;  ///< The trees of the expressions already parsed.
 };
 
 }  // namespace gd
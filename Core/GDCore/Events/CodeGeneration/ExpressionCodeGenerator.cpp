@@ -32,10 +32,13 @@ gd::String ExpressionCodeGenerator::GenerateExpressionCode(
     const gd::String& type,
     const gd::String& expression,
     const gd::String& objectName) {
-  gd::ExpressionParser2 parser(codeGenerator.GetPlatform(),
-                               codeGenerator.GetGlobalObjectsAndGroups(),
-                               codeGenerator.GetObjectsAndGroups());
-  auto node = parser.ParseExpression(type, expression, objectName);
+  auto node = codeGenerator.GetExpressionParserCache().ParseExpression(
+      codeGenerator.GetPlatform(),
+      codeGenerator.GetGlobalObjectsAndGroups(),
+      codeGenerator.GetObjectsAndGroups(),
+      type,
+      expression,
+      objectName);
   gd::ExpressionValidator validator;
   node->Visit(validator);
 
@@ -297,11 +300,12 @@ gd::String ExpressionCodeGenerator::GenerateParametersCodes(
       } else if (parameterMetadata.IsOptional()) {
         // Optional parameters default value were not parsed at the time of the
         // expression parsing. Parse them now.
-        ExpressionParser2 parser(codeGenerator.GetPlatform(),
-                                 codeGenerator.GetGlobalObjectsAndGroups(),
-                                 codeGenerator.GetObjectsAndGroups());
-        auto node = parser.ParseExpression(parameterMetadata.GetType(),
-                                           parameterMetadata.GetDefaultValue());
+        auto node = codeGenerator.GetExpressionParserCache().ParseExpression(
+            codeGenerator.GetPlatform(),
+            codeGenerator.GetGlobalObjectsAndGroups(),
+            codeGenerator.GetObjectsAndGroups(),
+            parameterMetadata.GetType(),
+            parameterMetadata.GetDefaultValue());
 
         node->Visit(generator);
         parametersCode += generator.GetOutput();
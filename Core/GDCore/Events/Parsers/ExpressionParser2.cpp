@@ -23,13 +23,16 @@ using namespace std;
 namespace gd {
 
 gd::String ExpressionParser2::NAMESPACE_SEPARATOR = "::";
+gd::Symbol ExpressionParser2::NUMBER_TYPE("number");
+gd::Symbol ExpressionParser2::STRING_TYPE("string");
+gd::Symbol ExpressionParser2::UNKNOWN_TYPE("unknown");
 
 ExpressionParser2::ExpressionParser2(
     const gd::Platform& platform_,
     const gd::ObjectsContainer& globalObjectsContainer_,
     const gd::ObjectsContainer& objectsContainer_)
-    : expression(""),
-      currentPosition(0),
+    : currentPosition(0),
+      useArena(true),
       platform(platform_),
       globalObjectsContainer(globalObjectsContainer_),
       objectsContainer(objectsContainer_) {}
@@ -85,8 +88,7 @@ std::unique_ptr<ExpressionParserDiagnostic> ExpressionParser2::ValidateFunction(
   size_t maxParametersCount = GetMaximumParametersNumber(
       function.expressionMetadata.parameters,
       WrittenParametersFirstIndex(function.objectName, function.behaviorName));
-  if (function.parameters.size() < minParametersCount ||
-      function.parameters.size() > maxParametersCount) {
+  if (function.parameters.size() < minParametersCount) {
     gd::String expectedCountMessage =
         minParametersCount == maxParametersCount
             ? _("The number of parameters must be exactly ") +
@@ -95,14 +97,12 @@ std::unique_ptr<ExpressionParserDiagnostic> ExpressionParser2::ValidateFunction(
                   gd::String::From(minParametersCount) + "-" +
                   gd::String::From(maxParametersCount);
 
-    if (function.parameters.size() < minParametersCount) {
-      return gd::make_unique<ExpressionParserError>(
-          "too_few_parameters",
-          "You have not entered enough parameters for the expression. " +
-              expectedCountMessage,
-          functionStartPosition,
-          GetCurrentPosition());
-    }
+    return gd::make_unique<ExpressionParserError>(
+        "too_few_parameters",
+        "You have not entered enough parameters for the expression. " +
+            expectedCountMessage,
+        functionStartPosition,
+        GetCurrentPosition());
   }
 
   return gd::make_unique<ExpressionParserDiagnostic>();
@@ -7,6 +7,7 @@
 #define GDCORE_EXPRESSIONPARSER2_H
 
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 #include "ExpressionParser2Node.h"
@@ -59,18 +60,56 @@ class GD_CORE_API ExpressionParser2 {
       const gd::String &type,
       const gd::String &expression_,
       const gd::String &objectName = "") {
-    expression = expression_;
+    return ParseExpression(gd::Symbol(type), expression_, objectName);
+  }
+
+  /**
+   * Parse the given expression with the specified type.
+   *
+   * \see gd::ExpressionParser2::ParseExpression
+   */
+  std::unique_ptr<ExpressionNode> ParseExpression(
+      const gd::Symbol &type,
+      const gd::String &expression_,
+      const gd::String &objectName = "") {
+    // The expression is decoded once, so that its characters are then read in
+    // constant time (gd::String is UTF-8 encoded, and accessing a character
+    // by its position walks the string from the start).
+    expression.clear();
+    for (gd::String::value_type character : expression_)
+      expression.push_back(character);
 
     currentPosition = 0;
+    if (!useArena) return Start(type, objectName);
+
+    ExpressionParserArena::Scope arenaScope;
     return Start(type, objectName);
   }
 
+  /**
+   * \brief Set if the nodes of the parsed expressions must be allocated from
+   * an arena (one per parsed expression), which is freed when all the nodes of
+   * the tree are destroyed. True by default.
+   *
+   * \see gd::ExpressionParserArena
+   */
+  ExpressionParser2 &SetUseArena(bool enable) {
+    useArena = enable;
+    return *this;
+  }
+
+  /**
+   * \brief Return true if the nodes of the parsed expressions are allocated
+   * from an arena.
+   */
+  bool IsUsingArena() const { return useArena; }
+
  private:
   /** \name Grammar
    * Each method is a part of the grammar.
    */
   ///@{
-  std::unique_ptr<ExpressionNode> Start(const gd::String &type,
+  std::unique_ptr<ExpressionNode> Start(const gd::Symbol &type,
                                         const gd::String &objectName = "") {
     size_t expressionStartPosition = GetCurrentPosition();
     auto expression = Expression(type, objectName);
@@ -79,7 +118,7 @@ class GD_CORE_API ExpressionParser2 {
     if (!IsEndReached()) {
       auto op = gd::make_unique<OperatorNode>(type, ' ');
       op->leftHandSide = std::move(expression);
-      op->rightHandSide = ReadUntilEnd("unknown");
+      op->rightHandSide = ReadUntilEnd(UNKNOWN_TYPE);
 
       op->rightHandSide->diagnostic = RaiseSyntaxError(
           _("The expression has extra character at the end that should be "
@@ -94,7 +133,7 @@ class GD_CORE_API ExpressionParser2 {
   }
 
   std::unique_ptr<ExpressionNode> Expression(
-      const gd::String &type, const gd::String &objectName = "") {
+      const gd::Symbol &type, const gd::String &objectName = "") {
     SkipAllWhitespaces();
 
     size_t expressionStartPosition = GetCurrentPosition();
@@ -116,11 +155,11 @@ class GD_CORE_API ExpressionParser2 {
       return std::move(op);
     }
 
-    if (type == "string") {
+    if (type == STRING_TYPE) {
       leftHandSide->diagnostic = RaiseSyntaxError(
           "You must add the operator + between texts or expressions. For "
           "example: \"Your name: \" + VariableString(PlayerName).");
-    } else if (type == "number") {
+    } else if (type == NUMBER_TYPE) {
       leftHandSide->diagnostic = RaiseSyntaxError(
           "No operator found. Did you forget to enter an operator (like +, -, "
           "* or /) between numbers or expressions?");
@@ -138,7 +177,7 @@ class GD_CORE_API ExpressionParser2 {
     return std::move(op);
   }
 
-  std::unique_ptr<ExpressionNode> Term(const gd::String &type,
+  std::unique_ptr<ExpressionNode> Term(const gd::Symbol &type,
                                        const gd::String &objectName) {
     SkipAllWhitespaces();
 
@@ -166,7 +205,7 @@ class GD_CORE_API ExpressionParser2 {
     return factor;
   };
 
-  std::unique_ptr<ExpressionNode> Factor(const gd::String &type,
+  std::unique_ptr<ExpressionNode> Factor(const gd::Symbol &type,
                                          const gd::String &objectName) {
     SkipAllWhitespaces();
 
@@ -175,11 +214,11 @@ class GD_CORE_API ExpressionParser2 {
 
     if (CheckIfChar(IsQuote)) {
       factor = ReadText();
-      if (type == "number")
+      if (type == NUMBER_TYPE)
         factor->diagnostic =
             RaiseTypeError(_("You entered a text, but a number was expected."),
                            expressionStartPosition);
-      else if (type != "string")
+      else if (type != STRING_TYPE)
         factor->diagnostic = RaiseTypeError(
             _("You entered a text, but this type was expected:") + type,
             expressionStartPosition);
@@ -195,11 +234,11 @@ class GD_CORE_API ExpressionParser2 {
       factor = std::move(unaryOperator);
     } else if (CheckIfChar(IsNumberFirstChar)) {
       factor = ReadNumber();
-      if (type == "string")
+      if (type == STRING_TYPE)
         factor->diagnostic = RaiseTypeError(
             _("You entered a number, but a text was expected (in quotes)."),
             expressionStartPosition);
-      else if (type != "number")
+      else if (type != NUMBER_TYPE)
         factor->diagnostic = RaiseTypeError(
             _("You entered a number, but this type was expected:") + type,
             expressionStartPosition);
@@ -230,7 +269,7 @@ class GD_CORE_API ExpressionParser2 {
   }
 
   std::unique_ptr<SubExpressionNode> SubExpression(
-      const gd::String &type, const gd::String &objectName) {
+      const gd::Symbol &type, const gd::String &objectName) {
     size_t expressionStartPosition = GetCurrentPosition();
     auto subExpression =
         gd::make_unique<SubExpressionNode>(type, Expression(type, objectName));
@@ -241,7 +280,7 @@ class GD_CORE_API ExpressionParser2 {
   };
 
   std::unique_ptr<IdentifierOrFunctionCallOrObjectFunctionNameOrEmptyNode>
-  Identifier(const gd::String &type) {
+  Identifier(const gd::Symbol &type) {
     auto identifierAndLocation = ReadIdentifierName();
     gd::String name = identifierAndLocation.name;
     auto nameLocation = identifierAndLocation.location;
@@ -276,12 +315,12 @@ class GD_CORE_API ExpressionParser2 {
           type, name, nameLocation, dotLocation);
     } else {
       auto identifier = gd::make_unique<IdentifierNode>(name, type);
-      if (type == "string") {
+      if (type == STRING_TYPE) {
         identifier->diagnostic =
             RaiseTypeError(_("You must wrap your text inside double quotes "
                              "(example: \"Hello world\")."),
                            nameLocation.GetStartPosition());
-      } else if (type == "number") {
+      } else if (type == NUMBER_TYPE) {
         identifier->diagnostic = RaiseTypeError(
             _("You must enter a number."), nameLocation.GetStartPosition());
       } else if (!gd::ParameterMetadata::IsObject(type)) {
@@ -296,7 +335,7 @@ class GD_CORE_API ExpressionParser2 {
     }
   }
 
-  std::unique_ptr<VariableNode> Variable(const gd::String &type,
+  std::unique_ptr<VariableNode> Variable(const gd::Symbol &type,
                                          const gd::String &objectName) {
     auto identifierAndLocation = ReadIdentifierName();
     const gd::String &name = identifierAndLocation.name;
@@ -319,7 +358,7 @@ class GD_CORE_API ExpressionParser2 {
     if (CheckIfChar(IsOpeningSquareBracket)) {
       SkipChar();
       auto child =
-          gd::make_unique<VariableBracketAccessorNode>(Expression("string"));
+          gd::make_unique<VariableBracketAccessorNode>(Expression(STRING_TYPE));
 
       if (!CheckIfChar(IsClosingSquareBracket)) {
         child->diagnostic =
@@ -353,7 +392,7 @@ class GD_CORE_API ExpressionParser2 {
   }
 
   std::unique_ptr<FunctionCallNode> FreeFunction(
-      const gd::String &type,
+      const gd::Symbol &type,
       const gd::String &functionFullName,
       const ExpressionParserLocation &identifierLocation,
       const ExpressionParserLocation &openingParenthesisLocation) {
@@ -363,7 +402,7 @@ class GD_CORE_API ExpressionParser2 {
     // This could be improved to have the type passed to a single
     // GetExpressionMetadata function.
     const gd::ExpressionMetadata &metadata =
-        type == "number" ? MetadataProvider::GetExpressionMetadata(
+        type == NUMBER_TYPE ? MetadataProvider::GetExpressionMetadata(
                                platform, functionFullName)
                          : MetadataProvider::GetStrExpressionMetadata(
                                platform, functionFullName);
@@ -387,7 +426,7 @@ class GD_CORE_API ExpressionParser2 {
 
   std::unique_ptr<FunctionCallOrObjectFunctionNameOrEmptyNode>
   ObjectFunctionOrBehaviorFunction(
-      const gd::String &type,
+      const gd::Symbol &type,
       const gd::String &objectName,
       const ExpressionParserLocation &objectNameLocation,
       const ExpressionParserLocation &objectNameDotLocation) {
@@ -418,7 +457,7 @@ class GD_CORE_API ExpressionParser2 {
       // This could be improved to have the type passed to a single
       // GetExpressionMetadata function.
       const gd::ExpressionMetadata &metadata =
-          type == "number"
+          type == NUMBER_TYPE
               ? MetadataProvider::GetObjectExpressionMetadata(
                     platform, objectType, objectFunctionOrBehaviorName)
               : MetadataProvider::GetObjectStrExpressionMetadata(
@@ -463,7 +502,7 @@ class GD_CORE_API ExpressionParser2 {
   }
 
   std::unique_ptr<FunctionCallOrObjectFunctionNameOrEmptyNode> BehaviorFunction(
-      const gd::String &type,
+      const gd::Symbol &type,
       const gd::String &objectName,
       const gd::String &behaviorName,
       const ExpressionParserLocation &objectNameLocation,
@@ -485,7 +524,7 @@ class GD_CORE_API ExpressionParser2 {
       // This could be improved to have the type passed to a single
       // GetExpressionMetadata function.
       const gd::ExpressionMetadata &metadata =
-          type == "number" ? MetadataProvider::GetBehaviorExpressionMetadata(
+          type == NUMBER_TYPE ? MetadataProvider::GetBehaviorExpressionMetadata(
                                  platform, behaviorType, functionName)
                            : MetadataProvider::GetBehaviorStrExpressionMetadata(
                                  platform, behaviorType, functionName);
@@ -542,7 +581,7 @@ class GD_CORE_API ExpressionParser2 {
   };
 
   ParametersNode Parameters(
-      std::vector<gd::ParameterMetadata> parameterMetadata,
+      const std::vector<gd::ParameterMetadata> &parameterMetadata,
       const gd::String &objectName = "",
       const gd::String &behaviorName = "") {
     std::vector<std::unique_ptr<ExpressionNode>> parameters;
@@ -551,6 +590,8 @@ class GD_CORE_API ExpressionParser2 {
     // second one.
     size_t parameterIndex =
         WrittenParametersFirstIndex(objectName, behaviorName);
+    if (parameterIndex < parameterMetadata.size())
+      parameters.reserve(parameterMetadata.size() - parameterIndex);
 
     while (!IsEndReached()) {
       SkipAllWhitespaces();
@@ -561,20 +602,20 @@ class GD_CORE_API ExpressionParser2 {
             std::move(parameters), nullptr, closingParenthesisLocation};
       } else {
         if (parameterIndex < parameterMetadata.size()) {
-          const gd::String &type = parameterMetadata[parameterIndex].GetType();
+          const gd::Symbol &type = parameterMetadata[parameterIndex].GetType();
           if (parameterMetadata[parameterIndex].IsCodeOnly()) {
             // Do nothing, code only parameters are not written in expressions.
-          } else if (gd::ParameterMetadata::IsExpression("number", type)) {
-            parameters.push_back(Expression("number"));
-          } else if (gd::ParameterMetadata::IsExpression("string", type)) {
-            parameters.push_back(Expression("string"));
+          } else if (gd::ParameterMetadata::IsExpression(NUMBER_TYPE, type)) {
+            parameters.push_back(Expression(NUMBER_TYPE));
+          } else if (gd::ParameterMetadata::IsExpression(STRING_TYPE, type)) {
+            parameters.push_back(Expression(STRING_TYPE));
           } else if (gd::ParameterMetadata::IsExpression("variable", type)) {
             parameters.push_back(Expression(type, objectName));
           } else if (gd::ParameterMetadata::IsObject(type)) {
             parameters.push_back(Expression(type));
           } else {
             size_t parameterStartPosition = GetCurrentPosition();
-            parameters.push_back(Expression("unknown"));
+            parameters.push_back(Expression(UNKNOWN_TYPE));
             parameters.back()->diagnostic =
                 gd::make_unique<ExpressionParserError>(
                     "unknown_parameter_type",
@@ -586,7 +627,7 @@ class GD_CORE_API ExpressionParser2 {
           }
         } else {
           size_t parameterStartPosition = GetCurrentPosition();
-          parameters.push_back(Expression("unknown"));
+          parameters.push_back(Expression(UNKNOWN_TYPE));
           parameters.back()
               ->diagnostic = gd::make_unique<ExpressionParserError>(
               "extra_parameter",
@@ -619,8 +660,8 @@ class GD_CORE_API ExpressionParser2 {
       const gd::FunctionCallNode &function, size_t functionStartPosition);
 
   std::unique_ptr<ExpressionParserDiagnostic> ValidateOperator(
-      const gd::String &type, gd::String::value_type operatorChar) {
-    if (type == "number") {
+      const gd::Symbol &type, gd::String::value_type operatorChar) {
+    if (type == NUMBER_TYPE) {
       if (operatorChar == '+' || operatorChar == '-' || operatorChar == '/' ||
           operatorChar == '*') {
         return gd::make_unique<ExpressionParserDiagnostic>();
@@ -631,7 +672,7 @@ class GD_CORE_API ExpressionParser2 {
           _("You've used an operator that is not supported. Operator should be "
             "either +, -, / or *."),
           GetCurrentPosition());
-    } else if (type == "string") {
+    } else if (type == STRING_TYPE) {
       if (operatorChar == '+') {
         return gd::make_unique<ExpressionParserDiagnostic>();
       }
@@ -659,8 +700,8 @@ class GD_CORE_API ExpressionParser2 {
   }
 
   std::unique_ptr<ExpressionParserDiagnostic> ValidateUnaryOperator(
-      const gd::String &type, gd::String::value_type operatorChar) {
-    if (type == "number") {
+      const gd::Symbol &type, gd::String::value_type operatorChar) {
+    if (type == NUMBER_TYPE) {
       if (operatorChar == '+' || operatorChar == '-') {
         return gd::make_unique<ExpressionParserDiagnostic>();
       }
@@ -671,7 +712,7 @@ class GD_CORE_API ExpressionParser2 {
             "should be "
             "either + or -."),
           GetCurrentPosition());
-    } else if (type == "string") {
+    } else if (type == STRING_TYPE) {
       return gd::make_unique<ExpressionParserError>(
           "invalid_operator",
           _("You've used an operator that is not supported. Only + can be used "
@@ -830,9 +871,14 @@ class GD_CORE_API ExpressionParser2 {
   bool IsNamespaceSeparator() {
     // Namespace separator is a special kind of delimiter as it is 2 characters
     // long
-    return (currentPosition + NAMESPACE_SEPARATOR.size() <= expression.size() &&
-            expression.substr(currentPosition, NAMESPACE_SEPARATOR.size()) ==
-                NAMESPACE_SEPARATOR);
+    std::size_t position = currentPosition;
+    for (gd::String::value_type character : NAMESPACE_SEPARATOR) {
+      if (position >= expression.size() || expression[position] != character)
+        return false;
+      position++;
+    }
+
+    return true;
   }
 
   bool IsEndReached() { return currentPosition >= expression.size(); }
@@ -844,36 +890,33 @@ class GD_CORE_API ExpressionParser2 {
   };
 
   IdentifierAndLocation ReadIdentifierName() {
-    gd::String name;
     size_t startPosition = currentPosition;
     while (currentPosition < expression.size() &&
            (IsIdentifierAllowedChar()
             // Allow whitespace in identifier name for compatibility
             ||
             expression[currentPosition] == ' ')) {
-      name += expression[currentPosition];
       currentPosition++;
     }
 
     // Trim whitespace at the end (we allow them for compatibility inside
     // the name, but after the last character that is not whitespace, they
     // should be ignore again).
-    if (!name.empty() && IsWhitespace(name[name.size() - 1])) {
-      size_t lastCharacterPos = name.size() - 1;
-      while (lastCharacterPos < name.size() &&
-             IsWhitespace(name[lastCharacterPos])) {
-        lastCharacterPos--;
-      }
-      if ((lastCharacterPos + 1) < name.size()) {
-        name.erase(lastCharacterPos + 1);
-      }
+    size_t endPosition = currentPosition;
+    while (endPosition > startPosition &&
+           IsWhitespace(expression[endPosition - 1])) {
+      endPosition--;
     }
 
+    gd::String name;
+    for (size_t position = startPosition; position < endPosition; ++position)
+      name += expression[position];
+
     IdentifierAndLocation identifierAndLocation{
         name,
         // The location is ignoring the trailing whitespace (only whitespace
         // inside the identifier are allowed for compatibility).
-        ExpressionParserLocation(startPosition, startPosition + name.size())};
+        ExpressionParserLocation(startPosition, endPosition)};
     return identifierAndLocation;
   }
 
@@ -881,7 +924,7 @@ class GD_CORE_API ExpressionParser2 {
 
   std::unique_ptr<NumberNode> ReadNumber();
 
-  std::unique_ptr<EmptyNode> ReadUntilWhitespace(gd::String type) {
+  std::unique_ptr<EmptyNode> ReadUntilWhitespace(const gd::Symbol &type) {
     size_t startPosition = GetCurrentPosition();
     gd::String text;
     while (currentPosition < expression.size() &&
@@ -896,7 +939,7 @@ class GD_CORE_API ExpressionParser2 {
     return node;
   }
 
-  std::unique_ptr<EmptyNode> ReadUntilEnd(gd::String type) {
+  std::unique_ptr<EmptyNode> ReadUntilEnd(const gd::Symbol &type) {
     size_t startPosition = GetCurrentPosition();
     gd::String text;
     while (currentPosition < expression.size()) {
@@ -939,11 +982,11 @@ class GD_CORE_API ExpressionParser2 {
   }
 
   std::unique_ptr<ExpressionParserError> RaiseEmptyError(
-      const gd::String &type, size_t beginningPosition) {
+      const gd::Symbol &type, size_t beginningPosition) {
     gd::String message;
-    if (type == "number") {
+    if (type == NUMBER_TYPE) {
       message = _("You must enter a number or a valid expression call.");
-    } else if (type == "string") {
+    } else if (type == STRING_TYPE) {
       message = _(
           "You must enter a text (between quotes) or a valid expression call.");
     } else if (gd::ParameterMetadata::IsExpression("variable", type)) {
@@ -965,14 +1008,18 @@ class GD_CORE_API ExpressionParser2 {
     return !behaviorName.empty() ? 2 : (!objectName.empty() ? 1 : 0);
   }
 
-  gd::String expression;
+  std::u32string expression;  ///< The characters of the expression being parsed.
   std::size_t currentPosition;
+  bool useArena;
 
   const gd::Platform &platform;
   const gd::ObjectsContainer &globalObjectsContainer;
   const gd::ObjectsContainer &objectsContainer;
 
   static gd::String NAMESPACE_SEPARATOR;
+  static gd::Symbol NUMBER_TYPE;
+  static gd::Symbol STRING_TYPE;
+  static gd::Symbol UNKNOWN_TYPE;
 };
 
 }  // namespace gd
@@ -0,0 +1,106 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Events/Parsers/ExpressionParser2Arena.h"
+#include <new>
+
+namespace gd {
+
+namespace {
+thread_local ExpressionParserArena *currentArena = nullptr;
+thread_local std::size_t nodesAllocationsCount = 0;
+thread_local std::size_t systemAllocationsCount = 0;
+
+std::size_t AlignSize(std::size_t size) {
+  const std::size_t alignment = alignof(std::max_align_t);
+  return (size + alignment - 1) / alignment * alignment;
+}
+}  // namespace
+
+ExpressionParserArena::Scope::Scope()
+    : arena(new ExpressionParserArena), previousArena(currentArena) {
+  currentArena = arena;
+  systemAllocationsCount++;
+}
+
+ExpressionParserArena::Scope::~Scope() {
+  currentArena = previousArena;
+  arena->Release();
+}
+
+ExpressionParserArena::ExpressionParserArena()
+    : current(initialBlock),
+      end(initialBlock + sizeof(initialBlock)),
+      allocatedBytes(0),
+      liveNodesCount(0),
+      released(false) {}
+
+ExpressionParserArena::~ExpressionParserArena() {
+  for (char *block : blocks) delete[] block;
+}
+
+void *ExpressionParserArena::Allocate(std::size_t size) {
+  size = AlignSize(size);
+  if (static_cast<std::size_t>(end - current) < size) {
+    std::size_t newBlockSize = size > blockSize ? size : blockSize;
+    // Blocks allocated with new[] are suitably aligned for any type.
+    current = new char[newBlockSize];
+    end = current + newBlockSize;
+    blocks.push_back(current);
+    systemAllocationsCount++;
+  }
+
+  char *allocation = current;
+  current += size;
+  allocatedBytes += size;
+  return allocation;
+}
+
+void ExpressionParserArena::Release() {
+  released = true;
+  if (liveNodesCount == 0) delete this;
+}
+
+void *ExpressionParserArena::AllocateNode(std::size_t size) {
+  char *allocation = currentArena
+                         ? static_cast<char *>(
+                               currentArena->Allocate(headerSize + size))
+                         : static_cast<char *>(
+                               ::operator new(headerSize + size));
+
+  *reinterpret_cast<ExpressionParserArena **>(allocation) = currentArena;
+  if (currentArena)
+    currentArena->liveNodesCount++;
+  else
+    systemAllocationsCount++;
+
+  nodesAllocationsCount++;
+  return allocation + headerSize;
+}
+
+void ExpressionParserArena::DeallocateNode(void *pointer) {
+  if (!pointer) return;
+
+  char *allocation = static_cast<char *>(pointer) - headerSize;
+  ExpressionParserArena *arena =
+      *reinterpret_cast<ExpressionParserArena **>(allocation);
+  if (!arena) {
+    ::operator delete(allocation);
+    return;
+  }
+
+  arena->liveNodesCount--;
+  if (arena->released && arena->liveNodesCount == 0) delete arena;
+}
+
+std::size_t ExpressionParserArena::GetNodesAllocationsCount() {
+  return nodesAllocationsCount;
+}
+
+std::size_t ExpressionParserArena::GetSystemAllocationsCount() {
+  return systemAllocationsCount;
+}
+
+}  // namespace gd
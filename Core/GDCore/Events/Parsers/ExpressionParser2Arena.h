@@ -0,0 +1,116 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDCORE_EXPRESSIONPARSER2ARENA_H
+#define GDCORE_EXPRESSIONPARSER2ARENA_H
+#include <cstddef>
+#include <vector>
+
+namespace gd {
+
+/**
+ * \brief A bump allocator used to allocate the nodes (and diagnostics) of the
+ * tree of an expression parsed by gd::ExpressionParser2.
+ *
+ * While a gd::ExpressionParserArena::Scope exists, all the nodes created on
+ * the same thread are allocated from its arena. Nodes are still owned by
+ * std::unique_ptr, but deleting them does not free their memory: the arena is
+ * freed at once when the scope is destroyed and all the nodes allocated from
+ * it are deleted. Nodes created without an active scope are allocated with
+ * the standard allocator.
+ *
+ * \note An arena, and the nodes allocated from it, must be used by a single
+ * thread.
+ *
+ * \see gd::ExpressionParser2::SetUseArena
+ */
+class GD_CORE_API ExpressionParserArena {
+ public:
+  /**
+   * \brief Create an arena used to allocate the nodes created on this thread
+   * until the scope is destroyed.
+   */
+  class GD_CORE_API Scope {
+   public:
+    Scope();
+    ~Scope();
+
+    /**
+     * \brief Return the arena used for the allocations in this scope.
+     */
+    const ExpressionParserArena &GetArena() const { return *arena; }
+
+   private:
+    Scope(const Scope &) = delete;
+    Scope &operator=(const Scope &) = delete;
+
+    ExpressionParserArena *arena;
+    ExpressionParserArena *previousArena;
+  };
+
+  /**
+   * \brief Allocate the memory for a node, from the arena of the current
+   * scope if any.
+   */
+  static void *AllocateNode(std::size_t size);
+
+  /**
+   * \brief Release the memory of a node allocated with
+   * gd::ExpressionParserArena::AllocateNode.
+   */
+  static void DeallocateNode(void *pointer);
+
+  /**
+   * \brief Return the number of bytes allocated from the arena.
+   */
+  std::size_t GetAllocatedBytes() const { return allocatedBytes; }
+
+  /**
+   * \brief Return the number of blocks allocated by the arena, in addition to
+   * the block stored in the arena itself.
+   */
+  std::size_t GetBlocksCount() const { return blocks.size(); }
+
+  /**
+   * \brief Return the number of nodes allocated on this thread, from an arena
+   * or not.
+   */
+  static std::size_t GetNodesAllocationsCount();
+
+  /**
+   * \brief Return the number of allocations done with the standard allocator
+   * on this thread to store nodes: arenas, their blocks, and nodes allocated
+   * without an arena.
+   */
+  static std::size_t GetSystemAllocationsCount();
+
+ private:
+  ExpressionParserArena();
+  ~ExpressionParserArena();
+  ExpressionParserArena(const ExpressionParserArena &) = delete;
+  ExpressionParserArena &operator=(const ExpressionParserArena &) = delete;
+
+  void *Allocate(std::size_t size);
+  void Release();
+
+  /**
+   * \brief Size of the header stored before each node, pointing to the arena
+   * (or null for nodes allocated with the standard allocator).
+   */
+  static const std::size_t headerSize = alignof(std::max_align_t);
+  static const std::size_t blockSize = 16 * 1024;
+
+  std::vector<char *> blocks;
+  char *current;  ///< The first free byte of the current block.
+  char *end;      ///< The end of the current block.
+  std::size_t allocatedBytes;
+  std::size_t liveNodesCount;  ///< Nodes allocated and not yet deleted.
+  bool released;  ///< True when the scope owning the arena is destroyed.
+  alignas(std::max_align_t) char initialBlock[2048];
+};
+
+}  // namespace gd
+
+#endif  // GDCORE_EXPRESSIONPARSER2ARENA_H
@@ -0,0 +1,97 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Events/Parsers/ExpressionParser2Cache.h"
+#include <functional>
+#include "GDCore/Events/Parsers/ExpressionParser2.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Project/ObjectsContainer.h"
+
+namespace gd {
+
+namespace {
+void CombineHash(std::size_t &seed, std::size_t hash) {
+  seed ^= hash + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+}  // namespace
+
+bool ExpressionParser2Cache::Key::operator==(const Key &other) const {
+  return platform == other.platform &&
+         platformVersion == other.platformVersion &&
+         globalObjectsContainer == other.globalObjectsContainer &&
+         globalObjectsContainerVersion ==
+             other.globalObjectsContainerVersion &&
+         objectsContainer == other.objectsContainer &&
+         objectsContainerVersion == other.objectsContainerVersion &&
+         type == other.type && expression == other.expression &&
+         objectName == other.objectName;
+}
+
+std::size_t ExpressionParser2Cache::KeyHash::operator()(
+    const Key &key) const {
+  std::size_t hash = std::hash<gd::String>()(key.expression);
+  CombineHash(hash, std::hash<gd::Symbol>()(key.type));
+  CombineHash(hash, std::hash<gd::String>()(key.objectName));
+  CombineHash(hash, std::hash<const void *>()(key.objectsContainer));
+  CombineHash(hash, key.objectsContainerVersion);
+  CombineHash(hash, key.globalObjectsContainerVersion);
+  CombineHash(hash, key.platformVersion);
+  return hash;
+}
+
+ExpressionParser2Cache::ExpressionParser2Cache(std::size_t maxEntriesCount_)
+    : maxEntriesCount(maxEntriesCount_), hitsCount(0), missesCount(0) {}
+
+ExpressionParser2Cache::~ExpressionParser2Cache() {}
+
+std::shared_ptr<gd::ExpressionNode> ExpressionParser2Cache::ParseExpression(
+    const gd::Platform &platform,
+    const gd::ObjectsContainer &globalObjectsContainer,
+    const gd::ObjectsContainer &objectsContainer,
+    const gd::String &type,
+    const gd::String &expression,
+    const gd::String &objectName) {
+  Key key{&platform,
+          platform.GetExtensionsVersion(),
+          &globalObjectsContainer,
+          globalObjectsContainer.GetVersion(),
+          &objectsContainer,
+          objectsContainer.GetVersion(),
+          gd::Symbol(type),
+          expression,
+          objectName};
+
+  auto it = entries.find(key);
+  if (it != entries.end()) {
+    hitsCount++;
+    recentlyUsed.splice(
+        recentlyUsed.begin(), recentlyUsed, it->second.recentlyUsedIterator);
+    return it->second.node;
+  }
+
+  missesCount++;
+  gd::ExpressionParser2 parser(
+      platform, globalObjectsContainer, objectsContainer);
+  std::shared_ptr<gd::ExpressionNode> node =
+      parser.ParseExpression(key.type, expression, objectName);
+
+  if (maxEntriesCount == 0) return node;
+  if (entries.size() >= maxEntriesCount) {
+    entries.erase(entries.find(*recentlyUsed.back()));
+    recentlyUsed.pop_back();
+  }
+
+  auto inserted = entries.emplace(std::move(key), Entry{node, {}});
+  recentlyUsed.push_front(&inserted.first->first);
+  inserted.first->second.recentlyUsedIterator = recentlyUsed.begin();
+  return node;
+}
+
+void ExpressionParser2Cache::Clear() {
+  entries.clear();
+  recentlyUsed.clear();
+}
+
+}  // namespace gd
@@ -0,0 +1,120 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDCORE_EXPRESSIONPARSER2CACHE_H
+#define GDCORE_EXPRESSIONPARSER2CACHE_H
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include "GDCore/String.h"
+#include "GDCore/Tools/Symbol.h"
+namespace gd {
+class ObjectsContainer;
+class Platform;
+struct ExpressionNode;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief A bounded cache of the trees of expressions parsed by
+ * gd::ExpressionParser2.
+ *
+ * Trees are stored by type, expression, object name and by the platform and
+ * objects containers used to parse them, along with their versions (see
+ * gd::Platform::GetExtensionsVersion and gd::ObjectsContainer::GetVersion): a
+ * tree is parsed again when extensions, objects or groups were added, removed
+ * or renamed using the platform and the containers. Other changes (like
+ * renaming an object directly) are not tracked, so the cache should be
+ * cleared or be short-lived (for example, used during the generation of the
+ * code of a layout).
+ *
+ * When the cache is full, the least recently used tree is removed.
+ *
+ * \see gd::ExpressionParser2
+ */
+class GD_CORE_API ExpressionParser2Cache {
+ public:
+  ExpressionParser2Cache(std::size_t maxEntriesCount_ = 4096);
+  virtual ~ExpressionParser2Cache();
+
+  /**
+   * \brief Return the tree of the given expression, taken from the cache or
+   * parsed with gd::ExpressionParser2.
+   *
+   * \warning The tree is shared by all the callers asking for the same
+   * expression: it must not be modified. To modify an expression tree, parse
+   * it with gd::ExpressionParser2.
+   *
+   * \see gd::ExpressionParser2::ParseExpression
+   */
+  std::shared_ptr<gd::ExpressionNode> ParseExpression(
+      const gd::Platform &platform,
+      const gd::ObjectsContainer &globalObjectsContainer,
+      const gd::ObjectsContainer &objectsContainer,
+      const gd::String &type,
+      const gd::String &expression,
+      const gd::String &objectName = "");
+
+  /**
+   * \brief Remove all the trees from the cache.
+   */
+  void Clear();
+
+  /**
+   * \brief Return the number of trees stored in the cache.
+   */
+  std::size_t GetEntriesCount() const { return entries.size(); }
+
+  /**
+   * \brief Return the number of expressions found in the cache.
+   */
+  std::size_t GetHitsCount() const { return hitsCount; }
+
+  /**
+   * \brief Return the number of expressions that were not in the cache, and
+   * were parsed.
+   */
+  std::size_t GetMissesCount() const { return missesCount; }
+
+ private:
+  ExpressionParser2Cache(const ExpressionParser2Cache &) = delete;
+  ExpressionParser2Cache &operator=(const ExpressionParser2Cache &) = delete;
+
+  struct Key {
+    const gd::Platform *platform;
+    std::size_t platformVersion;
+    const gd::ObjectsContainer *globalObjectsContainer;
+    std::size_t globalObjectsContainerVersion;
+    const gd::ObjectsContainer *objectsContainer;
+    std::size_t objectsContainerVersion;
+    gd::Symbol type;
+    gd::String expression;
+    gd::String objectName;
+
+    bool operator==(const Key &other) const;
+  };
+
+  struct KeyHash {
+    std::size_t operator()(const Key &key) const;
+  };
+
+  struct Entry {
+    std::shared_ptr<gd::ExpressionNode> node;
+    std::list<const Key *>::iterator
+        recentlyUsedIterator;  ///< Position of the entry in recentlyUsed.
+  };
+
+  std::unordered_map<Key, Entry, KeyHash> entries;
+  std::list<const Key *>
+      recentlyUsed;  ///< Keys of the entries, the most recently used first.
+  std::size_t maxEntriesCount;
+  std::size_t hitsCount;
+  std::size_t missesCount;
+};
+
+}  // namespace gd
+
+#endif  // GDCORE_EXPRESSIONPARSER2CACHE_H
@@ -8,8 +8,10 @@
 
 #include <memory>
 #include <vector>
+#include "ExpressionParser2Arena.h"
 #include "ExpressionParser2NodeWorker.h"
 #include "GDCore/String.h"
+#include "GDCore/Tools/Symbol.h"
 namespace gd {
 class Expression;
 class ObjectsContainer;
@@ -42,11 +44,19 @@ struct ExpressionParserLocation {
  * \brief A diagnostic that can be attached to a gd::ExpressionNode.
  */
 struct ExpressionParserDiagnostic {
+  virtual ~ExpressionParserDiagnostic(){};
   virtual bool IsError() { return false; }
   virtual const gd::String &GetMessage() { return noMessage; }
   virtual size_t GetStartPosition() { return 0; }
   virtual size_t GetEndPosition() { return 0; }
 
+  static void *operator new(std::size_t size) {
+    return ExpressionParserArena::AllocateNode(size);
+  }
+  static void operator delete(void *pointer) {
+    ExpressionParserArena::DeallocateNode(pointer);
+  }
+
  private:
   static gd::String noMessage;
 };
@@ -87,6 +97,17 @@ struct ExpressionNode {
   virtual ~ExpressionNode(){};
   virtual void Visit(ExpressionParser2NodeWorker &worker){};
 
+  /**
+   * Nodes are allocated from the arena of the current
+   * gd::ExpressionParserArena::Scope, if any.
+   */
+  static void *operator new(std::size_t size) {
+    return ExpressionParserArena::AllocateNode(size);
+  }
+  static void operator delete(void *pointer) {
+    ExpressionParserArena::DeallocateNode(pointer);
+  }
+
   std::unique_ptr<ExpressionParserDiagnostic> diagnostic;
   ExpressionParserLocation location;  ///< The location of the entire node. Some
                                       ///nodes might have other locations stored
@@ -97,7 +118,7 @@ struct ExpressionNode {
 };
 
 struct SubExpressionNode : public ExpressionNode {
-  SubExpressionNode(const gd::String &type_,
+  SubExpressionNode(const gd::Symbol &type_,
                     std::unique_ptr<ExpressionNode> expression_)
       : type(type_), expression(std::move(expression_)){};
   virtual ~SubExpressionNode(){};
@@ -105,7 +126,7 @@ struct SubExpressionNode : public ExpressionNode {
     worker.OnVisitSubExpressionNode(*this);
   };
 
-  gd::String type;  // "string", "number", type supported by
+  gd::Symbol type;  // "string", "number", type supported by
                     // gd::ParameterMetadata::IsObject, types supported by
                     // gd::ParameterMetadata::IsExpression or "unknown".
   std::unique_ptr<ExpressionNode> expression;
@@ -115,7 +136,7 @@ struct SubExpressionNode : public ExpressionNode {
  * \brief An operator node. For example: "lhs + rhs".
  */
 struct OperatorNode : public ExpressionNode {
-  OperatorNode(const gd::String &type_, gd::String::value_type op_)
+  OperatorNode(const gd::Symbol &type_, gd::String::value_type op_)
       : type(type_), op(op_){};
   virtual ~OperatorNode(){};
   virtual void Visit(ExpressionParser2NodeWorker &worker) {
@@ -124,7 +145,7 @@ struct OperatorNode : public ExpressionNode {
 
   std::unique_ptr<ExpressionNode> leftHandSide;
   std::unique_ptr<ExpressionNode> rightHandSide;
-  gd::String type;  // "string", "number", type supported by
+  gd::Symbol type;  // "string", "number", type supported by
                     // gd::ParameterMetadata::IsObject, types supported by
                     // gd::ParameterMetadata::IsExpression or "unknown".
   gd::String::value_type op;
@@ -134,7 +155,7 @@ struct OperatorNode : public ExpressionNode {
  * \brief A unary operator node. For example: "-2".
  */
 struct UnaryOperatorNode : public ExpressionNode {
-  UnaryOperatorNode(const gd::String &type_, gd::String::value_type op_)
+  UnaryOperatorNode(const gd::Symbol &type_, gd::String::value_type op_)
       : type(type_), op(op_){};
   virtual ~UnaryOperatorNode(){};
   virtual void Visit(ExpressionParser2NodeWorker &worker) {
@@ -142,7 +163,7 @@ struct UnaryOperatorNode : public ExpressionNode {
   };
 
   std::unique_ptr<ExpressionNode> factor;
-  gd::String type;  // "string", "number", type supported by
+  gd::Symbol type;  // "string", "number", type supported by
                     // gd::ParameterMetadata::IsObject, types supported by
                     // gd::ParameterMetadata::IsExpression or "unknown".
   gd::String::value_type op;
@@ -187,7 +208,7 @@ struct VariableAccessorOrVariableBracketAccessorNode : public ExpressionNode {
  * \see gd::VariableBracketAccessorNode
  */
 struct VariableNode : public ExpressionNode {
-  VariableNode(const gd::String &type_,
+  VariableNode(const gd::Symbol &type_,
                const gd::String &name_,
                const gd::String &objectName_)
       : type(type_), name(name_), objectName(objectName_){};
@@ -196,7 +217,7 @@ struct VariableNode : public ExpressionNode {
     worker.OnVisitVariableNode(*this);
   };
 
-  gd::String type;
+  gd::Symbol type;
   gd::String name;
   gd::String objectName;
 
@@ -247,7 +268,7 @@ struct IdentifierOrFunctionCallOrObjectFunctionNameOrEmptyNode
  */
 struct IdentifierNode
     : public IdentifierOrFunctionCallOrObjectFunctionNameOrEmptyNode {
-  IdentifierNode(const gd::String &identifierName_, const gd::String &type_)
+  IdentifierNode(const gd::String &identifierName_, const gd::Symbol &type_)
       : identifierName(identifierName_), type(type_){};
   virtual ~IdentifierNode(){};
   virtual void Visit(ExpressionParser2NodeWorker &worker) {
@@ -255,7 +276,7 @@ struct IdentifierNode
   };
 
   gd::String identifierName;
-  gd::String type;
+  gd::Symbol type;
 };
 
 struct FunctionCallOrObjectFunctionNameOrEmptyNode
@@ -271,13 +292,13 @@ struct FunctionCallOrObjectFunctionNameOrEmptyNode
  */
 struct ObjectFunctionNameNode
     : public FunctionCallOrObjectFunctionNameOrEmptyNode {
-  ObjectFunctionNameNode(const gd::String &type_,
+  ObjectFunctionNameNode(const gd::Symbol &type_,
                          const gd::String &objectName_,
                          const gd::String &objectFunctionOrBehaviorName_)
       : type(type_),
         objectName(objectName_),
         objectFunctionOrBehaviorName(objectFunctionOrBehaviorName_) {}
-  ObjectFunctionNameNode(const gd::String &type_,
+  ObjectFunctionNameNode(const gd::Symbol &type_,
                          const gd::String &objectName_,
                          const gd::String &behaviorName_,
                          const gd::String &behaviorFunctionName_)
@@ -290,7 +311,7 @@ struct ObjectFunctionNameNode
     worker.OnVisitObjectFunctionNameNode(*this);
   };
 
-  gd::String type;  // This could be removed if the type ("string", "number",
+  gd::Symbol type;  // This could be removed if the type ("string", "number",
                     // type supported by gd::ParameterMetadata::IsObject, types
                     // supported by gd::ParameterMetadata::IsExpression or
                     // "unknown") was stored in ExpressionMetadata.
@@ -327,7 +348,7 @@ struct ObjectFunctionNameNode
  * "MyObject.Physics::LinearVelocity()".
  */
 struct FunctionCallNode : public FunctionCallOrObjectFunctionNameOrEmptyNode {
-  FunctionCallNode(const gd::String &type_,
+  FunctionCallNode(const gd::Symbol &type_,
                    std::vector<std::unique_ptr<ExpressionNode>> parameters_,
                    const ExpressionMetadata &expressionMetadata_,
                    const gd::String &functionName_)
@@ -335,7 +356,7 @@ struct FunctionCallNode : public FunctionCallOrObjectFunctionNameOrEmptyNode {
         parameters(std::move(parameters_)),
         expressionMetadata(expressionMetadata_),
         functionName(functionName_){};
-  FunctionCallNode(const gd::String &type_,
+  FunctionCallNode(const gd::Symbol &type_,
                    const gd::String &objectName_,
                    std::vector<std::unique_ptr<ExpressionNode>> parameters_,
                    const ExpressionMetadata &expressionMetadata_,
@@ -345,7 +366,7 @@ struct FunctionCallNode : public FunctionCallOrObjectFunctionNameOrEmptyNode {
         parameters(std::move(parameters_)),
         expressionMetadata(expressionMetadata_),
         functionName(functionName_){};
-  FunctionCallNode(const gd::String &type_,
+  FunctionCallNode(const gd::Symbol &type_,
                    const gd::String &objectName_,
                    const gd::String &behaviorName_,
                    std::vector<std::unique_ptr<ExpressionNode>> parameters_,
@@ -362,7 +383,7 @@ struct FunctionCallNode : public FunctionCallOrObjectFunctionNameOrEmptyNode {
     worker.OnVisitFunctionCallNode(*this);
   };
 
-  gd::String type;  // This could be removed if the type ("string", "number",
+  gd::Symbol type;  // This could be removed if the type ("string", "number",
                     // type supported by gd::ParameterMetadata::IsObject, types
                     // supported by gd::ParameterMetadata::IsExpression or
                     // "unknown") was stored in ExpressionMetadata.
@@ -394,14 +415,14 @@ struct FunctionCallNode : public FunctionCallOrObjectFunctionNameOrEmptyNode {
  * encountered and any other node could not make sense.
  */
 struct EmptyNode : public FunctionCallOrObjectFunctionNameOrEmptyNode {
-  EmptyNode(const gd::String &type_, const gd::String &text_ = "")
+  EmptyNode(const gd::Symbol &type_, const gd::String &text_ = "")
       : type(type_), text(text_){};
   virtual ~EmptyNode(){};
   virtual void Visit(ExpressionParser2NodeWorker &worker) {
     worker.OnVisitEmptyNode(*this);
   };
 
-  gd::String type;  // "string", "number", type supported by
+  gd::Symbol type;  // "string", "number", type supported by
                     // gd::ParameterMetadata::IsObject, types supported by
                     // gd::ParameterMetadata::IsExpression or "unknown".
   gd::String text;
@@ -12,6 +12,9 @@ EventsCodeNameMangler *EventsCodeNameMangler::_singleton = nullptr;
 
 const gd::String& EventsCodeNameMangler::GetMangledObjectsListName(
     const gd::String &originalObjectName) {
+  // References to the elements of an unordered_map stay valid when other
+  // elements are inserted, so the returned name can be used without the lock.
+  std::lock_guard<std::mutex> lock(mutex);
   auto it = mangledObjectNames.find(originalObjectName);
   if (it != mangledObjectNames.end()) {
     return it->second;
@@ -38,6 +41,7 @@ const gd::String& EventsCodeNameMangler::GetMangledObjectsListName(
 
 const gd::String& EventsCodeNameMangler::GetExternalEventsFunctionMangledName(
     const gd::String &externalEventsName) {
+  std::lock_guard<std::mutex> lock(mutex);
   auto it = mangledExternalEventsNames.find(externalEventsName);
   if (it != mangledExternalEventsNames.end()) {
     return it->second;
@@ -6,12 +6,16 @@
 #if defined(GD_IDE_ONLY)
 #ifndef EVENTSCODENAMEMANGLER_H
 #define EVENTSCODENAMEMANGLER_H
+#include <mutex>
 #include <unordered_map>
 #include "GDCore/String.h"
 
 /**
  * \brief Mangle object names, so as to ensure all names used in code are valid.
  *
+ * \note The methods can be called from several threads at the same time, once
+ * the singleton is created.
+ *
  * \see ManObjListName
  */
 class GD_CORE_API EventsCodeNameMangler {
@@ -49,6 +53,7 @@ class GD_CORE_API EventsCodeNameMangler {
   std::unordered_map<gd::String, gd::String>
       mangledExternalEventsNames;  ///< Memoized results of mangling for
                                    /// external events
+  std::mutex mutex;  ///< Protects the memoized names.
 };
 
 /**
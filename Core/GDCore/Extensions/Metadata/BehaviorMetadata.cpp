@@ -7,6 +7,7 @@
 #include <iostream>
 #include "GDCore/Extensions/Metadata/ExpressionMetadata.h"
 #include "GDCore/Extensions/Metadata/InstructionMetadata.h"
+#include "GDCore/Extensions/Metadata/MetadataProvider.h"
 #include "GDCore/Extensions/PlatformExtension.h"
 #include "GDCore/Project/Behavior.h"
 #include "GDCore/Project/BehaviorsSharedData.h"
@@ -48,6 +49,7 @@ gd::InstructionMetadata& BehaviorMetadata::AddCondition(
     const gd::String& group,
     const gd::String& icon,
     const gd::String& smallicon) {
+  gd::MetadataProvider::InvalidateIndexes();
 #if defined(GD_IDE_ONLY)
   gd::String nameWithNamespace =
       extensionNamespace.empty() ? name : extensionNamespace + name;
@@ -73,6 +75,7 @@ gd::InstructionMetadata& BehaviorMetadata::AddAction(
     const gd::String& group,
     const gd::String& icon,
     const gd::String& smallicon) {
+  gd::MetadataProvider::InvalidateIndexes();
 #if defined(GD_IDE_ONLY)
   gd::String nameWithNamespace =
       extensionNamespace.empty() ? name : extensionNamespace + name;
@@ -98,6 +101,7 @@ gd::InstructionMetadata& BehaviorMetadata::AddScopedCondition(
     const gd::String& group,
     const gd::String& icon,
     const gd::String& smallicon) {
+  gd::MetadataProvider::InvalidateIndexes();
 #if defined(GD_IDE_ONLY)
   gd::String nameWithNamespace =
       GetName() + gd::PlatformExtension::GetNamespaceSeparator() + name;
@@ -123,6 +127,7 @@ gd::InstructionMetadata& BehaviorMetadata::AddScopedAction(
     const gd::String& group,
     const gd::String& icon,
     const gd::String& smallicon) {
+  gd::MetadataProvider::InvalidateIndexes();
 #if defined(GD_IDE_ONLY)
   gd::String nameWithNamespace =
       GetName() + gd::PlatformExtension::GetNamespaceSeparator() + name;
@@ -146,6 +151,7 @@ gd::ExpressionMetadata& BehaviorMetadata::AddExpression(
     const gd::String& description,
     const gd::String& group,
     const gd::String& smallicon) {
+  gd::MetadataProvider::InvalidateIndexes();
 #if defined(GD_IDE_ONLY)
   // Be careful, behaviors expression do not have namespace ( not necessary as
   // we refer to the auomatism name in the expression )
@@ -163,6 +169,7 @@ gd::ExpressionMetadata& BehaviorMetadata::AddStrExpression(
     const gd::String& description,
     const gd::String& group,
     const gd::String& smallicon) {
+  gd::MetadataProvider::InvalidateIndexes();
 #if defined(GD_IDE_ONLY)
   // Be careful, behaviors expression do not have namespace ( not necessary as
   // we refer to the auomatism name in the expression )
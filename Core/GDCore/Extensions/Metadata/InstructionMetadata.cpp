@@ -47,6 +47,34 @@ InstructionMetadata::InstructionMetadata(const gd::String& extensionNamespace_,
 
 ParameterMetadata::ParameterMetadata() : optional(false), codeOnly(false) {}
 
+const std::vector<gd::Symbol>& ParameterMetadata::GetExpressionParameterTypes(
+    const gd::String& type) {
+  static const std::vector<gd::Symbol> numberTypes = {
+      gd::Symbol("expression"),
+      gd::Symbol("camera"),
+      gd::Symbol("forceMultiplier")};
+  static const std::vector<gd::Symbol> stringTypes = {
+      gd::Symbol("string"),
+      gd::Symbol("layer"),
+      gd::Symbol("color"),
+      gd::Symbol("file"),
+      gd::Symbol("joyaxis"),
+      gd::Symbol("stringWithSelector"),
+      gd::Symbol("sceneName")};
+  static const std::vector<gd::Symbol> variableTypes = {
+      gd::Symbol("objectvar"), gd::Symbol("globalvar"), gd::Symbol("scenevar")};
+  static const std::vector<gd::Symbol> noTypes;
+
+  if (type == "number")
+    return numberTypes;
+  else if (type == "string")
+    return stringTypes;
+  else if (type == "variable")
+    return variableTypes;
+
+  return noTypes;
+}
+
 InstructionMetadata& InstructionMetadata::AddParameter(
     const gd::String& type,
     const gd::String& description,
@@ -10,8 +10,10 @@
 #include <functional>
 #include <map>
 #include <memory>
+#include <vector>
 #include "GDCore/Events/Instruction.h"
 #include "GDCore/String.h"
+#include "GDCore/Tools/Symbol.h"
 namespace gd {
 class Project;
 class Layout;
@@ -37,7 +39,7 @@ class GD_CORE_API ParameterMetadata {
    * \brief Return the type of the parameter.
    * \see gd::ParameterMetadata::IsObject
    */
-  const gd::String &GetType() const { return type; }
+  const gd::Symbol &GetType() const { return type; }
 
   /**
    * \brief Set the type of the parameter.
@@ -164,6 +166,18 @@ class GD_CORE_API ParameterMetadata {
            parameterType == "objectListWithoutPicking";
   }
 
+  /**
+   * \brief Same as gd::ParameterMetadata::IsObject, comparing symbols.
+   */
+  static bool IsObject(const gd::Symbol &parameterType) {
+    static const gd::Symbol object("object"), objectPtr("objectPtr"),
+        objectList("objectList"),
+        objectListWithoutPicking("objectListWithoutPicking");
+    return parameterType == object || parameterType == objectPtr ||
+           parameterType == objectList ||
+           parameterType == objectListWithoutPicking;
+  }
+
   /**
    * \brief Return true if the type of the parameter is "behavior".
    *
@@ -173,6 +187,14 @@ class GD_CORE_API ParameterMetadata {
     return parameterType == "behavior";
   }
 
+  /**
+   * \brief Same as gd::ParameterMetadata::IsBehavior, comparing symbols.
+   */
+  static bool IsBehavior(const gd::Symbol &parameterType) {
+    static const gd::Symbol behavior("behavior");
+    return parameterType == behavior;
+  }
+
   /**
    * \brief Return true if the type of the parameter is an expression of the
    * given type.
@@ -181,19 +203,20 @@ class GD_CORE_API ParameterMetadata {
    */
   static bool IsExpression(const gd::String &type,
                            const gd::String &parameterType) {
-    if (type == "number") {
-      return parameterType == "expression" || parameterType == "camera" ||
-             parameterType == "forceMultiplier";
-    } else if (type == "string") {
-      return parameterType == "string" || parameterType == "layer" ||
-             parameterType == "color" || parameterType == "file" ||
-             parameterType == "joyaxis" ||
-             parameterType == "stringWithSelector" ||
-             parameterType == "sceneName";
-    } else if (type == "variable") {
-      return parameterType == "objectvar" || parameterType == "globalvar" ||
-             parameterType == "scenevar";
-    }
+    for (const gd::Symbol &expressionType : GetExpressionParameterTypes(type))
+      if (expressionType == parameterType) return true;
+
+    return false;
+  }
+
+  /**
+   * \brief Same as gd::ParameterMetadata::IsExpression, comparing symbols.
+   */
+  static bool IsExpression(const gd::String &type,
+                           const gd::Symbol &parameterType) {
+    for (const gd::Symbol &expressionType : GetExpressionParameterTypes(type))
+      if (expressionType == parameterType) return true;
+
     return false;
   }
 
@@ -213,7 +236,7 @@ class GD_CORE_API ParameterMetadata {
 
   // TODO: Deprecated public fields. Any direct using should be moved to
   // getter/setter.
-  gd::String type;                      ///< Parameter type
+  gd::Symbol type;                      ///< Parameter type
   gd::String supplementaryInformation;  ///< Used if needed
   bool optional;                        ///< True if the parameter is optional
 
@@ -221,6 +244,13 @@ class GD_CORE_API ParameterMetadata {
   bool codeOnly;  ///< True if parameter is relative to code generation only,
                   ///< i.e. must not be shown in editor
  private:
+  /**
+   * \brief Return the types of the parameters that are expressions of the
+   * given type ("number", "string" or "variable").
+   */
+  static const std::vector<gd::Symbol> &GetExpressionParameterTypes(
+      const gd::String &type);
+
   gd::String longDescription;  ///< Long description shown in the editor.
   gd::String defaultValue;     ///< Used as a default value in editor or if an
                                ///< optional parameter is empty.
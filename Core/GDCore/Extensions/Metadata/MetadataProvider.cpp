@@ -5,6 +5,7 @@
  */
 #include "GDCore/Extensions/Metadata/MetadataProvider.h"
 #include <algorithm>
+#include <unordered_map>
 #include "GDCore/Extensions/Metadata/BehaviorMetadata.h"
 #include "GDCore/Extensions/Metadata/InstructionMetadata.h"
 #include "GDCore/Extensions/Metadata/ObjectMetadata.h"
@@ -24,18 +25,164 @@ gd::InstructionMetadata MetadataProvider::badInstructionMetadata;
 gd::ExpressionMetadata MetadataProvider::badExpressionMetadata;
 gd::ExpressionMetadata MetadataProvider::badStrExpressionMetadata;
 gd::PlatformExtension MetadataProvider::badExtension;
+std::atomic<std::size_t> MetadataProvider::metadataChangesCount(0);
+
+template <class T>
+using MetadataIndex = std::unordered_map<gd::String, ExtensionAndMetadata<T>>;
+
+template <class T>
+using MetadataIndexByType =
+    std::unordered_map<gd::String, MetadataIndex<T>>;
+
+/**
+ * \brief Index of the metadata declared by all the extensions of a platform.
+ *
+ * When a name is declared by several extensions, the index contains the
+ * metadata of the first extension declaring it, like a search done by
+ * iterating on the extensions in order.
+ */
+class MetadataProviderIndex {
+ public:
+  MetadataProviderIndex(const gd::Platform& platform,
+                        std::size_t metadataChangesCount_)
+      : metadataChangesCount(metadataChangesCount_) {
+    for (auto& extension : platform.GetAllPlatformExtensions()) {
+      Add(staticActions, *extension, extension->GetAllActions());
+      Add(staticConditions, *extension, extension->GetAllConditions());
+      Add(actions, *extension, extension->GetAllActions());
+      Add(conditions, *extension, extension->GetAllConditions());
+      Add(expressions, *extension, extension->GetAllExpressions());
+      Add(strExpressions, *extension, extension->GetAllStrExpressions());
+
+      for (const gd::String& type : extension->GetExtensionObjectsTypes()) {
+        objects.emplace(type,
+                        ExtensionAndMetadata<ObjectMetadata>(
+                            *extension, extension->GetObjectMetadata(type)));
+
+        auto& typeActions = extension->GetAllActionsForObject(type);
+        auto& typeConditions = extension->GetAllConditionsForObject(type);
+        Add(objectsActions[type], *extension, typeActions);
+        Add(objectsConditions[type], *extension, typeConditions);
+        Add(actions, *extension, typeActions);
+        Add(conditions, *extension, typeConditions);
+        Add(objectsExpressions[type],
+            *extension,
+            extension->GetAllExpressionsForObject(type));
+        Add(objectsStrExpressions[type],
+            *extension,
+            extension->GetAllStrExpressionsForObject(type));
+      }
+
+      for (const gd::String& type : extension->GetBehaviorsTypes()) {
+        behaviors.emplace(type,
+                          ExtensionAndMetadata<BehaviorMetadata>(
+                              *extension, extension->GetBehaviorMetadata(type)));
+
+        auto& typeActions = extension->GetAllActionsForBehavior(type);
+        auto& typeConditions = extension->GetAllConditionsForBehavior(type);
+        Add(behaviorsActions[type], *extension, typeActions);
+        Add(behaviorsConditions[type], *extension, typeConditions);
+        Add(actions, *extension, typeActions);
+        Add(conditions, *extension, typeConditions);
+        Add(behaviorsExpressions[type],
+            *extension,
+            extension->GetAllExpressionsForBehavior(type));
+        Add(behaviorsStrExpressions[type],
+            *extension,
+            extension->GetAllStrExpressionsForBehavior(type));
+      }
+
+      for (const gd::String& type : extension->GetExtensionEffectTypes()) {
+        effects.emplace(type,
+                        ExtensionAndMetadata<EffectMetadata>(
+                            *extension, extension->GetEffectMetadata(type)));
+      }
+    }
+  }
+
+  /**
+   * \brief Return the metadata with the given name, or nullptr if not found.
+   */
+  template <class T>
+  static const ExtensionAndMetadata<T>* Find(const MetadataIndex<T>& index,
+                                             const gd::String& name) {
+    auto it = index.find(name);
+    return it != index.end() ? &it->second : nullptr;
+  }
+
+  /**
+   * \brief Return the metadata with the given name for the given object (or
+   * behavior) type, then for the base object (or behavior), or nullptr if not
+   * found.
+   */
+  template <class T>
+  static const ExtensionAndMetadata<T>* Find(
+      const MetadataIndexByType<T>& indexByType,
+      const gd::String& type,
+      const gd::String& name) {
+    auto it = indexByType.find(type);
+    if (it != indexByType.end()) {
+      auto metadata = Find(it->second, name);
+      if (metadata) return metadata;
+    }
+
+    it = indexByType.find("");
+    return it != indexByType.end() ? Find(it->second, name) : nullptr;
+  }
+
+  std::size_t metadataChangesCount;  ///< The value of
+                                    ///< MetadataProvider::metadataChangesCount
+                                    ///< when the index was built.
+
+  MetadataIndex<BehaviorMetadata> behaviors;
+  MetadataIndex<ObjectMetadata> objects;
+  MetadataIndex<EffectMetadata> effects;
+
+  MetadataIndex<InstructionMetadata> actions;  ///< Static, objects and
+                                               ///< behaviors actions.
+  MetadataIndex<InstructionMetadata> conditions;  ///< Static, objects and
+                                                  ///< behaviors conditions.
+  MetadataIndex<InstructionMetadata> staticActions;
+  MetadataIndex<InstructionMetadata> staticConditions;
+  MetadataIndexByType<InstructionMetadata> objectsActions;
+  MetadataIndexByType<InstructionMetadata> objectsConditions;
+  MetadataIndexByType<InstructionMetadata> behaviorsActions;
+  MetadataIndexByType<InstructionMetadata> behaviorsConditions;
+
+  MetadataIndex<ExpressionMetadata> expressions;
+  MetadataIndex<ExpressionMetadata> strExpressions;
+  MetadataIndexByType<ExpressionMetadata> objectsExpressions;
+  MetadataIndexByType<ExpressionMetadata> objectsStrExpressions;
+  MetadataIndexByType<ExpressionMetadata> behaviorsExpressions;
+  MetadataIndexByType<ExpressionMetadata> behaviorsStrExpressions;
+
+ private:
+  template <class T>
+  static void Add(MetadataIndex<T>& index,
+                  const gd::PlatformExtension& extension,
+                  const std::map<gd::String, T>& allMetadata) {
+    for (const auto& it : allMetadata)
+      index.emplace(it.first, ExtensionAndMetadata<T>(extension, it.second));
+  }
+};
+
+const MetadataProviderIndex& MetadataProvider::GetIndex(
+    const gd::Platform& platform) {
+  std::size_t changesCount = metadataChangesCount;
+  if (!platform.metadataProviderIndex ||
+      platform.metadataProviderIndex->metadataChangesCount != changesCount)
+    platform.metadataProviderIndex =
+        std::make_shared<MetadataProviderIndex>(platform, changesCount);
+
+  return *platform.metadataProviderIndex;
+}
 
 ExtensionAndMetadata<BehaviorMetadata>
 MetadataProvider::GetExtensionAndBehaviorMetadata(const gd::Platform& platform,
                                                   gd::String behaviorType) {
-  for (auto& extension : platform.GetAllPlatformExtensions()) {
-    auto behaviorTypes = extension->GetBehaviorsTypes();
-    for (std::size_t j = 0; j < behaviorTypes.size(); ++j) {
-      if (behaviorTypes[j] == behaviorType)
-        return ExtensionAndMetadata<BehaviorMetadata>(
-            *extension, extension->GetBehaviorMetadata(behaviorType));
-    }
-  }
+  auto metadata = MetadataProviderIndex::Find(GetIndex(platform).behaviors,
+                                              behaviorType);
+  if (metadata) return *metadata;
 
   return ExtensionAndMetadata<BehaviorMetadata>(badExtension, badBehaviorInfo);
 }
@@ -48,14 +195,9 @@ const BehaviorMetadata& MetadataProvider::GetBehaviorMetadata(
 ExtensionAndMetadata<ObjectMetadata>
 MetadataProvider::GetExtensionAndObjectMetadata(const gd::Platform& platform,
                                                 gd::String objectType) {
-  for (auto& extension : platform.GetAllPlatformExtensions()) {
-    auto objectsTypes = extension->GetExtensionObjectsTypes();
-    for (std::size_t j = 0; j < objectsTypes.size(); ++j) {
-      if (objectsTypes[j] == objectType)
-        return ExtensionAndMetadata<ObjectMetadata>(
-            *extension, extension->GetObjectMetadata(objectType));
-    }
-  }
+  auto metadata =
+      MetadataProviderIndex::Find(GetIndex(platform).objects, objectType);
+  if (metadata) return *metadata;
 
   return ExtensionAndMetadata<ObjectMetadata>(badExtension, badObjectInfo);
 }
@@ -68,14 +210,8 @@ const ObjectMetadata& MetadataProvider::GetObjectMetadata(
 ExtensionAndMetadata<EffectMetadata>
 MetadataProvider::GetExtensionAndEffectMetadata(const gd::Platform& platform,
                                                 gd::String type) {
-  for (auto& extension : platform.GetAllPlatformExtensions()) {
-    auto objectsTypes = extension->GetExtensionEffectTypes();
-    for (std::size_t j = 0; j < objectsTypes.size(); ++j) {
-      if (objectsTypes[j] == type)
-        return ExtensionAndMetadata<EffectMetadata>(
-            *extension, extension->GetEffectMetadata(type));
-    }
-  }
+  auto metadata = MetadataProviderIndex::Find(GetIndex(platform).effects, type);
+  if (metadata) return *metadata;
 
   return ExtensionAndMetadata<EffectMetadata>(badExtension, badEffectMetadata);
 }
@@ -88,31 +224,9 @@ const EffectMetadata& MetadataProvider::GetEffectMetadata(
 ExtensionAndMetadata<InstructionMetadata>
 MetadataProvider::GetExtensionAndActionMetadata(const gd::Platform& platform,
                                                 gd::String actionType) {
-  auto& extensions = platform.GetAllPlatformExtensions();
-  for (auto& extension : extensions) {
-    const auto& allActions = extension->GetAllActions();
-    if (allActions.find(actionType) != allActions.end())
-      return ExtensionAndMetadata<InstructionMetadata>(
-          *extension, allActions.find(actionType)->second);
-
-    const auto& objects = extension->GetExtensionObjectsTypes();
-    for (const gd::String& extObjectType : objects) {
-      const auto& allObjectsActions =
-          extension->GetAllActionsForObject(extObjectType);
-      if (allObjectsActions.find(actionType) != allObjectsActions.end())
-        return ExtensionAndMetadata<InstructionMetadata>(
-            *extension, allObjectsActions.find(actionType)->second);
-    }
-
-    const auto& autos = extension->GetBehaviorsTypes();
-    for (std::size_t j = 0; j < autos.size(); ++j) {
-      const auto& allAutosActions =
-          extension->GetAllActionsForBehavior(autos[j]);
-      if (allAutosActions.find(actionType) != allAutosActions.end())
-        return ExtensionAndMetadata<InstructionMetadata>(
-            *extension, allAutosActions.find(actionType)->second);
-    }
-  }
+  auto metadata =
+      MetadataProviderIndex::Find(GetIndex(platform).actions, actionType);
+  if (metadata) return *metadata;
 
   return ExtensionAndMetadata<InstructionMetadata>(badExtension,
                                                    badInstructionMetadata);
@@ -126,31 +240,9 @@ const gd::InstructionMetadata& MetadataProvider::GetActionMetadata(
 ExtensionAndMetadata<InstructionMetadata>
 MetadataProvider::GetExtensionAndConditionMetadata(const gd::Platform& platform,
                                                    gd::String conditionType) {
-  auto& extensions = platform.GetAllPlatformExtensions();
-  for (auto& extension : extensions) {
-    const auto& allConditions = extension->GetAllConditions();
-    if (allConditions.find(conditionType) != allConditions.end())
-      return ExtensionAndMetadata<InstructionMetadata>(
-          *extension, allConditions.find(conditionType)->second);
-
-    const auto& objects = extension->GetExtensionObjectsTypes();
-    for (const gd::String& extObjectType : objects) {
-      const auto& allObjetsConditions =
-          extension->GetAllConditionsForObject(extObjectType);
-      if (allObjetsConditions.find(conditionType) != allObjetsConditions.end())
-        return ExtensionAndMetadata<InstructionMetadata>(
-            *extension, allObjetsConditions.find(conditionType)->second);
-    }
-
-    const auto& autos = extension->GetBehaviorsTypes();
-    for (std::size_t j = 0; j < autos.size(); ++j) {
-      const auto& allAutosConditions =
-          extension->GetAllConditionsForBehavior(autos[j]);
-      if (allAutosConditions.find(conditionType) != allAutosConditions.end())
-        return ExtensionAndMetadata<InstructionMetadata>(
-            *extension, allAutosConditions.find(conditionType)->second);
-    }
-  }
+  auto metadata =
+      MetadataProviderIndex::Find(GetIndex(platform).conditions, conditionType);
+  if (metadata) return *metadata;
 
   return ExtensionAndMetadata<InstructionMetadata>(badExtension,
                                                    badInstructionMetadata);
@@ -165,26 +257,9 @@ const gd::InstructionMetadata& MetadataProvider::GetConditionMetadata(
 ExtensionAndMetadata<ExpressionMetadata>
 MetadataProvider::GetExtensionAndObjectExpressionMetadata(
     const gd::Platform& platform, gd::String objectType, gd::String exprType) {
-  auto& extensions = platform.GetAllPlatformExtensions();
-  for (auto& extension : extensions) {
-    const auto& objects = extension->GetExtensionObjectsTypes();
-    if (find(objects.begin(), objects.end(), objectType) != objects.end()) {
-      const auto& allObjectExpressions =
-          extension->GetAllExpressionsForObject(objectType);
-      if (allObjectExpressions.find(exprType) != allObjectExpressions.end())
-        return ExtensionAndMetadata<ExpressionMetadata>(
-            *extension, allObjectExpressions.find(exprType)->second);
-    }
-  }
-
-  // Then check base
-  for (auto& extension : extensions) {
-    const auto& allObjectExpressions =
-        extension->GetAllExpressionsForObject("");
-    if (allObjectExpressions.find(exprType) != allObjectExpressions.end())
-      return ExtensionAndMetadata<ExpressionMetadata>(
-          *extension, allObjectExpressions.find(exprType)->second);
-  }
+  auto metadata = MetadataProviderIndex::Find(
+      GetIndex(platform).objectsExpressions, objectType, exprType);
+  if (metadata) return *metadata;
 
   return ExtensionAndMetadata<ExpressionMetadata>(badExtension,
                                                   badExpressionMetadata);
@@ -199,26 +274,9 @@ const gd::ExpressionMetadata& MetadataProvider::GetObjectExpressionMetadata(
 ExtensionAndMetadata<ExpressionMetadata>
 MetadataProvider::GetExtensionAndBehaviorExpressionMetadata(
     const gd::Platform& platform, gd::String autoType, gd::String exprType) {
-  auto& extensions = platform.GetAllPlatformExtensions();
-  for (auto& extension : extensions) {
-    const auto& autos = extension->GetBehaviorsTypes();
-    if (find(autos.begin(), autos.end(), autoType) != autos.end()) {
-      const auto& allAutoExpressions =
-          extension->GetAllExpressionsForBehavior(autoType);
-      if (allAutoExpressions.find(exprType) != allAutoExpressions.end())
-        return ExtensionAndMetadata<ExpressionMetadata>(
-            *extension, allAutoExpressions.find(exprType)->second);
-    }
-  }
-
-  // Then check base
-  for (auto& extension : extensions) {
-    const auto& allAutoExpressions =
-        extension->GetAllExpressionsForBehavior("");
-    if (allAutoExpressions.find(exprType) != allAutoExpressions.end())
-      return ExtensionAndMetadata<ExpressionMetadata>(
-          *extension, allAutoExpressions.find(exprType)->second);
-  }
+  auto metadata = MetadataProviderIndex::Find(
+      GetIndex(platform).behaviorsExpressions, autoType, exprType);
+  if (metadata) return *metadata;
 
   return ExtensionAndMetadata<ExpressionMetadata>(badExtension,
                                                   badExpressionMetadata);
@@ -233,13 +291,9 @@ const gd::ExpressionMetadata& MetadataProvider::GetBehaviorExpressionMetadata(
 ExtensionAndMetadata<ExpressionMetadata>
 MetadataProvider::GetExtensionAndExpressionMetadata(
     const gd::Platform& platform, gd::String exprType) {
-  auto& extensions = platform.GetAllPlatformExtensions();
-  for (auto& extension : extensions) {
-    const auto& allExpr = extension->GetAllExpressions();
-    if (allExpr.find(exprType) != allExpr.end())
-      return ExtensionAndMetadata<ExpressionMetadata>(
-          *extension, allExpr.find(exprType)->second);
-  }
+  auto metadata =
+      MetadataProviderIndex::Find(GetIndex(platform).expressions, exprType);
+  if (metadata) return *metadata;
 
   return ExtensionAndMetadata<ExpressionMetadata>(badExtension,
                                                   badExpressionMetadata);
@@ -253,27 +307,9 @@ const gd::ExpressionMetadata& MetadataProvider::GetExpressionMetadata(
 ExtensionAndMetadata<ExpressionMetadata>
 MetadataProvider::GetExtensionAndObjectStrExpressionMetadata(
     const gd::Platform& platform, gd::String objectType, gd::String exprType) {
-  auto& extensions = platform.GetAllPlatformExtensions();
-  for (auto& extension : extensions) {
-    const auto& objects = extension->GetExtensionObjectsTypes();
-    if (find(objects.begin(), objects.end(), objectType) != objects.end()) {
-      const auto& allObjectStrExpressions =
-          extension->GetAllStrExpressionsForObject(objectType);
-      if (allObjectStrExpressions.find(exprType) !=
-          allObjectStrExpressions.end())
-        return ExtensionAndMetadata<ExpressionMetadata>(
-            *extension, allObjectStrExpressions.find(exprType)->second);
-    }
-  }
-
-  // Then check in functions of "Base object".
-  for (auto& extension : extensions) {
-    const auto& allObjectStrExpressions =
-        extension->GetAllStrExpressionsForObject("");
-    if (allObjectStrExpressions.find(exprType) != allObjectStrExpressions.end())
-      return ExtensionAndMetadata<ExpressionMetadata>(
-          *extension, allObjectStrExpressions.find(exprType)->second);
-  }
+  auto metadata = MetadataProviderIndex::Find(
+      GetIndex(platform).objectsStrExpressions, objectType, exprType);
+  if (metadata) return *metadata;
 
   return ExtensionAndMetadata<ExpressionMetadata>(badExtension,
                                                   badStrExpressionMetadata);
@@ -289,28 +325,9 @@ const gd::ExpressionMetadata& MetadataProvider::GetObjectStrExpressionMetadata(
 ExtensionAndMetadata<ExpressionMetadata>
 MetadataProvider::GetExtensionAndBehaviorStrExpressionMetadata(
     const gd::Platform& platform, gd::String autoType, gd::String exprType) {
-  auto& extensions = platform.GetAllPlatformExtensions();
-  for (auto& extension : extensions) {
-    const auto& autos = extension->GetBehaviorsTypes();
-    if (find(autos.begin(), autos.end(), autoType) != autos.end()) {
-      const auto& allBehaviorStrExpressions =
-          extension->GetAllStrExpressionsForBehavior(autoType);
-      if (allBehaviorStrExpressions.find(exprType) !=
-          allBehaviorStrExpressions.end())
-        return ExtensionAndMetadata<ExpressionMetadata>(
-            *extension, allBehaviorStrExpressions.find(exprType)->second);
-    }
-  }
-
-  // Then check in functions of "Base object".
-  for (auto& extension : extensions) {
-    const auto& allBehaviorStrExpressions =
-        extension->GetAllStrExpressionsForBehavior("");
-    if (allBehaviorStrExpressions.find(exprType) !=
-        allBehaviorStrExpressions.end())
-      return ExtensionAndMetadata<ExpressionMetadata>(
-          *extension, allBehaviorStrExpressions.find(exprType)->second);
-  }
+  auto metadata = MetadataProviderIndex::Find(
+      GetIndex(platform).behaviorsStrExpressions, autoType, exprType);
+  if (metadata) return *metadata;
 
   return ExtensionAndMetadata<ExpressionMetadata>(badExtension,
                                                   badStrExpressionMetadata);
@@ -328,13 +345,9 @@ MetadataProvider::GetBehaviorStrExpressionMetadata(const gd::Platform& platform,
 ExtensionAndMetadata<ExpressionMetadata>
 MetadataProvider::GetExtensionAndStrExpressionMetadata(
     const gd::Platform& platform, gd::String exprType) {
-  auto& extensions = platform.GetAllPlatformExtensions();
-  for (auto& extension : extensions) {
-    const auto& allExpr = extension->GetAllStrExpressions();
-    if (allExpr.find(exprType) != allExpr.end())
-      return ExtensionAndMetadata<ExpressionMetadata>(
-          *extension, allExpr.find(exprType)->second);
-  }
+  auto metadata =
+      MetadataProviderIndex::Find(GetIndex(platform).strExpressions, exprType);
+  if (metadata) return *metadata;
 
   return ExtensionAndMetadata<ExpressionMetadata>(badExtension,
                                                   badStrExpressionMetadata);
@@ -347,195 +360,89 @@ const gd::ExpressionMetadata& MetadataProvider::GetStrExpressionMetadata(
 
 bool MetadataProvider::HasAction(const gd::Platform& platform,
                                  gd::String name) {
-  auto& extensions = platform.GetAllPlatformExtensions();
-
-  for (auto& extension : extensions) {
-    const auto& actions = extension->GetAllActions();
-    if (actions.find(name) != actions.end()) return true;
-  }
-
-  return false;
+  return MetadataProviderIndex::Find(GetIndex(platform).staticActions, name) !=
+         nullptr;
 }
 
 bool MetadataProvider::HasObjectAction(const gd::Platform& platform,
                                        gd::String objectType,
                                        gd::String name) {
-  auto& extensions = platform.GetAllPlatformExtensions();
-  for (auto& extension : extensions) {
-    const auto& actions = extension->GetAllActionsForObject(objectType);
-    if (actions.find(name) != actions.end()) return true;
-  }
-
-  // Then check in functions of "Base object".
-  for (auto& extension : extensions) {
-    const auto& actions = extension->GetAllActionsForObject("");
-    if (actions.find(name) != actions.end()) return true;
-  }
-
-  return false;
+  return MetadataProviderIndex::Find(
+             GetIndex(platform).objectsActions, objectType, name) != nullptr;
 }
 
 bool MetadataProvider::HasBehaviorAction(const gd::Platform& platform,
                                          gd::String behaviorType,
                                          gd::String name) {
-  auto& extensions = platform.GetAllPlatformExtensions();
-  for (auto& extension : extensions) {
-    const auto& actions = extension->GetAllActionsForBehavior(behaviorType);
-    if (actions.find(name) != actions.end()) return true;
-  }
-
-  // Then check in functions of "Base object".
-  for (auto& extension : extensions) {
-    const auto& actions = extension->GetAllActionsForBehavior("");
-    if (actions.find(name) != actions.end()) return true;
-  }
-
-  return false;
+  return MetadataProviderIndex::Find(
+             GetIndex(platform).behaviorsActions, behaviorType, name) !=
+         nullptr;
 }
 
 bool MetadataProvider::HasCondition(const gd::Platform& platform,
                                     gd::String name) {
-  auto& extensions = platform.GetAllPlatformExtensions();
-  for (auto& extension : extensions) {
-    const auto& conditions = extension->GetAllConditions();
-    if (conditions.find(name) != conditions.end()) return true;
-  }
-
-  return false;
+  return MetadataProviderIndex::Find(GetIndex(platform).staticConditions,
+                                     name) != nullptr;
 }
 
 bool MetadataProvider::HasObjectCondition(const gd::Platform& platform,
                                           gd::String objectType,
                                           gd::String name) {
-  auto& extensions = platform.GetAllPlatformExtensions();
-  for (auto& extension : extensions) {
-    const auto& conditions = extension->GetAllConditionsForObject(objectType);
-    if (conditions.find(name) != conditions.end()) return true;
-  }
-
-  // Then check in functions of "Base object".
-  for (auto& extension : extensions) {
-    const auto& conditions = extension->GetAllConditionsForObject("");
-    if (conditions.find(name) != conditions.end()) return true;
-  }
-
-  return false;
+  return MetadataProviderIndex::Find(
+             GetIndex(platform).objectsConditions, objectType, name) !=
+         nullptr;
 }
 
 bool MetadataProvider::HasBehaviorCondition(const gd::Platform& platform,
                                             gd::String behaviorType,
                                             gd::String name) {
-  auto& extensions = platform.GetAllPlatformExtensions();
-  for (auto& extension : extensions) {
-    const auto& conditions =
-        extension->GetAllConditionsForBehavior(behaviorType);
-    if (conditions.find(name) != conditions.end()) return true;
-  }
-
-  // Then check in functions of "Base object".
-  for (auto& extension : extensions) {
-    const auto& conditions = extension->GetAllConditionsForBehavior("");
-    if (conditions.find(name) != conditions.end()) return true;
-  }
-
-  return false;
+  return MetadataProviderIndex::Find(
+             GetIndex(platform).behaviorsConditions, behaviorType, name) !=
+         nullptr;
 }
 
 bool MetadataProvider::HasExpression(const gd::Platform& platform,
                                      gd::String name) {
-  auto& extensions = platform.GetAllPlatformExtensions();
-  for (auto& extension : extensions) {
-    const auto& expressions = extension->GetAllExpressions();
-    if (expressions.find(name) != expressions.end()) return true;
-  }
-
-  return false;
+  return MetadataProviderIndex::Find(GetIndex(platform).expressions, name) !=
+         nullptr;
 }
 
 bool MetadataProvider::HasObjectExpression(const gd::Platform& platform,
                                            gd::String objectType,
                                            gd::String name) {
-  auto& extensions = platform.GetAllPlatformExtensions();
-  for (auto& extension : extensions) {
-    const auto& expressions = extension->GetAllExpressionsForObject(objectType);
-    if (expressions.find(name) != expressions.end()) return true;
-  }
-
-  // Then check in functions of "Base object".
-  for (auto& extension : extensions) {
-    const auto& expressions = extension->GetAllExpressionsForObject("");
-    if (expressions.find(name) != expressions.end()) return true;
-  }
-
-  return false;
+  return MetadataProviderIndex::Find(
+             GetIndex(platform).objectsExpressions, objectType, name) !=
+         nullptr;
 }
 
 bool MetadataProvider::HasBehaviorExpression(const gd::Platform& platform,
                                              gd::String behaviorType,
                                              gd::String name) {
-  auto& extensions = platform.GetAllPlatformExtensions();
-  for (auto& extension : extensions) {
-    const auto& expressions =
-        extension->GetAllExpressionsForBehavior(behaviorType);
-    if (expressions.find(name) != expressions.end()) return true;
-  }
-
-  // Then check in functions of "Base object".
-  for (auto& extension : extensions) {
-    const auto& expressions = extension->GetAllExpressionsForBehavior("");
-    if (expressions.find(name) != expressions.end()) return true;
-  }
-
-  return false;
+  return MetadataProviderIndex::Find(
+             GetIndex(platform).behaviorsExpressions, behaviorType, name) !=
+         nullptr;
 }
 
 bool MetadataProvider::HasStrExpression(const gd::Platform& platform,
                                         gd::String name) {
-  auto& extensions = platform.GetAllPlatformExtensions();
-  for (auto& extension : extensions) {
-    const auto& expressions = extension->GetAllStrExpressions();
-    if (expressions.find(name) != expressions.end()) return true;
-  }
-
-  return false;
+  return MetadataProviderIndex::Find(GetIndex(platform).strExpressions, name) !=
+         nullptr;
 }
 
 bool MetadataProvider::HasObjectStrExpression(const gd::Platform& platform,
                                               gd::String objectType,
                                               gd::String name) {
-  auto& extensions = platform.GetAllPlatformExtensions();
-  for (auto& extension : extensions) {
-    const auto& expressions =
-        extension->GetAllStrExpressionsForObject(objectType);
-    if (expressions.find(name) != expressions.end()) return true;
-  }
-
-  // Then check in functions of "Base object".
-  for (auto& extension : extensions) {
-    const auto& expressions = extension->GetAllStrExpressionsForObject("");
-    if (expressions.find(name) != expressions.end()) return true;
-  }
-
-  return false;
+  return MetadataProviderIndex::Find(
+             GetIndex(platform).objectsStrExpressions, objectType, name) !=
+         nullptr;
 }
 
 bool MetadataProvider::HasBehaviorStrExpression(const gd::Platform& platform,
                                                 gd::String behaviorType,
                                                 gd::String name) {
-  auto& extensions = platform.GetAllPlatformExtensions();
-  for (auto& extension : extensions) {
-    const auto& expressions =
-        extension->GetAllStrExpressionsForBehavior(behaviorType);
-    if (expressions.find(name) != expressions.end()) return true;
-  }
-
-  // Then check in functions of "Base object".
-  for (auto& extension : extensions) {
-    const auto& expressions = extension->GetAllStrExpressionsForBehavior("");
-    if (expressions.find(name) != expressions.end()) return true;
-  }
-
-  return false;
+  return MetadataProviderIndex::Find(
+             GetIndex(platform).behaviorsStrExpressions, behaviorType, name) !=
+         nullptr;
 }
 
 MetadataProvider::~MetadataProvider() {}
@@ -5,6 +5,7 @@
  */
 #ifndef METADATAPROVIDER_H
 #define METADATAPROVIDER_H
+#include <atomic>
 #include "GDCore/Extensions/Metadata/InstructionMetadata.h"
 #include "GDCore/String.h"
 namespace gd {
@@ -13,6 +14,7 @@ class ObjectMetadata;
 class EffectMetadata;
 class ExpressionMetadata;
 class ExpressionMetadata;
+class MetadataProviderIndex;
 class Platform;
 class PlatformExtension;
 }  // namespace gd
@@ -56,6 +58,10 @@ class ExtensionAndMetadata {
  * \brief Allow to easily get metadata for instructions (i.e actions and
  * conditions), expressions, objects and behaviors.
  *
+ * Metadata are found using an index of all the metadata of the extensions of
+ * the platform, built the first time it's needed and rebuilt when extensions
+ * are added to or removed from the platform.
+ *
  * \ingroup PlatformDefinition
  */
 class GD_CORE_API MetadataProvider {
@@ -308,6 +314,32 @@ class GD_CORE_API MetadataProvider {
                                        gd::String behaviorType,
                                        gd::String name);
 
+  /**
+   * \brief Build the index of the metadata of the platform extensions, if not
+   * built yet.
+   *
+   * The index is otherwise built by the first search. Call this before
+   * searching metadata from several threads at the same time.
+   */
+  static void BuildIndex(const gd::Platform& platform) { GetIndex(platform); }
+
+  /**
+   * \brief Mark the indexes of the metadata of all the platforms as outdated,
+   * so that they are built again by the next search.
+   *
+   * Called when metadata is added to (or removed from) an extension, an object
+   * or a behavior, as this can be done after the extension was added to a
+   * platform.
+   *
+   * \note The indexes are only used in the IDE: this does nothing in GD C++
+   * Platform runtime, which does not include MetadataProvider.cpp.
+   */
+  static void InvalidateIndexes() {
+#if defined(GD_IDE_ONLY)
+    ++metadataChangesCount;
+#endif
+  }
+
   static bool IsBadExpressionMetadata(const gd::ExpressionMetadata& metadata) {
     return &metadata == &badExpressionMetadata ||
            &metadata == &badStrExpressionMetadata;
@@ -318,6 +350,12 @@ class GD_CORE_API MetadataProvider {
  private:
   MetadataProvider();
 
+  /**
+   * \brief Return the index of the metadata of the platform extensions,
+   * building it if necessary.
+   */
+  static const MetadataProviderIndex& GetIndex(const gd::Platform& platform);
+
   static PlatformExtension badExtension;
   static BehaviorMetadata badBehaviorInfo;
   static ObjectMetadata badObjectInfo;
@@ -325,6 +363,8 @@ class GD_CORE_API MetadataProvider {
   static gd::InstructionMetadata badInstructionMetadata;
   static gd::ExpressionMetadata badExpressionMetadata;
   static gd::ExpressionMetadata badStrExpressionMetadata;
+  static std::atomic<std::size_t> metadataChangesCount;  ///< Incremented by
+                                                         ///< InvalidateIndexes.
   int useless;  // Useless member to avoid emscripten "must have a positive
                 // integer typeid pointer" runtime error.
 };
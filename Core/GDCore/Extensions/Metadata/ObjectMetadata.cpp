@@ -8,6 +8,7 @@
 #include <iostream>
 #include "GDCore/Extensions/Metadata/ExpressionMetadata.h"
 #include "GDCore/Extensions/Metadata/InstructionMetadata.h"
+#include "GDCore/Extensions/Metadata/MetadataProvider.h"
 #include "GDCore/Project/Object.h"
 
 namespace gd {
@@ -66,6 +67,7 @@ gd::InstructionMetadata& ObjectMetadata::AddCondition(
     const gd::String& group,
     const gd::String& icon,
     const gd::String& smallicon) {
+  gd::MetadataProvider::InvalidateIndexes();
 #if defined(GD_IDE_ONLY)
   gd::String nameWithNamespace =
       extensionNamespace.empty() ? name : extensionNamespace + name;
@@ -91,6 +93,7 @@ gd::InstructionMetadata& ObjectMetadata::AddAction(
     const gd::String& group,
     const gd::String& icon,
     const gd::String& smallicon) {
+  gd::MetadataProvider::InvalidateIndexes();
 #if defined(GD_IDE_ONLY)
   gd::String nameWithNamespace =
       extensionNamespace.empty() ? name : extensionNamespace + name;
@@ -114,6 +117,7 @@ gd::ExpressionMetadata& ObjectMetadata::AddExpression(
     const gd::String& description,
     const gd::String& group,
     const gd::String& smallicon) {
+  gd::MetadataProvider::InvalidateIndexes();
 #if defined(GD_IDE_ONLY)
   // Be careful, objects expression do not have namespace ( not necessary as
   // objects inherits from only one derived object )
@@ -132,6 +136,7 @@ gd::ExpressionMetadata& ObjectMetadata::AddStrExpression(
     const gd::String& description,
     const gd::String& group,
     const gd::String& smallicon) {
+  gd::MetadataProvider::InvalidateIndexes();
 #if defined(GD_IDE_ONLY)
   // Be careful, objects expression do not have namespace ( not necessary as
   // objects inherits from only one derived object )
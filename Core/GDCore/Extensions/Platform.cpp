@@ -29,6 +29,8 @@ bool Platform::AddExtension(std::shared_ptr<gd::PlatformExtension> extension) {
   if (enableExtensionLoadingLogs) std::cout << std::endl;
 
   extensionsLoaded.push_back(extension);
+  metadataProviderIndex.reset();
+  extensionsVersion.Change();
 
   // Load all creation/destruction functions for objects provided by the
   // extension
@@ -61,6 +63,8 @@ void Platform::RemoveExtension(const gd::String& name) {
                   return extension->GetName() == name;
                 }),
       extensionsLoaded.end());
+  metadataProviderIndex.reset();
+  extensionsVersion.Change();
 }
 
 bool Platform::IsExtensionLoaded(const gd::String& name) const {
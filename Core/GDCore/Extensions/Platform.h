@@ -10,6 +10,7 @@
 #include <memory>
 #include <vector>
 #include "GDCore/String.h"
+#include "GDCore/Tools/UniqueVersion.h"
 
 namespace gd {
 class InstructionsMetadataHolder;
@@ -22,6 +23,7 @@ class BaseEvent;
 class BehaviorsSharedData;
 class PlatformExtension;
 class LayoutEditorCanvas;
+class MetadataProviderIndex;
 class ProjectExporter;
 }  // namespace gd
 
@@ -116,6 +118,13 @@ class GD_CORE_API Platform {
     return extensionsLoaded;
   };
 
+  /**
+   * \brief Return a version number, changed when extensions are added or
+   * removed.
+   * \see gd::UniqueVersion
+   */
+  std::size_t GetExtensionsVersion() const { return extensionsVersion.Get(); }
+
   /**
    * \brief Remove an extension from the platform.
    *
@@ -176,11 +185,19 @@ class GD_CORE_API Platform {
 #endif
 
  private:
+  friend class MetadataProvider;
+
   std::vector<std::shared_ptr<PlatformExtension>>
       extensionsLoaded;  ///< Extensions of the platform
   std::map<gd::String, CreateFunPtr>
       creationFunctionTable;  ///< Creation functions for objects
   bool enableExtensionLoadingLogs;
+  mutable std::shared_ptr<MetadataProviderIndex>
+      metadataProviderIndex;  ///< Index of the metadata of the extensions,
+                              ///< built by gd::MetadataProvider. Reset when
+                              ///< extensions are added or removed, and built
+                              ///< again if metadata was added to extensions.
+  gd::UniqueVersion extensionsVersion;
 };
 
 }  // namespace gd
@@ -13,6 +13,7 @@
 #include "GDCore/Extensions/Metadata/EventMetadata.h"
 #include "GDCore/Extensions/Metadata/ExpressionMetadata.h"
 #include "GDCore/Extensions/Metadata/InstructionMetadata.h"
+#include "GDCore/Extensions/Metadata/MetadataProvider.h"
 #include "GDCore/Extensions/Metadata/ObjectMetadata.h"
 #include "GDCore/Extensions/Platform.h"
 #include "GDCore/IDE/PlatformManager.h"
@@ -40,6 +41,7 @@ gd::InstructionMetadata& PlatformExtension::AddCondition(
     const gd::String& group,
     const gd::String& icon,
     const gd::String& smallicon) {
+  gd::MetadataProvider::InvalidateIndexes();
 #if defined(GD_IDE_ONLY)
   gd::String nameWithNamespace =
       GetNameSpace().empty() ? name : GetNameSpace() + name;
@@ -64,6 +66,7 @@ gd::InstructionMetadata& PlatformExtension::AddAction(
     const gd::String& group,
     const gd::String& icon,
     const gd::String& smallicon) {
+  gd::MetadataProvider::InvalidateIndexes();
 #if defined(GD_IDE_ONLY)
   gd::String nameWithNamespace =
       GetNameSpace().empty() ? name : GetNameSpace() + name;
@@ -86,6 +89,7 @@ gd::ExpressionMetadata& PlatformExtension::AddExpression(
     const gd::String& description,
     const gd::String& group,
     const gd::String& smallicon) {
+  gd::MetadataProvider::InvalidateIndexes();
 #if defined(GD_IDE_ONLY)
   gd::String nameWithNamespace =
       GetNameSpace().empty() ? name : GetNameSpace() + name;
@@ -106,6 +110,7 @@ gd::ExpressionMetadata& PlatformExtension::AddStrExpression(
     const gd::String& description,
     const gd::String& group,
     const gd::String& smallicon) {
+  gd::MetadataProvider::InvalidateIndexes();
 #if defined(GD_IDE_ONLY)
   gd::String nameWithNamespace =
       GetNameSpace().empty() ? name : GetNameSpace() + name;
@@ -133,6 +138,7 @@ gd::ObjectMetadata& PlatformExtension::AddObject(
     const gd::String& description,
     const gd::String& icon24x24,
     std::shared_ptr<gd::Object> instance) {
+  gd::MetadataProvider::InvalidateIndexes();
   gd::String nameWithNamespace =
       GetNameSpace().empty() ? name : GetNameSpace() + name;
   objectsInfos[nameWithNamespace] = ObjectMetadata(GetNameSpace(),
@@ -156,6 +162,7 @@ gd::BehaviorMetadata& PlatformExtension::AddBehavior(
     const gd::String& className,
     std::shared_ptr<gd::Behavior> instance,
     std::shared_ptr<gd::BehaviorsSharedData> sharedDatasInstance) {
+  gd::MetadataProvider::InvalidateIndexes();
   gd::String nameWithNamespace =
       GetNameSpace().empty() ? name : GetNameSpace() + name;
   behaviorsInfo[nameWithNamespace] = BehaviorMetadata(GetNameSpace(),
@@ -173,6 +180,7 @@ gd::BehaviorMetadata& PlatformExtension::AddBehavior(
 }
 
 gd::EffectMetadata& PlatformExtension::AddEffect(const gd::String& name) {
+  gd::MetadataProvider::InvalidateIndexes();
   gd::String nameWithNamespace =
       GetNameSpace().empty() ? name : GetNameSpace() + name;
   effectsMetadata[nameWithNamespace] = EffectMetadata(nameWithNamespace);
@@ -460,6 +468,7 @@ bool PlatformExtension::IsBuiltin() const {
 
 #if defined(GD_IDE_ONLY)
 void PlatformExtension::StripUnimplementedInstructionsAndExpressions() {
+  gd::MetadataProvider::InvalidateIndexes();
   for (std::map<gd::String, gd::InstructionMetadata>::iterator it =
            GetAllActions().begin();
        it != GetAllActions().end();) {
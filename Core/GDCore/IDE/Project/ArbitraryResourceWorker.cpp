@@ -78,10 +78,10 @@ void ArbitraryResourceWorker::ExposeResource(gd::Resource& resource) {
 
 ArbitraryResourceWorker::~ArbitraryResourceWorker() {}
 
-void LaunchResourceWorkerOnEvents(const gd::Project& project,
-                                  gd::EventsList& events,
-                                  gd::ArbitraryResourceWorker& worker) {
-  // Get all extensions used
+namespace {
+
+std::vector<std::shared_ptr<gd::PlatformExtension> > GetUsedExtensions(
+    const gd::Project& project) {
   std::vector<std::shared_ptr<gd::PlatformExtension> > allGameExtensions;
   std::vector<gd::String> usedExtensions = project.GetUsedExtensions();
   for (std::size_t i = 0; i < usedExtensions.size(); ++i) {
@@ -92,94 +92,142 @@ void LaunchResourceWorkerOnEvents(const gd::Project& project,
       allGameExtensions.push_back(extension);
   }
 
+  return allGameExtensions;
+}
+
+bool HasAction(gd::PlatformExtension& extension, const gd::String& type) {
+  const std::map<gd::String, gd::InstructionMetadata>& allActions =
+      extension.GetAllActions();
+  if (allActions.find(type) != allActions.end()) return true;
+
+  const vector<gd::String>& objects = extension.GetExtensionObjectsTypes();
+  for (std::size_t o = 0; o < objects.size(); ++o) {
+    const std::map<gd::String, gd::InstructionMetadata>& allObjectsActions =
+        extension.GetAllActionsForObject(objects[o]);
+    if (allObjectsActions.find(type) != allObjectsActions.end()) return true;
+  }
+
+  const vector<gd::String>& autos = extension.GetBehaviorsTypes();
+  for (std::size_t a = 0; a < autos.size(); ++a) {
+    const std::map<gd::String, gd::InstructionMetadata>& allAutosActions =
+        extension.GetAllActionsForBehavior(autos[a]);
+    if (allAutosActions.find(type) != allAutosActions.end()) return true;
+  }
+
+  return false;
+}
+
+bool HasCondition(gd::PlatformExtension& extension, const gd::String& type) {
+  const std::map<gd::String, gd::InstructionMetadata>& allConditions =
+      extension.GetAllConditions();
+  if (allConditions.find(type) != allConditions.end()) return true;
+
+  const vector<gd::String>& objects = extension.GetExtensionObjectsTypes();
+  for (std::size_t j = 0; j < objects.size(); ++j) {
+    const std::map<gd::String, gd::InstructionMetadata>& allObjectsConditions =
+        extension.GetAllConditionsForObject(objects[j]);
+    if (allObjectsConditions.find(type) != allObjectsConditions.end())
+      return true;
+  }
+
+  const vector<gd::String>& autos = extension.GetBehaviorsTypes();
+  for (std::size_t j = 0; j < autos.size(); ++j) {
+    const std::map<gd::String, gd::InstructionMetadata>& allAutosConditions =
+        extension.GetAllConditionsForBehavior(autos[j]);
+    if (allAutosConditions.find(type) != allAutosConditions.end()) return true;
+  }
+
+  return false;
+}
+
+/**
+ * Call \a exposeInstruction with each action and condition of the events and
+ * their sub events, and the extension of the action or condition.
+ */
+template <class EventsListType, class ExposeInstructionFunction>
+void ExposeInstructionsOfEvents(
+    const std::vector<std::shared_ptr<gd::PlatformExtension> >&
+        allGameExtensions,
+    EventsListType& events,
+    ExposeInstructionFunction& exposeInstruction) {
   for (std::size_t j = 0; j < events.size(); j++) {
-    vector<gd::InstructionsList*> allActionsVectors =
-        events[j].GetAllActionsVectors();
+    auto allActionsVectors = events[j].GetAllActionsVectors();
     for (std::size_t i = 0; i < allActionsVectors.size(); ++i) {
       for (std::size_t k = 0; k < allActionsVectors[i]->size(); k++) {
-        gd::String type = allActionsVectors[i]->Get(k).GetType();
+        auto& action = allActionsVectors[i]->Get(k);
         for (std::size_t e = 0; e < allGameExtensions.size(); ++e) {
-          bool extensionHasAction = false;
-
-          const std::map<gd::String, gd::InstructionMetadata>& allActions =
-              allGameExtensions[e]->GetAllActions();
-          if (allActions.find(type) != allActions.end())
-            extensionHasAction = true;
-
-          const vector<gd::String>& objects =
-              allGameExtensions[e]->GetExtensionObjectsTypes();
-          for (std::size_t o = 0; o < objects.size(); ++o) {
-            const std::map<gd::String, gd::InstructionMetadata>&
-                allObjectsActions =
-                    allGameExtensions[e]->GetAllActionsForObject(objects[o]);
-            if (allObjectsActions.find(type) != allObjectsActions.end())
-              extensionHasAction = true;
-          }
-
-          const vector<gd::String>& autos =
-              allGameExtensions[e]->GetBehaviorsTypes();
-          for (std::size_t a = 0; a < autos.size(); ++a) {
-            const std::map<gd::String, gd::InstructionMetadata>&
-                allAutosActions =
-                    allGameExtensions[e]->GetAllActionsForBehavior(autos[a]);
-            if (allAutosActions.find(type) != allAutosActions.end())
-              extensionHasAction = true;
-          }
-
-          if (extensionHasAction) {
-            allGameExtensions[e]->ExposeActionsResources(
-                allActionsVectors[i]->Get(k), worker);
+          if (HasAction(*allGameExtensions[e], action.GetType())) {
+            exposeInstruction(*allGameExtensions[e], action, true);
             break;
           }
         }
       }
     }
 
-    vector<gd::InstructionsList*> allConditionsVector =
-        events[j].GetAllConditionsVectors();
+    auto allConditionsVector = events[j].GetAllConditionsVectors();
     for (std::size_t i = 0; i < allConditionsVector.size(); ++i) {
       for (std::size_t k = 0; k < allConditionsVector[i]->size(); k++) {
-        gd::String type = allConditionsVector[i]->Get(k).GetType();
+        auto& condition = allConditionsVector[i]->Get(k);
         for (std::size_t e = 0; e < allGameExtensions.size(); ++e) {
-          bool extensionHasCondition = false;
-
-          const std::map<gd::String, gd::InstructionMetadata>& allConditions =
-              allGameExtensions[e]->GetAllConditions();
-          if (allConditions.find(type) != allConditions.end())
-            extensionHasCondition = true;
-
-          const vector<gd::String>& objects =
-              allGameExtensions[e]->GetExtensionObjectsTypes();
-          for (std::size_t j = 0; j < objects.size(); ++j) {
-            const std::map<gd::String, gd::InstructionMetadata>&
-                allObjectsConditions =
-                    allGameExtensions[e]->GetAllConditionsForObject(objects[j]);
-            if (allObjectsConditions.find(type) != allObjectsConditions.end())
-              extensionHasCondition = true;
-          }
-
-          const vector<gd::String>& autos =
-              allGameExtensions[e]->GetBehaviorsTypes();
-          for (std::size_t j = 0; j < autos.size(); ++j) {
-            const std::map<gd::String, gd::InstructionMetadata>&
-                allAutosConditions =
-                    allGameExtensions[e]->GetAllConditionsForBehavior(autos[j]);
-            if (allAutosConditions.find(type) != allAutosConditions.end())
-              extensionHasCondition = true;
-          }
-
-          if (extensionHasCondition)
-            allGameExtensions[e]->ExposeConditionsResources(
-                allConditionsVector[i]->Get(k), worker);
+          if (HasCondition(*allGameExtensions[e], condition.GetType()))
+            exposeInstruction(*allGameExtensions[e], condition, false);
         }
       }
     }
 
     if (events[j].CanHaveSubEvents())
-      LaunchResourceWorkerOnEvents(project, events[j].GetSubEvents(), worker);
+      ExposeInstructionsOfEvents(
+          allGameExtensions, events[j].GetSubEvents(), exposeInstruction);
   }
+}
+
+}  // namespace
+
+void LaunchResourceWorkerOnEvents(const gd::Project& project,
+                                  gd::EventsList& events,
+                                  gd::ArbitraryResourceWorker& worker) {
+  auto exposeInstruction = [&worker](gd::PlatformExtension& extension,
+                                     gd::Instruction& instruction,
+                                     bool isAction) {
+    if (isAction)
+      extension.ExposeActionsResources(instruction, worker);
+    else
+      extension.ExposeConditionsResources(instruction, worker);
+  };
+  ExposeInstructionsOfEvents(
+      GetUsedExtensions(project), events, exposeInstruction);
+}
+
+bool LaunchResourceWorkerOnSharedEvents(const gd::Project& project,
+                                        const gd::EventsList& events,
+                                        gd::ArbitraryResourceWorker& worker) {
+  bool changed = false;
+  gd::Instruction copy;  // Reused for all the instructions, to reuse its
+                         // memory.
+  auto exposeInstruction = [&worker, &changed, &copy](
+                               gd::PlatformExtension& extension,
+                               const gd::Instruction& instruction,
+                               bool isAction) {
+    copy = instruction;
+    if (isAction)
+      extension.ExposeActionsResources(copy, worker);
+    else
+      extension.ExposeConditionsResources(copy, worker);
+
+    if (copy.GetParametersCount() != instruction.GetParametersCount()) {
+      changed = true;
+      return;
+    }
+    for (std::size_t i = 0; i < instruction.GetParametersCount(); ++i) {
+      if (copy.GetParameter(i).GetPlainString() !=
+          instruction.GetParameter(i).GetPlainString())
+        changed = true;
+    }
+  };
+  ExposeInstructionsOfEvents(
+      GetUsedExtensions(project), events, exposeInstruction);
 
-  return;
+  return changed;
 }
 
 }  // namespace gd
@@ -109,6 +109,23 @@ LaunchResourceWorkerOnEvents(const gd::Project &project,
                              gd::EventsList &events,
                              gd::ArbitraryResourceWorker &worker);
 
+/**
+ * Same as LaunchResourceWorkerOnEvents, for events that must not be modified
+ * (like events shared with another layout, see gd::Layout::InitAsSnapshotOf):
+ * each action and condition is copied before being exposed to the worker.
+ *
+ * \return true if the worker changed a parameter of an action or condition.
+ * In this case, call LaunchResourceWorkerOnEvents on events that can be
+ * modified to update them.
+ *
+ * \see gd::ArbitraryResourceWorker
+ * \ingroup IDE
+ */
+bool GD_CORE_API
+LaunchResourceWorkerOnSharedEvents(const gd::Project &project,
+                                   const gd::EventsList &events,
+                                   gd::ArbitraryResourceWorker &worker);
+
 }  // namespace gd
 
 #endif  // ARBITRARYRESOURCEWORKER_H
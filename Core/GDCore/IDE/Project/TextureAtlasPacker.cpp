@@ -0,0 +1,151 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#if defined(GD_IDE_ONLY)
+#include "GDCore/IDE/Project/TextureAtlasPacker.h"
+#include <algorithm>
+#include "GDCore/IDE/Project/ResourcesInUseHelper.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Project/Project.h"
+
+namespace gd {
+
+TextureAtlasPacker::TextureAtlasPacker(unsigned int maxPageSize_,
+                                       unsigned int padding_)
+    : maxPageSize(maxPageSize_), padding(padding_) {}
+
+void TextureAtlasPacker::AddImage(const gd::String& group,
+                                  const gd::String& name,
+                                  unsigned int width,
+                                  unsigned int height) {
+  if (!imagesNames.insert(name).second) return;
+
+  ImageToPack image;
+  image.group = group;
+  image.name = name;
+  image.width = width;
+  image.height = height;
+  imagesToPack.push_back(image);
+}
+
+void TextureAtlasPacker::Pack() {
+  pages.clear();
+  imagesNotPacked.clear();
+
+  std::map<gd::String, std::vector<const ImageToPack*> > groups;
+  for (const ImageToPack& image : imagesToPack)
+    groups[image.group].push_back(&image);
+
+  for (auto& it : groups) PackGroup(it.first, it.second);
+}
+
+void TextureAtlasPacker::PackGroup(const gd::String& group,
+                                   std::vector<const ImageToPack*>& images) {
+  // Tallest images first, so that the images of a shelf have similar heights.
+  // The name is used last to always pack images in the same way.
+  std::sort(images.begin(),
+            images.end(),
+            [](const ImageToPack* a, const ImageToPack* b) {
+              if (a->height != b->height) return a->height > b->height;
+              if (a->width != b->width) return a->width > b->width;
+              return a->name < b->name;
+            });
+
+  Page* page = nullptr;
+  unsigned int shelfX = 0;
+  unsigned int shelfY = 0;
+  unsigned int shelfHeight = 0;
+  for (const ImageToPack* image : images) {
+    if (image->width == 0 || image->height == 0 ||
+        image->width + 2 * padding > maxPageSize ||
+        image->height + 2 * padding > maxPageSize) {
+      imagesNotPacked.push_back(image->name);
+      continue;
+    }
+
+    // Start a new shelf when the image does not fit on the right of the
+    // current one, and a new page when the new shelf does not fit below.
+    if (page && shelfX + image->width + padding > maxPageSize) {
+      shelfX = padding;
+      shelfY += shelfHeight + padding;
+      shelfHeight = 0;
+    }
+    if (!page || shelfY + image->height + padding > maxPageSize) {
+      pages.push_back(Page());
+      page = &pages.back();
+      page->group = group;
+      shelfX = padding;
+      shelfY = padding;
+      shelfHeight = 0;
+    }
+
+    page->regions[image->name] = TextureAtlas::Region(
+        pages.size() - 1, shelfX, shelfY, image->width, image->height);
+    shelfX += image->width + padding;
+    shelfHeight = std::max(shelfHeight, image->height);
+    page->width = std::max(page->width, shelfX);
+    page->height = std::max(page->height, shelfY + shelfHeight + padding);
+  }
+}
+
+void TextureAtlasPacker::FillTextureAtlas(
+    gd::TextureAtlas& atlas,
+    const std::vector<gd::String>& pagesResourceNames) const {
+  for (std::size_t i = 0; i < pages.size() && i < pagesResourceNames.size();
+       ++i) {
+    std::size_t pageIndex = atlas.AddPage(pagesResourceNames[i]);
+    for (const auto& it : pages[i].regions) {
+      TextureAtlas::Region region = it.second;
+      region.page = pageIndex;
+      atlas.SetRegion(it.first, region);
+    }
+  }
+}
+
+std::map<gd::String, std::set<gd::String> >
+TextureAtlasPacker::GetSpritesImagesGroups(gd::Project& project) {
+  std::map<gd::String, std::set<gd::String> > groups;
+  std::map<gd::String, gd::String> imagesGroup;
+  gd::ResourcesInUseHelper imagesNotInSprites;
+
+  auto addObjectImages = [&](gd::Object& object, const gd::String& group) {
+    if (object.GetType() != "Sprite") {
+      object.ExposeResources(imagesNotInSprites);
+      return;
+    }
+
+    gd::ResourcesInUseHelper objectResources;
+    object.ExposeResources(objectResources);
+    for (const gd::String& image : objectResources.GetAllImages()) {
+      auto it = imagesGroup.find(image);
+      if (it == imagesGroup.end())
+        imagesGroup[image] = group;
+      else if (it->second != group)
+        it->second = "";  // Used by several layouts.
+    }
+  };
+
+  for (std::size_t i = 0; i < project.GetObjectsCount(); ++i)
+    addObjectImages(project.GetObject(i), "");
+
+  for (std::size_t i = 0; i < project.GetLayoutsCount(); ++i) {
+    gd::Layout& layout = project.GetLayout(i);
+    for (std::size_t j = 0; j < layout.GetObjectsCount(); ++j)
+      addObjectImages(layout.GetObject(j), layout.GetName());
+  }
+
+  const std::set<gd::String>& excludedImages =
+      imagesNotInSprites.GetAllImages();
+  for (const auto& it : imagesGroup) {
+    if (excludedImages.find(it.first) == excludedImages.end())
+      groups[it.second].insert(it.first);
+  }
+
+  return groups;
+}
+
+}  // namespace gd
+#endif
@@ -0,0 +1,151 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#if defined(GD_IDE_ONLY)
+#ifndef GDCORE_TEXTUREATLASPACKER_H
+#define GDCORE_TEXTUREATLASPACKER_H
+#include <map>
+#include <set>
+#include <vector>
+#include "GDCore/Project/TextureAtlas.h"
+#include "GDCore/String.h"
+namespace gd {
+class Project;
+}
+
+namespace gd {
+
+/**
+ * \brief Pack images into the pages of a texture atlas.
+ *
+ * Images are added in groups (for example, the images used by a layout), and
+ * the images of different groups are never stored in the same page, so that
+ * loading a layout does not load the images of the others.
+ *
+ * Images are packed in rows ("shelves") sorted by height, which is fast,
+ * deterministic and wastes little space for the images of sprites, which
+ * usually have similar sizes.
+ *
+ * Usage example:
+\code
+gd::TextureAtlasPacker packer(2048, 2);
+packer.AddImage("Level1", "Player.png", 64, 64);
+packer.AddImage("Level1", "Enemy.png", 32, 48);
+packer.Pack();
+
+for (std::size_t i = 0; i < packer.GetPagesCount(); ++i) {
+  const gd::TextureAtlasPacker::Page & page = packer.GetPage(i);
+  // Draw the images at the position of their regions in a new image
+  // of page.width x page.height pixels, and save it...
+}
+\endcode
+ *
+ * \see gd::TextureAtlas
+ * \ingroup IDE
+ */
+class GD_CORE_API TextureAtlasPacker {
+ public:
+  /**
+   * \brief A page of the atlas, with the regions where images are stored.
+   * The page index of the regions is the index of the page in the packer.
+   */
+  struct Page {
+    Page() : width(0), height(0){};
+
+    gd::String group;
+    unsigned int width;
+    unsigned int height;
+    std::map<gd::String, TextureAtlas::Region> regions;
+  };
+
+  /**
+   * \brief Create a packer.
+   * \param maxPageSize The maximum width and height of the pages.
+   * \param padding The number of pixels left around each image, to avoid
+   * pixels of the neighbouring images to be displayed when smoothing is used.
+   */
+  TextureAtlasPacker(unsigned int maxPageSize = 2048,
+                     unsigned int padding = 2);
+  virtual ~TextureAtlasPacker(){};
+
+  /**
+   * \brief Add an image to be packed in the pages of \a group.
+   *
+   * \note An image added to several groups is only packed in the first one.
+   */
+  void AddImage(const gd::String& group,
+                const gd::String& name,
+                unsigned int width,
+                unsigned int height);
+
+  /**
+   * \brief Pack the images added to the packer.
+   *
+   * Images too large to fit in a page are not packed and must be kept as
+   * independent images.
+   */
+  void Pack();
+
+  /**
+   * \brief Return the number of pages created by Pack.
+   */
+  std::size_t GetPagesCount() const { return pages.size(); }
+
+  /**
+   * \brief Return a page created by Pack.
+   */
+  const Page& GetPage(std::size_t index) const { return pages[index]; }
+
+  /**
+   * \brief Return the names of the images which were not packed because they
+   * are too large.
+   */
+  const std::vector<gd::String>& GetImagesNotPacked() const {
+    return imagesNotPacked;
+  }
+
+  /**
+   * \brief Add the pages and regions created by Pack to \a atlas.
+   * \param pagesResourceNames The names of the image resources of the pages,
+   * in the same order as the pages.
+   */
+  void FillTextureAtlas(
+      gd::TextureAtlas& atlas,
+      const std::vector<gd::String>& pagesResourceNames) const;
+
+  /**
+   * \brief Return the images of the sprite objects of the project, grouped by
+   * the layout using them.
+   *
+   * Images used by several layouts, or by global objects, are put in a group
+   * with an empty name. Images used by other objects than sprites are not
+   * returned, as these objects display whole images.
+   */
+  static std::map<gd::String, std::set<gd::String> > GetSpritesImagesGroups(
+      gd::Project& project);
+
+ private:
+  struct ImageToPack {
+    gd::String group;
+    gd::String name;
+    unsigned int width;
+    unsigned int height;
+  };
+
+  void PackGroup(const gd::String& group,
+                 std::vector<const ImageToPack*>& images);
+
+  unsigned int maxPageSize;
+  unsigned int padding;
+  std::vector<ImageToPack> imagesToPack;
+  std::set<gd::String> imagesNames;  ///< The images added to the packer.
+  std::vector<Page> pages;
+  std::vector<gd::String> imagesNotPacked;
+};
+
+}  // namespace gd
+
+#endif  // GDCORE_TEXTUREATLASPACKER_H
+#endif
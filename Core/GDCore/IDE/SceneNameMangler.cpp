@@ -14,6 +14,9 @@ SceneNameMangler *SceneNameMangler::_singleton = nullptr;
 
 const gd::String &SceneNameMangler::GetMangledSceneName(
     const gd::String &sceneName) {
+  // References to the elements of an unordered_map stay valid when other
+  // elements are inserted, so the returned name can be used without the lock.
+  std::lock_guard<std::mutex> lock(mutex);
   auto it = mangledSceneNames.find(sceneName);
   if (it != mangledSceneNames.end()) {
     return it->second;
@@ -6,6 +6,7 @@
 
 #ifndef SCENENAMEMANGLER_H
 #define SCENENAMEMANGLER_H
+#include <mutex>
 #include <unordered_map>
 #include "GDCore/String.h"
 
@@ -26,6 +27,9 @@ class GD_CORE_API SceneNameMangler {
    *
    * The mangled name is memoized as this is intensively used during project
    * export and events code generation.
+   *
+   * \note Can be called from several threads at the same time, once the
+   * singleton is created.
    */
   const gd::String& GetMangledSceneName(const gd::String& sceneName);
 
@@ -39,6 +43,7 @@ class GD_CORE_API SceneNameMangler {
 
   std::unordered_map<gd::String, gd::String>
       mangledSceneNames;  ///< Memoized results of mangling
+  std::mutex mutex;       ///< Protects mangledSceneNames.
 };
 
 }  // namespace gd
@@ -7,7 +7,11 @@
 
 namespace gd {
 
-ExternalEvents::ExternalEvents() : lastChangeTimeStamp(0) {
+ExternalEvents::ExternalEvents()
+    : lastChangeTimeStamp(0),
+      hasLazyContent(false),
+      lazyProject(nullptr),
+      sharedEvents(nullptr) {
   // ctor
 }
 
@@ -25,26 +29,62 @@ void ExternalEvents::Init(const ExternalEvents& externalEvents) {
   name = externalEvents.GetName();
   associatedScene = externalEvents.GetAssociatedLayout();
   lastChangeTimeStamp = externalEvents.GetLastChangeTimeStamp();
-  events = externalEvents.events;
+  events = externalEvents.GetEvents();
+  hasLazyContent = false;
+  lazyProject = nullptr;
+  lazyEventsElement.reset();
+  sharedEvents = nullptr;
+}
+
+void ExternalEvents::InitAsSnapshotOf(const ExternalEvents& other) {
+  name = other.GetName();
+  associatedScene = other.GetAssociatedLayout();
+  lastChangeTimeStamp = other.GetLastChangeTimeStamp();
+  events.Clear();
+  sharedEvents = &other.GetEvents();
+  hasLazyContent = false;
+  lazyProject = nullptr;
+  lazyEventsElement.reset();
+}
+
+void ExternalEvents::CopySharedEvents() {
+  events = *sharedEvents;
+  sharedEvents = nullptr;
 }
 
 void ExternalEvents::SerializeTo(SerializerElement& element) const {
   element.SetAttribute("name", name);
   element.SetAttribute("associatedLayout", associatedScene);
   element.SetAttribute("lastChangeTimeStamp", (int)lastChangeTimeStamp);
-  gd::EventsListSerialization::SerializeEventsTo(events,
+  gd::EventsListSerialization::SerializeEventsTo(GetEvents(),
                                                  element.AddChild("events"));
 }
 
 void ExternalEvents::UnserializeFrom(gd::Project& project,
-                                     const SerializerElement& element) {
+                                     const SerializerElement& element,
+                                     bool lazyLoading) {
   name = element.GetStringAttribute("name", "", "Name");
   associatedScene =
       element.GetStringAttribute("associatedLayout", "", "AssociatedScene");
   lastChangeTimeStamp =
       element.GetIntAttribute("lastChangeTimeStamp", 0, "LastChangeTimeStamp");
+  lazyEventsElement =
+      lazyLoading ? element.GetSharedChildOutsideArena("events", "Events")
+                  : std::shared_ptr<const SerializerElement>();
+  lazyProject = &project;
+  hasLazyContent = lazyEventsElement != nullptr;
+  sharedEvents = nullptr;
+  if (!hasLazyContent)
+    gd::EventsListSerialization::UnserializeEventsFrom(
+        project, events, element.GetChild("events", 0, "Events"));
+}
+
+void ExternalEvents::UnserializeLazyContent() {
   gd::EventsListSerialization::UnserializeEventsFrom(
-      project, events, element.GetChild("events", 0, "Events"));
+      *lazyProject, events, *lazyEventsElement);
+  lazyProject = nullptr;
+  lazyEventsElement.reset();
+  hasLazyContent = false;  // Last, as other threads can read the events then.
 }
 
 }  // namespace gd
@@ -6,8 +6,10 @@
 #if defined(GD_IDE_ONLY)
 #ifndef GDCORE_EXTERNALEVENTS_H
 #define GDCORE_EXTERNALEVENTS_H
+#include <atomic>
 #include <ctime>
 #include <memory>
+#include <mutex>
 #include <vector>
 #include "GDCore/Events/EventsList.h"
 #include "GDCore/String.h"
@@ -88,12 +90,38 @@ class GD_CORE_API ExternalEvents {
   /**
    * \brief Get the events.
    */
-  virtual const gd::EventsList& GetEvents() const { return events; }
+  virtual const gd::EventsList& GetEvents() const {
+    LoadLazyContent();
+    return sharedEvents ? *sharedEvents : events;
+  }
 
   /**
    * \brief Get the events.
    */
-  virtual gd::EventsList& GetEvents() { return events; }
+  virtual gd::EventsList& GetEvents() {
+    LoadLazyContent();
+    if (sharedEvents) CopySharedEvents();
+    return events;
+  }
+
+  /**
+   * \brief Return true if the events are still shared with the external
+   * events these external events are a snapshot of.
+   *
+   * \see gd::ExternalEvents::InitAsSnapshotOf
+   */
+  bool HasSharedEvents() const { return sharedEvents != nullptr; }
+
+  /**
+   * \brief Make these external events a copy of \a other, sharing its events
+   * until they are modified (i.e: accessed with the non const getter).
+   *
+   * \warning \a other must not be modified or destroyed while these external
+   * events are used.
+   *
+   * \see gd::Layout::InitAsSnapshotOf
+   */
+  void InitAsSnapshotOf(const ExternalEvents& other);
 
   /**
    * \brief Serialize external events.
@@ -102,9 +130,21 @@ class GD_CORE_API ExternalEvents {
 
   /**
    * \brief Unserialize the external events.
+   *
+   * \param lazyLoading If true, the events are only unserialized when
+   * accessed for the first time. Until then, their element is kept (shared
+   * with \a element, or copied if \a element was allocated from an arena), so
+   * it must not be modified.
    */
   virtual void UnserializeFrom(gd::Project& project,
-                               const SerializerElement& element);
+                               const SerializerElement& element,
+                               bool lazyLoading = false);
+
+  /**
+   * \brief Return false if the external events were lazily unserialized and
+   * the events were not unserialized yet.
+   */
+  bool IsFullyLoaded() const { return !hasLazyContent; }
 
  private:
   gd::String name;
@@ -112,6 +152,37 @@ class GD_CORE_API ExternalEvents {
   time_t lastChangeTimeStamp;  ///< Time of the last build
   gd::EventsList events;       ///< List of events
 
+  /**
+   * \brief Unserialize the events, if the external events were lazily
+   * unserialized and they were not unserialized yet.
+   *
+   * This is called by const accessors: several threads can call it at the
+   * same time, only the first one unserializes the events.
+   */
+  void LoadLazyContent() const {
+    if (!hasLazyContent) return;
+
+    std::lock_guard<std::mutex> lock(lazyContentMutex);
+    if (hasLazyContent)
+      const_cast<ExternalEvents*>(this)->UnserializeLazyContent();
+  }
+
+  void UnserializeLazyContent();
+
+  std::atomic<bool> hasLazyContent;  ///< True if the events are still to be
+                                     ///< unserialized from lazyEventsElement.
+  mutable std::mutex lazyContentMutex;  ///< Protects the unserialization of
+                                        ///< the events.
+  gd::Project* lazyProject;
+  std::shared_ptr<const SerializerElement> lazyEventsElement;
+
+  void CopySharedEvents();
+
+  const gd::EventsList* sharedEvents;  ///< If not null, the events of the
+                                       ///< external events these external
+                                       ///< events are a snapshot of, used
+                                       ///< until they are modified.
+
   /**
    * Initialize from another ExternalEvents. Used by copy-ctor and assign-op.
    * Don't forget to update me if members were changed!
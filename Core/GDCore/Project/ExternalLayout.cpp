@@ -12,19 +12,75 @@
 
 namespace gd {
 
-void ExternalLayout::UnserializeFrom(const SerializerElement& element) {
+void ExternalLayout::UnserializeFrom(const SerializerElement& element,
+                                     bool lazyLoading) {
   name = element.GetStringAttribute("name", "", "Name");
-  instances.UnserializeFrom(element.GetChild("instances", 0, "Instances"));
+  lazyInstancesElement =
+      lazyLoading ? element.GetSharedChildOutsideArena("instances", "Instances")
+                  : std::shared_ptr<const SerializerElement>();
+  hasLazyContent = lazyInstancesElement != nullptr;
+#if defined(GD_IDE_ONLY)
+  sharedInstances = nullptr;
+#endif
+  if (!hasLazyContent)
+    instances.UnserializeFrom(element.GetChild("instances", 0, "Instances"));
 #if defined(GD_IDE_ONLY)
   editionSettings.UnserializeFrom(element.GetChild("editionSettings"));
 #endif
   associatedLayout = element.GetStringAttribute("associatedLayout");
 }
 
+void ExternalLayout::UnserializeLazyContent() {
+  instances.UnserializeFrom(*lazyInstancesElement);
+  lazyInstancesElement.reset();
+  hasLazyContent = false;  // Last, as other threads can read the instances
+                           // then.
+}
+
+#if defined(GD_IDE_ONLY)
+void ExternalLayout::InitAsSnapshotOf(const ExternalLayout& other) {
+  Init(other, true);
+}
+
+void ExternalLayout::CopySharedInstances() {
+  instances = *sharedInstances;
+  sharedInstances = nullptr;
+}
+#endif
+
+void ExternalLayout::Init(const ExternalLayout& other, bool shareInstances) {
+  name = other.name;
+#if defined(GD_IDE_ONLY)
+  editionSettings = other.editionSettings;
+#endif
+  associatedLayout = other.associatedLayout;
+
+  // Lazily unserialized instances are shared as their element is not
+  // modified.
+  {
+    std::lock_guard<std::mutex> lock(other.lazyContentMutex);
+    hasLazyContent = other.hasLazyContent.load();
+    lazyInstancesElement = other.lazyInstancesElement;
+  }
+#if defined(GD_IDE_ONLY)
+  sharedInstances = nullptr;
+  if (shareInstances && !hasLazyContent) {
+    instances.Clear();
+    sharedInstances = &other.GetInitialInstances();
+    return;
+  }
+  if (other.sharedInstances) {
+    instances = *other.sharedInstances;
+    return;
+  }
+#endif
+  instances = other.instances;
+}
+
 #if defined(GD_IDE_ONLY)
 void ExternalLayout::SerializeTo(SerializerElement& element) const {
   element.SetAttribute("name", name);
-  instances.SerializeTo(element.AddChild("instances"));
+  GetInitialInstances().SerializeTo(element.AddChild("instances"));
   editionSettings.SerializeTo(element.AddChild("editionSettings"));
   element.SetAttribute("associatedLayout", associatedLayout);
 }
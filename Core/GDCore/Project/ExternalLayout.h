@@ -6,7 +6,9 @@
 
 #ifndef GDCORE_EXTERNALLAYOUT_H
 #define GDCORE_EXTERNALLAYOUT_H
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include "GDCore/Project/InitialInstancesContainer.h"
 #include "GDCore/String.h"
 namespace gd {
@@ -24,7 +26,18 @@ namespace gd {
  */
 class GD_CORE_API ExternalLayout {
  public:
-  ExternalLayout(){};
+  ExternalLayout()
+      : hasLazyContent(false)
+#if defined(GD_IDE_ONLY)
+        ,
+        sharedInstances(nullptr)
+#endif
+            {};
+  ExternalLayout(const ExternalLayout& other) { Init(other); };
+  ExternalLayout& operator=(const ExternalLayout& other) {
+    if (this != &other) Init(other);
+    return *this;
+  };
   virtual ~ExternalLayout(){};
 
   /**
@@ -46,15 +59,37 @@ class GD_CORE_API ExternalLayout {
    * \brief Return the container storing initial instances.
    */
   const gd::InitialInstancesContainer& GetInitialInstances() const {
+    LoadLazyContent();
+#if defined(GD_IDE_ONLY)
+    if (sharedInstances) return *sharedInstances;
+#endif
     return instances;
   }
 
   /**
    * \brief Return the container storing initial instances.
    */
-  gd::InitialInstancesContainer& GetInitialInstances() { return instances; }
+  gd::InitialInstancesContainer& GetInitialInstances() {
+    LoadLazyContent();
+#if defined(GD_IDE_ONLY)
+    if (sharedInstances) CopySharedInstances();
+#endif
+    return instances;
+  }
 
 #if defined(GD_IDE_ONLY)
+  /**
+   * \brief Make this external layout a copy of \a other, sharing its
+   * instances until they are modified (i.e: accessed with the non const
+   * getter).
+   *
+   * \warning \a other must not be modified or destroyed while this external
+   * layout is used.
+   *
+   * \see gd::Layout::InitAsSnapshotOf
+   */
+  void InitAsSnapshotOf(const ExternalLayout& other);
+
   /**
    * \brief Get the user settings for the IDE.
    */
@@ -92,17 +127,70 @@ class GD_CORE_API ExternalLayout {
 
   /**
    * \brief Unserialize the external layout.
+   *
+   * \param lazyLoading If true, the instances are only unserialized when
+   * accessed for the first time. Until then, their element is kept (shared
+   * with \a element, or copied if \a element was allocated from an arena), so
+   * it must not be modified.
    */
-  void UnserializeFrom(const SerializerElement& element);
+  void UnserializeFrom(const SerializerElement& element,
+                       bool lazyLoading = false);
+
+  /**
+   * \brief Return false if the external layout was lazily unserialized and
+   * its instances were not unserialized yet.
+   */
+  bool IsFullyLoaded() const { return !hasLazyContent; }
   ///@}
 
  private:
+  /**
+   * \brief Unserialize the instances, if the external layout was lazily
+   * unserialized and they were not unserialized yet.
+   *
+   * This is called by const accessors: several threads can call it at the
+   * same time, only the first one unserializes the instances.
+   */
+  void LoadLazyContent() const {
+    if (!hasLazyContent) return;
+
+    std::lock_guard<std::mutex> lock(lazyContentMutex);
+    if (hasLazyContent)
+      const_cast<ExternalLayout*>(this)->UnserializeLazyContent();
+  }
+
+  void UnserializeLazyContent();
+
+#if defined(GD_IDE_ONLY)
+  void CopySharedInstances();
+#endif
+
+  /**
+   * Initialize from another external layout, sharing its instances if
+   * \a shareInstances is true (only in IDE builds). Used by copy-ctor,
+   * assign-op and InitAsSnapshotOf.
+   */
+  void Init(const ExternalLayout& other, bool shareInstances = false);
+
   gd::String name;
   gd::InitialInstancesContainer instances;
 #if defined(GD_IDE_ONLY)
   gd::LayoutEditorCanvasOptions editionSettings;
 #endif
   gd::String associatedLayout;
+
+  std::atomic<bool> hasLazyContent;  ///< True if the instances are still to
+                                     ///< be unserialized from
+                                     ///< lazyInstancesElement.
+  mutable std::mutex lazyContentMutex;  ///< Protects the unserialization of
+                                        ///< the instances.
+  std::shared_ptr<const SerializerElement> lazyInstancesElement;
+#if defined(GD_IDE_ONLY)
+  const gd::InitialInstancesContainer*
+      sharedInstances;  ///< If not null, the instances of the external layout
+                        ///< this external layout is a snapshot of, used until
+                        ///< they are modified.
+#endif
 };
 
 /**
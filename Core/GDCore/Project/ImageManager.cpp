@@ -84,6 +84,15 @@ void ImageManager::SetSFMLTextureAsPermanentlyLoaded(
     permanentlyLoadedImages[name] = texture;
 }
 
+void ImageManager::SetSFMLTextureAsLoaded(
+    const gd::String& name,
+    std::shared_ptr<SFMLTextureWrapper>& texture) const {
+  alreadyLoadedImages[name] = texture;
+#if defined(GD_IDE_ONLY)
+  if (preventUnloading) unloadingPreventer.push_back(texture);
+#endif
+}
+
 void ImageManager::ReloadImage(const gd::String& name) const {
   if (!resourcesManager) {
     std::cout << "ImageManager has no ResourcesManager associated with.";
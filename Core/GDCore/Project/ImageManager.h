@@ -93,6 +93,18 @@ class GD_CORE_API ImageManager {
       const gd::String& name,
       std::shared_ptr<SFMLTextureWrapper>& texture) const;
 
+  /**
+   * \brief Add the SFMLTextureWrapper to loaded images ( so that it can be
+   * accessed thanks to ImageManager::GetSFMLTexture ) with the specified name.
+   *
+   * Used for textures loaded elsewhere (for example, images decoded in the
+   * background when a layout is preloaded). Like the other textures, it is
+   * unloaded when no shared pointer points to it anymore.
+   */
+  void SetSFMLTextureAsLoaded(
+      const gd::String& name,
+      std::shared_ptr<SFMLTextureWrapper>& texture) const;
+
   /**
    * \brief Reload a single image from the game resources
    */
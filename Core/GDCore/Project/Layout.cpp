@@ -54,6 +54,14 @@ Layout::Layout()
 #if defined(GD_IDE_ONLY)
       ,
       profiler(NULL)
+#endif
+      ,
+      hasLazyContent(false),
+      lazyProject(nullptr)
+#if defined(GD_IDE_ONLY)
+      ,
+      sharedInitialInstances(nullptr),
+      sharedEvents(nullptr)
 #endif
 {
   gd::Layer layer;
@@ -270,7 +278,7 @@ void Layout::SerializeTo(SerializerElement& element) const {
   GetVariables().SerializeTo(element.AddChild("variables"));
   GetInitialInstances().SerializeTo(element.AddChild("instances"));
   SerializeObjectsTo(element.AddChild("objects"));
-  gd::EventsListSerialization::SerializeEventsTo(events,
+  gd::EventsListSerialization::SerializeEventsTo(GetEvents(),
                                                  element.AddChild("events"));
 
   SerializeLayersTo(element.AddChild("layers"));
@@ -309,7 +317,17 @@ void Layout::UnserializeLayersFrom(const SerializerElement& element) {
 }
 
 void Layout::UnserializeFrom(gd::Project& project,
-                             const SerializerElement& element) {
+                             const SerializerElement& element,
+                             bool lazyLoading) {
+  hasLazyContent = false;
+  lazyProject = nullptr;
+  lazyEventsElement.reset();
+  lazyInstancesElement.reset();
+#if defined(GD_IDE_ONLY)
+  sharedInitialInstances = nullptr;
+  sharedEvents = nullptr;
+#endif
+
   SetBackgroundColor(element.GetIntAttribute("r"),
                      element.GetIntAttribute("v"),
                      element.GetIntAttribute("b"));
@@ -329,13 +347,28 @@ void Layout::UnserializeFrom(gd::Project& project,
 
   GetObjectGroups().UnserializeFrom(
       element.GetChild("objectsGroups", 0, "GroupesObjets"));
-  gd::EventsListSerialization::UnserializeEventsFrom(
-      project, GetEvents(), element.GetChild("events", 0, "Events"));
 #endif
 
+  // The events and the instances are the biggest part of layouts: when
+  // lazily loading, keep their elements to unserialize them only if used.
+  if (lazyLoading) {
+#if defined(GD_IDE_ONLY)
+    lazyEventsElement = element.GetSharedChildOutsideArena("events", "Events");
+#endif
+    lazyInstancesElement = element.GetSharedChildOutsideArena("instances", "Positions");
+    lazyProject = &project;
+    hasLazyContent = lazyEventsElement || lazyInstancesElement;
+  }
+#if defined(GD_IDE_ONLY)
+  if (!lazyEventsElement)
+    gd::EventsListSerialization::UnserializeEventsFrom(
+        project, events, element.GetChild("events", 0, "Events"));
+#endif
+  if (!lazyInstancesElement)
+    initialInstances.UnserializeFrom(
+        element.GetChild("instances", 0, "Positions"));
+
   UnserializeObjectsFrom(project, element.GetChild("objects", 0, "Objets"));
-  initialInstances.UnserializeFrom(
-      element.GetChild("instances", 0, "Positions"));
   variables.UnserializeFrom(element.GetChild("variables", 0, "Variables"));
 
   UnserializeLayersFrom(element.GetChild("layers", 0, "Layers"));
@@ -377,7 +410,66 @@ void Layout::UnserializeFrom(gd::Project& project,
   }
 }
 
+void Layout::UnserializeLazyContent() {
+#if defined(GD_IDE_ONLY)
+  if (lazyEventsElement)
+    gd::EventsListSerialization::UnserializeEventsFrom(
+        *lazyProject, events, *lazyEventsElement);
+#endif
+  if (lazyInstancesElement)
+    initialInstances.UnserializeFrom(*lazyInstancesElement);
+
+  lazyProject = nullptr;
+  lazyEventsElement.reset();
+  lazyInstancesElement.reset();
+  hasLazyContent = false;  // Last, as other threads can read the content then.
+}
+
 void Layout::Init(const Layout& other) {
+  InitWithoutContent(other);
+  initialInstances = other.GetInitialInstances();
+#if defined(GD_IDE_ONLY)
+  sharedInitialInstances = nullptr;
+  sharedEvents = nullptr;
+  events = other.GetEvents();
+#endif
+}
+
+#if defined(GD_IDE_ONLY)
+void Layout::InitAsSnapshotOf(const Layout& other) {
+  InitWithoutContent(other);
+  initialInstances.Clear();
+  sharedInitialInstances = &other.GetInitialInstances();
+  events.Clear();
+  sharedEvents = &other.GetEvents();
+}
+
+void Layout::CopySharedInitialInstances() {
+  initialInstances = *sharedInitialInstances;
+  sharedInitialInstances = nullptr;
+}
+
+void Layout::CopySharedEvents() {
+  events = *sharedEvents;
+  sharedEvents = nullptr;
+}
+
+void Layout::ClearEvents() {
+  // Lazily unserialized events are dropped without being unserialized.
+  lazyEventsElement.reset();
+  hasLazyContent = lazyInstancesElement != nullptr;
+  sharedEvents = nullptr;
+  events.Clear();
+}
+#endif
+
+void Layout::InitWithoutContent(const Layout& other) {
+  other.LoadLazyContent();
+  hasLazyContent = false;
+  lazyProject = nullptr;
+  lazyEventsElement.reset();
+  lazyInstancesElement.reset();
+
   SetName(other.name);
   backgroundColorR = other.backgroundColorR;
   backgroundColorG = other.backgroundColorG;
@@ -389,7 +481,6 @@ void Layout::Init(const Layout& other) {
   oglZFar = other.oglZFar;
   stopSoundsOnStartup = other.stopSoundsOnStartup;
   disableInputWhenNotFocused = other.disableInputWhenNotFocused;
-  initialInstances = other.initialInstances;
   initialLayers = other.initialLayers;
   variables = other.GetVariables();
 
@@ -402,7 +493,6 @@ void Layout::Init(const Layout& other) {
   }
 
 #if defined(GD_IDE_ONLY)
-  events = other.events;
   associatedSettings = other.associatedSettings;
   objectGroups = other.objectGroups;
 
@@ -6,8 +6,10 @@
 
 #ifndef GDCORE_LAYOUT_H
 #define GDCORE_LAYOUT_H
+#include <atomic>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <vector>
 #include "GDCore/Events/EventsList.h"
 #include "GDCore/Project/BehaviorsSharedData.h"
@@ -115,6 +117,10 @@ class GD_CORE_API Layout : public ObjectsContainer {
    * Return the container storing initial instances.
    */
   const gd::InitialInstancesContainer& GetInitialInstances() const {
+    LoadLazyContent();
+#if defined(GD_IDE_ONLY)
+    if (sharedInitialInstances) return *sharedInitialInstances;
+#endif
     return initialInstances;
   }
 
@@ -122,6 +128,10 @@ class GD_CORE_API Layout : public ObjectsContainer {
    * Return the container storing initial instances.
    */
   gd::InitialInstancesContainer& GetInitialInstances() {
+    LoadLazyContent();
+#if defined(GD_IDE_ONLY)
+    if (sharedInitialInstances) CopySharedInitialInstances();
+#endif
     return initialInstances;
   }
   ///@}
@@ -135,12 +145,35 @@ class GD_CORE_API Layout : public ObjectsContainer {
   /**
    * Get the events of the layout
    */
-  const gd::EventsList& GetEvents() const { return events; }
+  const gd::EventsList& GetEvents() const {
+    LoadLazyContent();
+    return sharedEvents ? *sharedEvents : events;
+  }
 
   /**
    * Get the events of the layout
    */
-  gd::EventsList& GetEvents() { return events; }
+  gd::EventsList& GetEvents() {
+    LoadLazyContent();
+    if (sharedEvents) CopySharedEvents();
+    return events;
+  }
+
+  /**
+   * \brief Remove all the events of the layout.
+   *
+   * Unlike `GetEvents().Clear()`, the events are not unserialized or copied
+   * first if they were lazily unserialized or are shared with another layout.
+   */
+  void ClearEvents();
+
+  /**
+   * \brief Return true if the events are still shared with the layout this
+   * layout is a snapshot of.
+   *
+   * \see gd::Layout::InitAsSnapshotOf
+   */
+  bool HasSharedEvents() const { return sharedEvents != nullptr; }
 #endif
   ///@}
 
@@ -390,10 +423,41 @@ class GD_CORE_API Layout : public ObjectsContainer {
 
   /**
    * \brief Unserialize the layout.
+   *
+   * \param lazyLoading If true, the events and the instances are only
+   * unserialized when accessed for the first time. Until then, their elements
+   * are kept (shared with \a element, or copied if \a element was allocated
+   * from an arena), so they must not be modified.
    */
-  void UnserializeFrom(gd::Project& project, const SerializerElement& element);
+  void UnserializeFrom(gd::Project& project,
+                       const SerializerElement& element,
+                       bool lazyLoading = false);
+
+  /**
+   * \brief Return false if the layout was lazily unserialized and its events
+   * and instances were not unserialized yet.
+   *
+   * \see gd::Layout::UnserializeFrom
+   */
+  bool IsFullyLoaded() const { return !hasLazyContent; }
 ///@}
 
+#if defined(GD_IDE_ONLY)
+  /**
+   * \brief Make this layout a copy of \a other, sharing its events and its
+   * initial instances instead of copying them.
+   *
+   * The events and the instances are only copied the first time they are
+   * accessed to be modified (i.e: with the non const getters). This is useful
+   * to modify a copy of a layout without paying the cost of copying the
+   * events and instances if they are not modified (e.g: during an export).
+   *
+   * \warning \a other must not be modified or destroyed while this layout
+   * is used.
+   */
+  void InitAsSnapshotOf(const gd::Layout& other);
+#endif
+
 // TODO: GD C++ Platform specific code below
 #if defined(GD_IDE_ONLY)
   /**
@@ -444,11 +508,55 @@ class GD_CORE_API Layout : public ObjectsContainer {
   BaseProfiler* profiler;  ///< Pointer to the profiler. Can be NULL.
 #endif
 
+  /**
+   * \brief Unserialize the events and the instances, if the layout was lazily
+   * unserialized and they were not unserialized yet.
+   *
+   * This is called by const accessors: several threads can call it at the
+   * same time, only the first one unserializes the content.
+   */
+  void LoadLazyContent() const {
+    if (!hasLazyContent) return;
+
+    std::lock_guard<std::mutex> lock(lazyContentMutex);
+    if (hasLazyContent) const_cast<Layout*>(this)->UnserializeLazyContent();
+  }
+
+  void UnserializeLazyContent();
+
+  std::atomic<bool> hasLazyContent;  ///< True if the events and the instances
+                                     ///< are still to be unserialized from
+                                     ///< the elements below.
+  mutable std::mutex lazyContentMutex;  ///< Protects the unserialization of
+                                        ///< the lazy content.
+  gd::Project* lazyProject;
+  std::shared_ptr<const SerializerElement> lazyEventsElement;
+  std::shared_ptr<const SerializerElement> lazyInstancesElement;
+
+#if defined(GD_IDE_ONLY)
+  void CopySharedInitialInstances();
+  void CopySharedEvents();
+
+  const gd::InitialInstancesContainer*
+      sharedInitialInstances;  ///< If not null, the initial instances of the
+                               ///< layout this layout is a snapshot of, used
+                               ///< until they are modified.
+  const gd::EventsList* sharedEvents;  ///< If not null, the events of the
+                                       ///< layout this layout is a snapshot
+                                       ///< of, used until they are modified.
+#endif
+
   /**
    * Initialize from another layout. Used by copy-ctor and assign-op.
    * Don't forget to update me if members were changed!
    */
   void Init(const gd::Layout& other);
+
+  /**
+   * Initialize from another layout, except for the events and the initial
+   * instances. Used by Init and InitAsSnapshotOf.
+   */
+  void InitWithoutContent(const gd::Layout& other);
 };
 
 /**
@@ -55,6 +55,7 @@ const ObjectGroup& ObjectGroupsContainer::Get(const gd::String& name) const {
 
 ObjectGroup& ObjectGroupsContainer::Insert(const gd::ObjectGroup& group,
                                            std::size_t position) {
+  version.Change();
   if (position < objectGroups.size()) {
     objectGroups.insert(objectGroups.begin() + position, group);
     return objectGroups[position];
@@ -66,6 +67,7 @@ ObjectGroup& ObjectGroupsContainer::Insert(const gd::ObjectGroup& group,
 
 #if defined(GD_IDE_ONLY)
 void ObjectGroupsContainer::Remove(const gd::String& name) {
+  version.Change();
   objectGroups.erase(std::remove_if(objectGroups.begin(),
                                     objectGroups.end(),
                                     [&name](const ObjectGroup& group) {
@@ -100,6 +102,7 @@ bool ObjectGroupsContainer::Rename(const gd::String& oldName,
                         });
   if (i != objectGroups.end()) i->SetName(newName);
 
+  version.Change();
   return true;
 }
 
@@ -122,6 +125,7 @@ void ObjectGroupsContainer::SerializeTo(SerializerElement& element) const {
 }
 
 void ObjectGroupsContainer::UnserializeFrom(const SerializerElement& element) {
+  version.Change();
   objectGroups.clear();
   element.ConsiderAsArrayOf("group", "Groupe");
   for (std::size_t i = 0; i < element.GetChildrenCount(); ++i) {
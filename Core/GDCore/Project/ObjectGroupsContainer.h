@@ -9,6 +9,7 @@
 #include <vector>
 #include "GDCore/Project/ObjectGroup.h"
 #include "GDCore/String.h"
+#include "GDCore/Tools/UniqueVersion.h"
 namespace gd {
 class SerializerElement;
 }
@@ -112,7 +113,20 @@ class GD_CORE_API ObjectGroupsContainer {
   /**
    * \brief Clear all groups of the container.
    */
-  inline void Clear() { objectGroups.clear(); }
+  inline void Clear() {
+    objectGroups.clear();
+    version.Change();
+  }
+
+  /**
+   * \brief Return a version number, changed when groups are added, removed
+   * or renamed using the container.
+   *
+   * \note Changes made directly on a group (like adding an object to it) are
+   * not tracked.
+   * \see gd::UniqueVersion
+   */
+  std::size_t GetVersion() const { return version.Get(); }
   ///@}
 
   /** \name Saving and loading
@@ -174,6 +188,7 @@ class GD_CORE_API ObjectGroupsContainer {
 
  private:
   std::vector<ObjectGroup> objectGroups;
+  gd::UniqueVersion version;
   static ObjectGroup badGroup;
 };
 
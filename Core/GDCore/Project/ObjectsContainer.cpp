@@ -27,6 +27,7 @@ void ObjectsContainer::SerializeObjectsTo(SerializerElement& element) const {
 
 void ObjectsContainer::UnserializeObjectsFrom(
     gd::Project& project, const SerializerElement& element) {
+  objectsVersion.Change();
   initialObjects.clear();
   element.ConsiderAsArrayOf("object", "Objet");
   for (std::size_t i = 0; i < element.GetChildrenCount(); ++i) {
@@ -80,6 +81,7 @@ gd::Object& ObjectsContainer::InsertNewObject(gd::Project& project,
                                               const gd::String& objectType,
                                               const gd::String& name,
                                               std::size_t position) {
+  objectsVersion.Change();
   gd::Object& newlyCreatedObject = *(*(initialObjects.insert(
       position < initialObjects.size() ? initialObjects.begin() + position
                                        : initialObjects.end(),
@@ -91,6 +93,7 @@ gd::Object& ObjectsContainer::InsertNewObject(gd::Project& project,
 
 gd::Object& ObjectsContainer::InsertObject(const gd::Object& object,
                                            std::size_t position) {
+  objectsVersion.Change();
   gd::Object& newlyCreatedObject = *(*(initialObjects.insert(
       position < initialObjects.size() ? initialObjects.begin() + position
                                        : initialObjects.end(),
@@ -125,6 +128,7 @@ void ObjectsContainer::RemoveObject(const gd::String& name) {
               bind2nd(ObjectHasName(), name));
   if (objectIt == initialObjects.end()) return;
 
+  objectsVersion.Change();
   initialObjects.erase(objectIt);
 }
 
@@ -140,6 +144,8 @@ void ObjectsContainer::MoveObjectToAnotherContainer(
 
   std::unique_ptr<gd::Object> object = std::move(*objectIt);
   initialObjects.erase(objectIt);
+  objectsVersion.Change();
+  newContainer.objectsVersion.Change();
 
   newContainer.initialObjects.insert(
       newPosition < newContainer.initialObjects.size()
@@ -5,10 +5,12 @@
  */
 #ifndef GDCORE_OBJECTSCONTAINER_H
 #define GDCORE_OBJECTSCONTAINER_H
+#include <algorithm>
 #include <memory>
 #include <vector>
 #include "GDCore/String.h"
 #include "GDCore/Project/ObjectGroupsContainer.h"
+#include "GDCore/Tools/UniqueVersion.h"
 namespace gd {
 class Object;
 class Project;
@@ -188,12 +190,25 @@ class GD_CORE_API ObjectsContainer {
   const ObjectGroupsContainer& GetObjectGroups() const { return objectGroups; }
 #endif
 
+  /**
+   * \brief Return a version number, changed when objects or groups are
+   * added, removed or renamed using the container.
+   *
+   * \note Changes made directly on objects (like renaming them), on groups or
+   * on the vector returned by GetObjects are not tracked.
+   * \see gd::UniqueVersion
+   */
+  std::size_t GetVersion() const {
+    return std::max(objectsVersion.Get(), objectGroups.GetVersion());
+  }
+
   ///@}
 
  protected:
   std::vector<std::unique_ptr<gd::Object> >
       initialObjects;  ///< Objects contained.
   gd::ObjectGroupsContainer objectGroups;
+  gd::UniqueVersion objectsVersion;
 };
 
 }  // namespace gd
@@ -10,8 +10,10 @@
 #include <stdlib.h>
 
 #include <SFML/System/Utf.hpp>
+#include <algorithm>
 #include <cctype>
 #include <fstream>
+#include <iterator>
 #include <map>
 #include <vector>
 
@@ -33,6 +35,7 @@
 #include "GDCore/Project/SourceFile.h"
 #include "GDCore/Serialization/Serializer.h"
 #include "GDCore/Serialization/SerializerElement.h"
+#include "GDCore/Serialization/SerializerElementArena.h"
 #include "GDCore/String.h"
 #include "GDCore/TinyXml/tinyxml.h"
 #include "GDCore/Tools/Localization.h"
@@ -238,6 +241,15 @@ std::size_t Project::GetLayoutPosition(const gd::String& name) const {
 }
 std::size_t Project::GetLayoutsCount() const { return scenes.size(); }
 
+std::size_t Project::GetFullyLoadedLayoutsCount() const {
+  return std::count_if(
+      scenes.begin(),
+      scenes.end(),
+      [](const std::unique_ptr<gd::Layout>& layout) {
+        return layout->IsFullyLoaded();
+      });
+}
+
 #if defined(GD_IDE_ONLY)
 void Project::SwapLayouts(std::size_t first, std::size_t second) {
   if (first >= scenes.size() || second >= scenes.size()) return;
@@ -315,6 +327,15 @@ std::size_t Project::GetExternalEventsCount() const {
   return externalEvents.size();
 }
 
+std::size_t Project::GetFullyLoadedExternalEventsCount() const {
+  return std::count_if(
+      externalEvents.begin(),
+      externalEvents.end(),
+      [](const std::unique_ptr<gd::ExternalEvents>& externalEvents) {
+        return externalEvents->IsFullyLoaded();
+      });
+}
+
 gd::ExternalEvents& Project::InsertNewExternalEvents(const gd::String& name,
                                                      std::size_t position) {
   gd::ExternalEvents& newlyInsertedExternalEvents = *(*(externalEvents.emplace(
@@ -396,6 +417,15 @@ std::size_t Project::GetExternalLayoutsCount() const {
   return externalLayouts.size();
 }
 
+std::size_t Project::GetFullyLoadedExternalLayoutsCount() const {
+  return std::count_if(
+      externalLayouts.begin(),
+      externalLayouts.end(),
+      [](const std::unique_ptr<gd::ExternalLayout>& externalLayout) {
+        return externalLayout->IsFullyLoaded();
+      });
+}
+
 gd::ExternalLayout& Project::InsertNewExternalLayout(const gd::String& name,
                                                      std::size_t position) {
   gd::ExternalLayout& newlyInsertedExternalLayout = *(*(externalLayouts.emplace(
@@ -528,7 +558,8 @@ void Project::ClearEventsFunctionsExtensions() {
 }
 #endif
 
-void Project::UnserializeFrom(const SerializerElement& element) {
+void Project::UnserializeFrom(const SerializerElement& element,
+                              bool lazyLoading) {
 // Checking version
 #if defined(GD_IDE_ONLY)
   gd::String updateText;
@@ -794,7 +825,7 @@ void Project::UnserializeFrom(const SerializerElement& element) {
 
     gd::Layout& layout = InsertNewLayout(
         layoutElement.GetStringAttribute("name", "", "nom"), -1);
-    layout.UnserializeFrom(*this, layoutElement);
+    layout.UnserializeFrom(*this, layoutElement, lazyLoading);
   }
 
 #if defined(GD_IDE_ONLY)
@@ -809,7 +840,7 @@ void Project::UnserializeFrom(const SerializerElement& element) {
     gd::ExternalEvents& externalEvents = InsertNewExternalEvents(
         externalEventElement.GetStringAttribute("name", "", "Name"),
         GetExternalEventsCount());
-    externalEvents.UnserializeFrom(*this, externalEventElement);
+    externalEvents.UnserializeFrom(*this, externalEventElement, lazyLoading);
   }
 
   eventsFunctionsExtensions.clear();
@@ -841,7 +872,7 @@ void Project::UnserializeFrom(const SerializerElement& element) {
 
     gd::ExternalLayout& newExternalLayout =
         InsertNewExternalLayout("", GetExternalLayoutsCount());
-    newExternalLayout.UnserializeFrom(externalLayoutElement);
+    newExternalLayout.UnserializeFrom(externalLayoutElement, lazyLoading);
   }
 
 #if defined(GD_IDE_ONLY)
@@ -860,7 +891,47 @@ void Project::UnserializeFrom(const SerializerElement& element) {
 #endif
 }
 
+bool Project::LoadFromFile(const gd::String& filename, bool lazyLoading) {
+  std::ifstream file(filename.ToLocale().c_str(), std::ios_base::binary);
+  if (!file.is_open()) return false;
+
+  std::string content((std::istreambuf_iterator<char>(file)),
+                      std::istreambuf_iterator<char>());
+  if (file.bad()) return false;
+
+  // The elements are only needed while unserializing, so use an arena -
+  // unless lazily loading, as the elements of the events and instances are
+  // kept until they are used (they would be copied out of the arena).
+  bool parsed = false;
+  SerializerElement rootElement =
+      gd::Serializer::IsBinary(content.data(), content.size())
+          ? gd::Serializer::FromBinary(content, !lazyLoading, &parsed)
+          : gd::Serializer::FromJSON(content, !lazyLoading, &parsed);
+  if (!parsed) return false;
+
+  UnserializeFrom(rootElement, lazyLoading);
+#if defined(GD_IDE_ONLY)
+  SetProjectFile(filename);
+#endif
+
+  return true;
+}
+
 #if defined(GD_IDE_ONLY)
+bool Project::SaveToFile(const gd::String& filename, bool binary) const {
+  std::ofstream file(filename.ToLocale().c_str(), std::ios_base::binary);
+  if (!file.is_open()) return false;
+
+  SerializerElement rootElement(std::make_shared<gd::SerializerElementArena>());
+  SerializeTo(rootElement);
+  if (binary)
+    gd::Serializer::ToBinary(rootElement, file);
+  else
+    gd::Serializer::ToJSON(rootElement, file);
+
+  return file.good();
+}
+
 void Project::SerializeTo(SerializerElement& element) const {
   SerializerElement& versionElement = element.AddChild("gdVersion");
   versionElement.SetAttribute("major", gd::VersionWrapper::Major());
@@ -976,6 +1047,25 @@ bool Project::ValidateName(const gd::String& name) {
   return !(name.find_first_not_of(allowedCharacters) != gd::String::npos);
 }
 
+namespace {
+/**
+ * Launch the worker on the events of a layout or external events. If they are
+ * shared with another project (see gd::Project::InitAsSnapshotOf), they are
+ * only copied if the worker changes one of their resources.
+ */
+template <class T>
+void ExposeEventsResources(const gd::Project& project,
+                           T& eventsOwner,
+                           gd::ArbitraryResourceWorker& worker) {
+  if (eventsOwner.HasSharedEvents() &&
+      !LaunchResourceWorkerOnSharedEvents(
+          project, static_cast<const T&>(eventsOwner).GetEvents(), worker))
+    return;
+
+  LaunchResourceWorkerOnEvents(project, eventsOwner.GetEvents(), worker);
+}
+}  // namespace
+
 void Project::ExposeResources(gd::ArbitraryResourceWorker& worker) {
   // See also gd::WholeProjectRefactorer::ExposeProjectEvents for a method that
   // traverse the whole project (this time for events) and ExposeProjectEffects
@@ -992,12 +1082,11 @@ void Project::ExposeResources(gd::ArbitraryResourceWorker& worker) {
          ++j)  // Add objects resources
       GetLayout(s).GetObject(j).ExposeResources(worker);
 
-    LaunchResourceWorkerOnEvents(*this, GetLayout(s).GetEvents(), worker);
+    ExposeEventsResources(*this, GetLayout(s), worker);
   }
   // Add external events resources
   for (std::size_t s = 0; s < GetExternalEventsCount(); s++) {
-    LaunchResourceWorkerOnEvents(
-        *this, GetExternalEvents(s).GetEvents(), worker);
+    ExposeEventsResources(*this, GetExternalEvents(s), worker);
   }
   // Add events functions extensions resources
   for (std::size_t e = 0; e < GetEventsFunctionsExtensionsCount(); e++) {
@@ -1071,7 +1160,13 @@ Project& Project::operator=(const Project& other) {
   return *this;
 }
 
-void Project::Init(const gd::Project& game) {
+#if defined(GD_IDE_ONLY)
+void Project::InitAsSnapshotOf(const gd::Project& project) {
+  if (this != &project) Init(project, true);
+}
+#endif
+
+void Project::Init(const gd::Project& game, bool snapshot) {
   // Some properties
   name = game.name;
   version = game.version;
@@ -1112,19 +1207,39 @@ void Project::Init(const gd::Project& game) {
 
   initialObjects = gd::Clone(game.initialObjects);
 
-  scenes = gd::Clone(game.scenes);
-
 #if defined(GD_IDE_ONLY)
-  externalEvents = gd::Clone(game.externalEvents);
-#endif
+  if (snapshot) {
+    scenes.clear();
+    for (const auto& layout : game.scenes) {
+      scenes.push_back(std::unique_ptr<gd::Layout>(new gd::Layout));
+      scenes.back()->InitAsSnapshotOf(*layout);
+    }
+    externalEvents.clear();
+    for (const auto& events : game.externalEvents) {
+      externalEvents.push_back(
+          std::unique_ptr<gd::ExternalEvents>(new gd::ExternalEvents));
+      externalEvents.back()->InitAsSnapshotOf(*events);
+    }
+    externalLayouts.clear();
+    for (const auto& layout : game.externalLayouts) {
+      externalLayouts.push_back(
+          std::unique_ptr<gd::ExternalLayout>(new gd::ExternalLayout));
+      externalLayouts.back()->InitAsSnapshotOf(*layout);
+    }
+  } else {
+    scenes = gd::Clone(game.scenes);
+    externalEvents = gd::Clone(game.externalEvents);
+    externalLayouts = gd::Clone(game.externalLayouts);
+  }
 
-  externalLayouts = gd::Clone(game.externalLayouts);
-#if defined(GD_IDE_ONLY)
   eventsFunctionsExtensions = gd::Clone(game.eventsFunctionsExtensions);
 
   useExternalSourceFiles = game.useExternalSourceFiles;
 
   externalSourceFiles = gd::Clone(game.externalSourceFiles);
+#else
+  scenes = gd::Clone(game.scenes);
+  externalLayouts = gd::Clone(game.externalLayouts);
 #endif
 
   variables = game.GetVariables();
@@ -51,6 +51,23 @@ class GD_CORE_API Project : public ObjectsContainer {
   virtual ~Project();
   Project& operator=(const Project& rhs);
 
+#if defined(GD_IDE_ONLY)
+  /**
+   * \brief Make this project a copy of \a project, except for the events
+   * and the instances of its layouts, external events and external layouts,
+   * which are shared with \a project until they are modified.
+   *
+   * This avoids copying the biggest parts of a project when a modified copy
+   * is only needed for a short time, like during an export.
+   *
+   * \warning \a project must not be modified or destroyed while this project
+   * is used.
+   *
+   * \see gd::Layout::InitAsSnapshotOf
+   */
+  void InitAsSnapshotOf(const gd::Project& project);
+#endif
+
   /** \name Common properties
    * Some properties for the project
    */
@@ -496,8 +513,51 @@ class GD_CORE_API Project : public ObjectsContainer {
 
   /**
    * \brief Unserialize the project from an element.
+   *
+   * \param lazyLoading If true, the events and the instances of layouts,
+   * external events and external layouts are only unserialized when accessed
+   * for the first time, which is much faster when only a few of them are
+   * used. Parts of \a element are kept by the project until then, so they
+   * must not be modified.
+   */
+  void UnserializeFrom(const SerializerElement& element,
+                       bool lazyLoading = false);
+
+  /**
+   * \brief Load the project from a file, containing the project serialized
+   * either in JSON or in the binary format (see gd::Serializer::ToBinary).
+   *
+   * \param lazyLoading See gd::Project::UnserializeFrom.
+   * \return true if the file could be read and parsed. If false, the project
+   * is left unchanged.
    */
-  void UnserializeFrom(const SerializerElement& element);
+  bool LoadFromFile(const gd::String& filename, bool lazyLoading = false);
+
+  /**
+   * \brief Return the number of layouts that are fully unserialized, i.e:
+   * all of them, except the ones lazily loaded and not used yet.
+   *
+   * \see gd::Project::UnserializeFrom
+   */
+  std::size_t GetFullyLoadedLayoutsCount() const;
+
+#if defined(GD_IDE_ONLY)
+  /**
+   * \brief Return the number of external events that are fully
+   * unserialized.
+   *
+   * \see gd::Project::UnserializeFrom
+   */
+  std::size_t GetFullyLoadedExternalEventsCount() const;
+#endif
+
+  /**
+   * \brief Return the number of external layouts that are fully
+   * unserialized.
+   *
+   * \see gd::Project::UnserializeFrom
+   */
+  std::size_t GetFullyLoadedExternalLayoutsCount() const;
 
 #if defined(GD_IDE_ONLY)
   /**
@@ -507,6 +567,14 @@ class GD_CORE_API Project : public ObjectsContainer {
    */
   void SerializeTo(SerializerElement& element) const;
 
+  /**
+   * \brief Save the project to a file, in JSON or in the binary format (much
+   * faster to load for large projects).
+   *
+   * \return true if the file could be written.
+   */
+  bool SaveToFile(const gd::String& filename, bool binary = false) const;
+
   /**
    * \brief Return true if the project is marked as being modified (The IDE or
    * application using the project should ask to save the project if the project
@@ -931,10 +999,12 @@ class GD_CORE_API Project : public ObjectsContainer {
 
  private:
   /**
-   * Initialize from another game. Used by copy-ctor and assign-op.
+   * Initialize from another game, sharing the content of its layouts if
+   * \a snapshot is true (only in IDE builds). Used by copy-ctor, assign-op
+   * and InitAsSnapshotOf.
    * Don't forget to update me if members were changed!
    */
-  void Init(const gd::Project& project);
+  void Init(const gd::Project& project, bool snapshot = false);
 
   gd::String name;            ///< Game name
   gd::String version;         ///< Game version number (used for some exports)
@@ -54,11 +54,16 @@ std::pair<sf::Font *, StreamHolder *> ResourcesLoader::LoadFont(
 
 sf::SoundBuffer ResourcesLoader::LoadSoundBuffer(const gd::String &filename) {
   sf::SoundBuffer sbuffer;
+  LoadSoundBuffer(filename, sbuffer);
+
+  return sbuffer;
+}
+
+void ResourcesLoader::LoadSoundBuffer(const gd::String &filename,
+                                      sf::SoundBuffer &sbuffer) {
   gd::SFMLFileStream stream;
   if (!stream.open(filename) || !sbuffer.loadFromStream(stream))
     cout << "Failed to load a sound buffer: " << filename << endl;
-
-  return sbuffer;
 }
 
 gd::String ResourcesLoader::LoadPlainText(const gd::String &filename) {
@@ -62,6 +62,11 @@ class GD_CORE_API ResourcesLoader {
    */
   sf::SoundBuffer LoadSoundBuffer(const gd::String &filename);
 
+  /**
+   * Load a SFML Sound Buffer into \a buffer.
+   */
+  void LoadSoundBuffer(const gd::String &filename, sf::SoundBuffer &buffer);
+
   /**
    * Load a plain text file
    */
@@ -41,6 +41,7 @@ void ResourcesManager::Init(const ResourcesManager& other) {
   for (std::size_t i = 0; i < other.resources.size(); ++i) {
     resources.push_back(std::shared_ptr<Resource>(other.resources[i]->Clone()));
   }
+  textureAtlas = other.textureAtlas;
 #if defined(GD_IDE_ONLY)
   folders.clear();
   for (std::size_t i = 0; i < other.folders.size(); ++i) {
@@ -418,6 +419,10 @@ void ResourcesManager::UnserializeFrom(const SerializerElement& element) {
     resources.push_back(resource);
   }
 
+  textureAtlas.Clear();
+  if (element.HasChild("textureAtlas"))
+    textureAtlas.UnserializeFrom(element.GetChild("textureAtlas"));
+
 #if defined(GD_IDE_ONLY)
   folders.clear();
   const SerializerElement& resourcesFoldersElement =
@@ -447,6 +452,9 @@ void ResourcesManager::SerializeTo(SerializerElement& element) const {
     resources[i]->SerializeTo(resourceElement);
   }
 
+  if (!textureAtlas.IsEmpty())
+    textureAtlas.SerializeTo(element.AddChild("textureAtlas"));
+
   SerializerElement& resourcesFoldersElement =
       element.AddChild("resourceFolders");
   resourcesFoldersElement.ConsiderAsArrayOf("folder");
@@ -9,6 +9,7 @@
 #include <memory>
 #include <vector>
 
+#include "GDCore/Project/TextureAtlas.h"
 #include "GDCore/String.h"
 namespace gd {
 class Project;
@@ -374,6 +375,18 @@ class GD_CORE_API ResourcesManager {
    */
   std::vector<gd::String> GetAllResourceNames() const;
 
+  /**
+   * \brief Return the texture atlas, describing the pages where images are
+   * packed when the game is exported.
+   */
+  TextureAtlas& GetTextureAtlas() { return textureAtlas; }
+
+  /**
+   * \brief Return the texture atlas, describing the pages where images are
+   * packed when the game is exported.
+   */
+  const TextureAtlas& GetTextureAtlas() const { return textureAtlas; }
+
 #if defined(GD_IDE_ONLY)
   /**
    * \brief Return a (smart) pointer to a resource.
@@ -479,6 +492,7 @@ class GD_CORE_API ResourcesManager {
   void Init(const ResourcesManager& other);
 
   std::vector<std::shared_ptr<Resource> > resources;
+  TextureAtlas textureAtlas;  ///< Empty unless the images were packed.
 #if defined(GD_IDE_ONLY)
   std::vector<ResourceFolder> folders;
 #endif
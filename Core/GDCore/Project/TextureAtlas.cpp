@@ -0,0 +1,64 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Project/TextureAtlas.h"
+#include "GDCore/Serialization/SerializerElement.h"
+
+namespace gd {
+
+std::size_t TextureAtlas::AddPage(const gd::String& resourceName) {
+  pages.push_back(resourceName);
+  return pages.size() - 1;
+}
+
+void TextureAtlas::Clear() {
+  pages.clear();
+  regions.clear();
+}
+
+void TextureAtlas::SerializeTo(SerializerElement& element) const {
+  SerializerElement& pagesElement = element.AddChild("pages");
+  pagesElement.ConsiderAsArrayOf("page");
+  for (const gd::String& page : pages)
+    pagesElement.AddChild("page").SetAttribute("resourceName", page);
+
+  SerializerElement& regionsElement = element.AddChild("regions");
+  regionsElement.ConsiderAsArrayOf("region");
+  for (const auto& it : regions) {
+    SerializerElement& regionElement = regionsElement.AddChild("region");
+    regionElement.SetAttribute("image", it.first);
+    regionElement.SetAttribute("page", static_cast<int>(it.second.page));
+    regionElement.SetAttribute("x", static_cast<int>(it.second.x));
+    regionElement.SetAttribute("y", static_cast<int>(it.second.y));
+    regionElement.SetAttribute("width", static_cast<int>(it.second.width));
+    regionElement.SetAttribute("height", static_cast<int>(it.second.height));
+  }
+}
+
+void TextureAtlas::UnserializeFrom(const SerializerElement& element) {
+  Clear();
+
+  const SerializerElement& pagesElement = element.GetChild("pages");
+  pagesElement.ConsiderAsArrayOf("page");
+  for (std::size_t i = 0; i < pagesElement.GetChildrenCount(); ++i)
+    AddPage(pagesElement.GetChild(i).GetStringAttribute("resourceName"));
+
+  const SerializerElement& regionsElement = element.GetChild("regions");
+  regionsElement.ConsiderAsArrayOf("region");
+  for (std::size_t i = 0; i < regionsElement.GetChildrenCount(); ++i) {
+    const SerializerElement& regionElement = regionsElement.GetChild(i);
+    std::size_t page = regionElement.GetIntAttribute("page");
+    if (page >= pages.size()) continue;
+
+    SetRegion(regionElement.GetStringAttribute("image"),
+              Region(page,
+                     regionElement.GetIntAttribute("x"),
+                     regionElement.GetIntAttribute("y"),
+                     regionElement.GetIntAttribute("width"),
+                     regionElement.GetIntAttribute("height")));
+  }
+}
+
+}  // namespace gd
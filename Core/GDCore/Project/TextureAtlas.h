@@ -0,0 +1,128 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDCORE_TEXTUREATLAS_H
+#define GDCORE_TEXTUREATLAS_H
+#include <map>
+#include <vector>
+#include "GDCore/String.h"
+namespace gd {
+class SerializerElement;
+}
+
+namespace gd {
+
+/**
+ * \brief Describe where images are stored in the pages of texture atlases.
+ *
+ * Texture atlases are built when a game is exported (see
+ * gd::TextureAtlasPacker): the images of the sprites are packed into a few
+ * large images, the pages, which are image resources of the project. At
+ * runtime, the image manager uses the atlas to load the page containing an
+ * image, and the part of the page to display.
+ *
+ * \see gd::ResourcesManager::GetTextureAtlas
+ * \ingroup ResourcesManagement
+ */
+class GD_CORE_API TextureAtlas {
+ public:
+  /**
+   * \brief The part of a page where an image is stored.
+   */
+  struct Region {
+    Region() : page(0), x(0), y(0), width(0), height(0){};
+    Region(std::size_t page_,
+           unsigned int x_,
+           unsigned int y_,
+           unsigned int width_,
+           unsigned int height_)
+        : page(page_), x(x_), y(y_), width(width_), height(height_){};
+
+    std::size_t page;  ///< The index of the page.
+    unsigned int x;
+    unsigned int y;
+    unsigned int width;
+    unsigned int height;
+  };
+
+  TextureAtlas(){};
+  virtual ~TextureAtlas(){};
+
+  /**
+   * \brief Add a page, which is the image resource called \a resourceName.
+   * \return The index of the page.
+   */
+  std::size_t AddPage(const gd::String& resourceName);
+
+  /**
+   * \brief Return the number of pages.
+   */
+  std::size_t GetPagesCount() const { return pages.size(); }
+
+  /**
+   * \brief Return the name of the image resource of a page.
+   */
+  const gd::String& GetPage(std::size_t index) const { return pages[index]; }
+
+  /**
+   * \brief Set the region of a page where the image called \a imageName is
+   * stored.
+   */
+  void SetRegion(const gd::String& imageName, const Region& region) {
+    regions[imageName] = region;
+  }
+
+  /**
+   * \brief Return true if the image called \a imageName is stored in a page.
+   */
+  bool HasRegion(const gd::String& imageName) const {
+    return regions.find(imageName) != regions.end();
+  }
+
+  /**
+   * \brief Return the region where the image called \a imageName is stored.
+   * \warning Check that the image is in a page with HasRegion first.
+   */
+  const Region& GetRegion(const gd::String& imageName) const {
+    return regions.find(imageName)->second;
+  }
+
+  /**
+   * \brief Return the number of images stored in the pages.
+   */
+  std::size_t GetRegionsCount() const { return regions.size(); }
+
+  /**
+   * \brief Return true if there are no pages.
+   */
+  bool IsEmpty() const { return pages.empty(); }
+
+  /**
+   * \brief Remove all pages and regions.
+   */
+  void Clear();
+
+  /** \name Serialization
+   */
+  ///@{
+  /**
+   * \brief Serialize the atlas.
+   */
+  void SerializeTo(SerializerElement& element) const;
+
+  /**
+   * \brief Unserialize the atlas.
+   */
+  void UnserializeFrom(const SerializerElement& element);
+  ///@}
+
+ private:
+  std::vector<gd::String> pages;  ///< The image resources of the pages.
+  std::map<gd::String, Region> regions;  ///< The region of each image.
+};
+
+}  // namespace gd
+
+#endif  // GDCORE_TEXTUREATLAS_H
@@ -5,13 +5,19 @@
  */
 
 #include "GDCore/Serialization/Serializer.h"
-#include <iomanip>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 #include "GDCore/CommonTools.h"
 #include "GDCore/Serialization/SerializerElement.h"
+#include "GDCore/Serialization/SerializerElementArena.h"
 #if !defined(EMSCRIPTEN)
 #include "GDCore/TinyXml/tinyxml.h"
 #endif
@@ -106,215 +112,371 @@ gd::String Serializer::ToEscapedXMLString(const gd::String& str) {
 namespace {
 
 /**
- * Adapted from public domain library "jsoncpp"
- * (http://sourceforge.net/projects/jsoncpp/).
+ * \brief Write the JSON of a gd::SerializerElement in a single pass, by
+ * appending to a single buffer.
+ *
+ * If a stream is given, the buffer is flushed into it as soon as it is big
+ * enough, so that the whole JSON is never held in memory.
  */
-static inline bool isControlCharacter(char ch) { return ch > 0 && ch <= 0x1F; }
+class JSONWriter {
+ public:
+  JSONWriter(std::string& buffer_, std::ostream* stream_, bool compact_)
+      : buffer(buffer_), stream(stream_), compact(compact_){};
 
-/**
- * Adapted from public domain library "jsoncpp"
- * (http://sourceforge.net/projects/jsoncpp/).
- */
-static bool containsControlCharacter(const char* str) {
-  while (*str) {
-    if (isControlCharacter(*(str++))) return true;
+  void WriteElement(const SerializerElement& element);
+
+  /**
+   * \brief Write the content of the buffer into the stream, if any.
+   */
+  void Flush() {
+    if (!stream) return;
+
+    stream->write(buffer.data(), buffer.size());
+    buffer.clear();
+  }
+
+ private:
+  void WriteValue(const SerializerValue& value);
+  void WriteKey(const gd::String& key);
+  void WriteQuotedString(const std::string& str);
+  void WriteDouble(double value);
+
+  void FlushIfNeeded() {
+    if (stream && buffer.size() >= flushThreshold) Flush();
+  }
+
+  std::string& buffer;
+  std::ostream* stream;
+  bool compact;  ///< If true, no whitespace is written.
+
+  static const std::size_t flushThreshold = 64 * 1024;
+};
+
+void JSONWriter::WriteElement(const SerializerElement& element) {
+  if (!element.IsValueUndefined()) {
+    WriteValue(element.GetValue());
+    return;
+  }
+
+  const std::vector<
+      std::pair<gd::String, std::shared_ptr<SerializerElement> > >& children =
+      element.GetAllChildren();
+  const std::map<gd::String, SerializerValue>& attributes =
+      element.GetAllAttributes();
+  bool firstChild = true;
+
+  if (element.ConsideredAsArray()) {
+    // Store the element as an array in JSON:
+    if (attributes.size() > 0) {
+      std::cout << "ERROR: A SerializerElement is considered as an array of "
+                << (element.ConsideredAsArrayOf().empty()
+                        ? "[unnamed elements]"
+                        : element.ConsideredAsArrayOf())
+                << " but has attributes. These attributes won't be saved!"
+                << std::endl;
+    }
+
+    buffer += '[';
+    for (size_t i = 0; i < children.size(); ++i) {
+      if (children[i].second == std::shared_ptr<SerializerElement>()) continue;
+      if (children[i].first != element.ConsideredAsArrayOf()) {
+        std::cout << "ERROR: A SerializerElement is considered as an array of "
+                  << (element.ConsideredAsArrayOf().empty()
+                          ? "[unnamed elements]"
+                          : element.ConsideredAsArrayOf())
+                  << " but has a child called \"" << children[i].first
+                  << "\". This child won't be saved!" << std::endl;
+        continue;
+      }
+
+      if (!firstChild) buffer += ',';
+      WriteElement(*children[i].second);
+
+      firstChild = false;
+    }
+    buffer += ']';
+  } else {
+    buffer += '{';
+    for (std::map<gd::String, SerializerValue>::const_iterator it =
+             attributes.begin();
+         it != attributes.end();
+         ++it) {
+      if (!firstChild) buffer += ',';
+      WriteKey(it->first);
+      WriteValue(it->second);
+
+      firstChild = false;
+    }
+
+    for (size_t i = 0; i < children.size(); ++i) {
+      if (children[i].second == std::shared_ptr<SerializerElement>()) continue;
+
+      if (!attributes.empty() &&
+          attributes.find(children[i].first) != attributes.end()) {
+        std::cout << "ERROR: An attribute and a children called \""
+                  << children[i].first
+                  << "\" both exist. The children will erase the attribute - "
+                     "fix the usage of the attribute or (better) use "
+                     "children methods only."
+                  << std::endl;
+      }
+
+      if (!firstChild) buffer += ',';
+      WriteKey(children[i].first);
+      WriteElement(*children[i].second);
+
+      firstChild = false;
+    }
+    buffer += '}';
   }
-  return false;
+
+  FlushIfNeeded();
+}
+
+void JSONWriter::WriteValue(const SerializerValue& value) {
+  if (value.IsBoolean()) {
+    buffer += value.GetBool() ? "true" : "false";
+  } else if (value.IsInt()) {
+    char str[16];
+    int length = snprintf(str, sizeof(str), "%d", value.GetInt());
+    buffer.append(str, length);
+  } else if (value.IsDouble()) {
+    WriteDouble(value.GetDouble());
+  } else {
+    WriteQuotedString(value.GetString().Raw());
+  }
+}
+
+void JSONWriter::WriteKey(const gd::String& key) {
+  WriteQuotedString(key.Raw());
+  if (compact)
+    buffer += ':';
+  else
+    buffer += ": ";
 }
 
 /**
- * Tool function converting a string to a quoted string that can be inserted
- * into a JSON file. Adapted from public domain library "jsoncpp"
- * (http://sourceforge.net/projects/jsoncpp/).
+ * Write the string, quoted and with special characters escaped so that it can
+ * be inserted into a JSON file. Escaping adapted from public domain library
+ * "jsoncpp" (http://sourceforge.net/projects/jsoncpp/).
  */
-gd::String StringToQuotedJSONString(const char* value) {
-  if (value == NULL) return "";
-  // Not sure how to handle unicode...
-  if (strpbrk(value, "\"\\\b\f\n\r\t") == NULL &&
-      !containsControlCharacter(value))
-    return gd::String("\"") + value + "\"";
-  // We have to walk value and escape any special characters.
-  // Appending to std::string is not efficient, but this should be rare.
-  // (Note: forward slashes are *not* rare, but I am not escaping them.)
-  std::string::size_type maxsize =
-      strlen(value) * 2 + 3;  // allescaped+quotes+NULL
-  std::string result;
-  result.reserve(maxsize);  // to avoid lots of mallocs
-  result += "\"";
-  for (const char* c = value; *c != 0; ++c) {
-    switch (*c) {
-      case '\"':
-        result += "\\\"";
+void JSONWriter::WriteQuotedString(const std::string& str) {
+  static const char hexDigits[] = "0123456789ABCDEF";
+
+  buffer += '"';
+  const char* begin = str.data();
+  const char* end = str.data() + str.size();
+  for (const char* c = begin; c != end; ++c) {
+    unsigned char ch = static_cast<unsigned char>(*c);
+    if (ch >= 0x20 && ch != '"' && ch != '\\') continue;
+
+    // Copy the characters not needing to be escaped, then the escaped one.
+    buffer.append(begin, c);
+    begin = c + 1;
+    switch (ch) {
+      case '"':
+        buffer += "\\\"";
         break;
       case '\\':
-        result += "\\\\";
+        buffer += "\\\\";
         break;
       case '\b':
-        result += "\\b";
+        buffer += "\\b";
         break;
       case '\f':
-        result += "\\f";
+        buffer += "\\f";
         break;
       case '\n':
-        result += "\\n";
+        buffer += "\\n";
         break;
       case '\r':
-        result += "\\r";
+        buffer += "\\r";
         break;
       case '\t':
-        result += "\\t";
+        buffer += "\\t";
         break;
-      // case '/':
-      // Even though \/ is considered a legal escape in JSON, a bare
-      // slash is also legal, so I see no reason to escape it.
-      // (I hope I am not misunderstanding something.
-      // blep notes: actually escaping \/ may be useful in javascript to avoid
-      // </ sequence. Should add a flag to allow this compatibility mode and
-      // prevent this sequence from occurring.
+      // Forward slashes are legal in JSON and are not escaped.
       default:
-        if (isControlCharacter(*c)) {
-          std::ostringstream oss;
-          oss << "\\u" << std::hex << std::uppercase << std::setfill('0')
-              << std::setw(4) << static_cast<int>(*c);
-          result += oss.str();
-        } else {
-          result += *c;
-        }
+        buffer += "\\u00";
+        buffer += hexDigits[ch >> 4];
+        buffer += hexDigits[ch & 0xF];
         break;
     }
   }
-  result += "\"";
-  return gd::String::FromUTF8(result);
+  buffer.append(begin, end);
+  buffer += '"';
 }
 
-gd::String ValueToJSON(const SerializerValue& val) {
-  if (val.IsBoolean())
-    return val.GetBool() ? "true" : "false";
-  else if (val.IsInt())
-    return gd::String::From(val.GetInt());
-  else if (val.IsDouble())
-    return gd::String::From(val.GetDouble());
-  else
-    return StringToQuotedJSONString(val.GetString().c_str());
+void JSONWriter::WriteDouble(double value) {
+  // Same formatting as gd::String::From, without the cost of a stream.
+  char str[32];
+  int length = snprintf(str, sizeof(str), "%g", value);
+
+  // Don't depend on the C locale for the decimal separator.
+  for (int i = 0; i < length; ++i) {
+    if (str[i] == ',') str[i] = '.';
+  }
+  buffer.append(str, length);
 }
 }  // namespace
 
-gd::String Serializer::ToJSON(const SerializerElement& element) {
-  if (element.IsValueUndefined()) {
-    if (element.ConsideredAsArray()) {
-      // Store the element as an array in JSON:
-      gd::String str = "[";
-      bool firstChild = true;
+gd::String Serializer::ToJSON(const SerializerElement& element, bool compact) {
+  gd::String json;
+  JSONWriter writer(json.Raw(), nullptr, compact);
+  writer.WriteElement(element);
 
-      if (element.GetAllAttributes().size() > 0) {
-        std::cout << "ERROR: A SerializerElement is considered as an array of "
-                  << (element.ConsideredAsArrayOf().empty()
-                          ? "[unnamed elements]"
-                          : element.ConsideredAsArrayOf())
-                  << " but has attributes. These attributes won't be saved!"
-                  << std::endl;
-      }
+  return json;
+}
+
+void Serializer::ToJSON(const SerializerElement& element,
+                        std::ostream& stream,
+                        bool compact) {
+  std::string buffer;
+  JSONWriter writer(buffer, &stream, compact);
+  writer.WriteElement(element);
+  writer.Flush();
+}
+
+// Private functions for JSON parsing
+namespace {
+/**
+ * \brief A single pass JSON parser, reading the JSON directly from a buffer
+ * and filling a gd::SerializerElement.
+ *
+ * Strings (children names and values) are decoded straight into the
+ * gd::String that is stored in the element, without any intermediate copy.
+ */
+class JSONParser {
+ public:
+  JSONParser(const char* begin, const char* end)
+      : current(begin), end(end), hasError(false) {}
 
-      const std::vector<
-          std::pair<gd::String, std::shared_ptr<SerializerElement> > >&
-          children = element.GetAllChildren();
-      for (size_t i = 0; i < children.size(); ++i) {
-        if (children[i].second == std::shared_ptr<SerializerElement>())
-          continue;
-        if (children[i].first != element.ConsideredAsArrayOf()) {
-          std::cout
-              << "ERROR: A SerializerElement is considered as an array of "
-              << (element.ConsideredAsArrayOf().empty()
-                      ? "[unnamed elements]"
-                      : element.ConsideredAsArrayOf())
-              << " but has a child called \"" << children[i].first
-              << "\". This child won't be saved!" << std::endl;
-          continue;
-        }
-
-        if (!firstChild) str += ",";
-        str += ToJSON(*children[i].second);
-
-        firstChild = false;
+  /**
+   * Parse a JSON value, starting from the current position, and store it into
+   * the specified element. Note that the parsing is stopped as soon as a valid
+   * value is parsed.
+   * \return false if the JSON is invalid.
+   */
+  bool ParseValue(gd::SerializerElement& element) {
+    SkipBlankChars();
+    if (current >= end) return Error("Unexpected end of JSON.");
+
+    switch (*current) {
+      case '{':
+        return ParseObject(element);
+      case '[':
+        return ParseArray(element);
+      case '"': {
+        gd::String str;
+        if (!ParseString(str)) return false;
+        element.SetValue(str);
+        return true;
       }
+      default:
+        return ParseLiteral(element);
+    }
+  }
 
-      str += "]";
-      return str;
-    } else {
-      gd::String str = "{";
-      bool firstChild = true;
-
-      const std::map<gd::String, SerializerValue>& attributes =
-          element.GetAllAttributes();
-      for (std::map<gd::String, SerializerValue>::const_iterator it =
-               attributes.begin();
-           it != attributes.end();
-           ++it) {
-        if (!firstChild) str += ",";
-        str += StringToQuotedJSONString(it->first.c_str()) + ": " +
-               ValueToJSON(it->second);
-
-        firstChild = false;
+ private:
+  bool ParseObject(gd::SerializerElement& element) {
+    ++current;  // Skip '{'
+    SkipBlankChars();
+    if (current < end && *current == '}') {
+      ++current;
+      return true;
+    }
+
+    while (true) {
+      SkipBlankChars();
+      if (current >= end || *current != '"')
+        return Error("Object not properly formed.");
+
+      gd::String childName;
+      if (!ParseString(childName)) return false;
+
+      SkipBlankChars();
+      if (current >= end || *current != ':')
+        return Error("Object not properly formed.");
+      ++current;
+
+      if (!ParseValue(element.AddChild(std::move(childName)))) return false;
+
+      SkipBlankChars();
+      if (current >= end) return Error("Object not properly formed.");
+      if (*current == ',') {
+        ++current;
+        continue;
       }
+      if (*current == '}') {
+        ++current;
+        return true;
+      }
+
+      return Error("Object not properly formed.");
+    }
+  }
+
+  bool ParseArray(gd::SerializerElement& element) {
+    element.ConsiderAsArray();
+    ++current;  // Skip '['
+    SkipBlankChars();
+    if (current < end && *current == ']') {
+      ++current;
+      return true;
+    }
 
-      const std::vector<
-          std::pair<gd::String, std::shared_ptr<SerializerElement> > >&
-          children = element.GetAllChildren();
-      for (size_t i = 0; i < children.size(); ++i) {
-        if (children[i].second == std::shared_ptr<SerializerElement>())
-          continue;
-
-        if (attributes.find(children[i].first) != attributes.end()) {
-          std::cout << "ERROR: An attribute and a children called \""
-                    << children[i].first
-                    << "\" both exist. The children will erase the attribute - "
-                       "fix the usage of the attribute or (better) use "
-                       "children methods only."
-                    << std::endl;
-        }
-
-        if (!firstChild) str += ",";
-        str += StringToQuotedJSONString(children[i].first.c_str()) + ": " +
-               ToJSON(*children[i].second);
-
-        firstChild = false;
+    while (true) {
+      if (!ParseValue(element.AddChild(""))) return false;
+
+      SkipBlankChars();
+      if (current >= end)
+        return Error("element of array not properly formed.");
+      if (*current == ',') {
+        ++current;
+        continue;
+      }
+      if (*current == ']') {
+        ++current;
+        return true;
       }
 
-      str += "}";
-      return str;
+      return Error("array not properly ended");
     }
-  } else {
-    return ValueToJSON(element.GetValue());
   }
-}
 
-// Private functions for JSON parsing
-namespace {
-size_t SkipBlankChar(const std::string& str, size_t pos) {
-  const std::string blankChar = " \n";
-  return str.find_first_not_of(blankChar, pos);
-}
+  /**
+   * \brief Decode the string starting at the current position (which must be
+   * a quote) into \a str.
+   */
+  bool ParseString(gd::String& str) {
+    ++current;  // Skip the opening quote
+    std::string& value = str.Raw();
+    bool isAscii = true;
 
-/**
- * Adapted from https://github.com/hjiang/jsonxx
- */
-std::string DecodeString(const std::string& original) {
-  std::string value;
-  value.reserve(original.size());
-  std::istringstream input("\"" + original + "\"");
-
-  char ch = '\0', delimiter = '"';
-  input.get(ch);
-  if (ch != delimiter) return "";
-
-  while (!input.eof() && input.good()) {
-    input.get(ch);
-    if (ch == delimiter) {
-      break;
-    }
-    if (ch == '\\') {
-      input.get(ch);
+    while (true) {
+      // Copy as many characters as possible at once, until the end of the
+      // string or an escaped character.
+      const char* chunkStart = current;
+      unsigned char nonAsciiBits = 0;
+      while (current < end && *current != '"' && *current != '\\') {
+        nonAsciiBits |= static_cast<unsigned char>(*current);
+        ++current;
+      }
+      if (nonAsciiBits & 0x80) isAscii = false;
+      value.append(chunkStart, current - chunkStart);
+
+      if (current >= end) return Error("Invalid string");
+      if (*current == '"') {
+        ++current;
+        break;
+      }
+
+      // Escaped character
+      ++current;
+      if (current >= end) return Error("Invalid string");
+      char ch = *current++;
       switch (ch) {
+        case '"':
         case '\\':
         case '/':
           value.push_back(ch);
@@ -335,170 +497,568 @@ std::string DecodeString(const std::string& original) {
           value.push_back('\t');
           break;
         case 'u': {
-          int i;
-          std::stringstream ss;
-          for (i = 0; (!input.eof() && input.good()) && i < 4; ++i) {
-            input.get(ch);
-            ss << ch;
+          char32_t codePoint = 0;
+          if (!ParseHexCodeUnit(current, codePoint))
+            return Error("Invalid unicode escape sequence");
+          current += 4;
+
+          // Combine UTF-16 surrogate pairs into a single code point.
+          char32_t lowSurrogate = 0;
+          if (codePoint >= 0xD800 && codePoint <= 0xDBFF &&
+              end - current >= 6 && current[0] == '\\' && current[1] == 'u' &&
+              ParseHexCodeUnit(current + 2, lowSurrogate) &&
+              lowSurrogate >= 0xDC00 && lowSurrogate <= 0xDFFF) {
+            codePoint = 0x10000 + ((codePoint - 0xD800) << 10) +
+                        (lowSurrogate - 0xDC00);
+            current += 6;
           }
-          if (input.good() && (ss >> i)) value.push_back(i);
+
+          if (codePoint >= 0xD800 && codePoint <= 0xDFFF)
+            codePoint = 0xFFFD;  // Unpaired surrogate
+          ::utf8::unchecked::append(codePoint, std::back_inserter(value));
         } break;
         default:
-          if (ch != delimiter) {
-            value.push_back('\\');
-            value.push_back(ch);
-          } else
-            value.push_back(ch);
+          value.push_back('\\');
+          value.push_back(ch);
           break;
       }
-    } else {
-      value.push_back(ch);
     }
+
+    if (!isAscii && !str.IsValid()) str.ReplaceInvalid();
+    return true;
   }
-  if (input && ch == delimiter) {
-    return value;
-  } else {
-    return "";
+
+  /**
+   * \brief Read the 4 hexadecimal digits of an escaped UTF-16 code unit.
+   */
+  bool ParseHexCodeUnit(const char* str, char32_t& codeUnit) const {
+    if (end - str < 4) return false;
+
+    codeUnit = 0;
+    for (int i = 0; i < 4; ++i) {
+      char ch = str[i];
+      codeUnit <<= 4;
+      if (ch >= '0' && ch <= '9')
+        codeUnit |= ch - '0';
+      else if (ch >= 'a' && ch <= 'f')
+        codeUnit |= ch - 'a' + 10;
+      else if (ch >= 'A' && ch <= 'F')
+        codeUnit |= ch - 'A' + 10;
+      else
+        return false;
+    }
+
+    return true;
   }
+
+  /**
+   * \brief Parse a number or a boolean.
+   */
+  bool ParseLiteral(gd::SerializerElement& element) {
+    const char* literalStart = current;
+    while (current < end && !IsSeparator(*current)) ++current;
+    std::size_t length = current - literalStart;
+
+    if (length == 4 && std::strncmp(literalStart, "true", 4) == 0) {
+      element.SetValue(true);
+      return true;
+    }
+    if (length == 5 && std::strncmp(literalStart, "false", 5) == 0) {
+      element.SetValue(false);
+      return true;
+    }
+
+    element.SetValue(ParseNumber(literalStart, length));
+    return true;
+  }
+
+  static double ParseNumber(const char* str, std::size_t length) {
+    // Fast path for integers, which are exactly representable as double
+    // as long as they have less than 16 digits.
+    const char* digits = str;
+    bool negative = false;
+    if (length > 0 && *digits == '-') {
+      negative = true;
+      ++digits;
+    }
+    std::size_t digitsCount = length - (digits - str);
+    if (digitsCount > 0 && digitsCount < 16) {
+      long long integer = 0;
+      std::size_t i = 0;
+      for (; i < digitsCount && digits[i] >= '0' && digits[i] <= '9'; ++i)
+        integer = integer * 10 + (digits[i] - '0');
+
+      if (i == digitsCount)
+        return negative ? -static_cast<double>(integer)
+                        : static_cast<double>(integer);
+    }
+
+    // General case: let the standard library parse the number. Check that the
+    // whole literal was consumed, as strtod is sensitive to the C locale.
+    std::string literal(str, length);
+    char* literalEnd = nullptr;
+    double value = std::strtod(literal.c_str(), &literalEnd);
+    if (literalEnd == literal.c_str() + literal.size()) return value;
+
+    return gd::String::FromUTF8(literal).To<double>();
+  }
+
+  void SkipBlankChars() {
+    while (current < end && (*current == ' ' || *current == '\n' ||
+                             *current == '\r' || *current == '\t'))
+      ++current;
+  }
+
+  static bool IsSeparator(char ch) {
+    return ch == ' ' || ch == '\n' || ch == '\r' || ch == '\t' || ch == ',' ||
+           ch == '}' || ch == ']';
+  }
+
+  bool Error(const char* message) {
+    if (!hasError) std::cout << "Parsing error: " << message << std::endl;
+    hasError = true;
+    return false;
+  }
+
+  const char* current;
+  const char* end;
+  bool hasError;
+};
+}  // namespace
+
+SerializerElement Serializer::FromJSON(const std::string& jsonStr,
+                                       bool useArena,
+                                       bool* success) {
+  return FromJSON(jsonStr.data(), jsonStr.size(), useArena, success);
+}
+
+SerializerElement Serializer::FromJSON(const char* json,
+                                       std::size_t length,
+                                       bool useArena,
+                                       bool* success) {
+  SerializerElement element(useArena
+                                ? std::make_shared<SerializerElementArena>()
+                                : std::shared_ptr<SerializerElementArena>());
+  bool parsed = false;
+  if (length != 0) {
+    JSONParser parser(json, json + length);
+    parsed = parser.ParseValue(element);
+  }
+
+  if (success) *success = parsed;
+  return element;
 }
 
+// Private functions for binary serialization
+namespace {
 /**
- * Return the position of the end of the string. Blank are skipped if necessary
- * @param str The string to be used
- * @param startPos The start position
- * @param strContent A reference to a string that will be filled with the string
- * content.
+ * The header starting any binary serialized element. The last byte is the
+ * version of the format.
  */
-size_t SkipString(const std::string& str,
-                  size_t startPos,
-                  std::string& strContent) {
-  startPos = SkipBlankChar(str, startPos);
-  if (startPos >= str.length()) return std::string::npos;
+const char binaryHeader[] = {'G', 'D', 'B', 1};
+const std::size_t binaryHeaderSize = sizeof(binaryHeader);
 
-  size_t endPos = startPos;
+/**
+ * The type of an element or of an attribute, stored as a single byte before
+ * its content.
+ */
+enum BinaryType {
+  BINARY_OBJECT = 0,  ///< Followed by the size of the content (4 bytes).
+  BINARY_ARRAY = 1,   ///< Followed by the size of the content (4 bytes).
+  BINARY_FALSE = 2,
+  BINARY_TRUE = 3,
+  BINARY_INT = 4,               ///< Followed by a varint.
+  BINARY_DOUBLE = 5,            ///< Followed by 8 bytes.
+  BINARY_INTEGRAL_DOUBLE = 6,   ///< Followed by a varint.
+  BINARY_STRING = 7,  ///< Followed by the size (varint) and the UTF8 bytes.
+};
 
-  if (str[startPos] == '"') {
-    if (startPos + 1 >= str.length()) return std::string::npos;
+/**
+ * \brief Write a gd::SerializerElement in the binary format.
+ *
+ * The elements are written in a buffer while the names are collected in the
+ * string table, which is written before the buffer at the end.
+ */
+class BinaryWriter {
+ public:
+  /**
+   * \brief Write an element and its children in the buffer.
+   * \return false if the content of an element is too large for its size
+   * field.
+   */
+  bool WriteElement(const SerializerElement& element);
 
-    while (endPos == startPos || (str[endPos - 1] == '\\')) {
-      endPos = str.find_first_of('\"', endPos + 1);
-      if (endPos == std::string::npos)
-        return std::string::npos;  // Invalid string
+  /**
+   * \brief Write the header, the string table and the elements.
+   */
+  void WriteTo(std::string& output) const {
+    std::string header(binaryHeader, binaryHeaderSize);
+    WriteVarUInt(header, names.size());
+    for (const gd::String* name : names) {
+      WriteVarUInt(header, name->Raw().size());
+      header += name->Raw();
     }
 
-    strContent = DecodeString(str.substr(startPos + 1, endPos - 1 - startPos));
-    return endPos;
+    output.reserve(output.size() + header.size() + buffer.size());
+    output += header;
+    output += buffer;
   }
 
-  endPos = str.find_first_of(" \n,:");
-  if (endPos >= str.length()) return std::string::npos;  // Invalid string
+ private:
+  void WriteValue(const SerializerValue& value);
+
+  void WriteName(const gd::String& name) {
+    auto it = namesIndex.find(name);
+    if (it == namesIndex.end()) {
+      it = namesIndex.emplace(name, names.size()).first;
+      names.push_back(&it->first);
+    }
+    WriteVarUInt(buffer, it->second);
+  }
 
-  strContent = DecodeString(str.substr(startPos, endPos - 1 - startPos));
-  return endPos - 1;
+  static void WriteVarUInt(std::string& output, std::uint64_t value) {
+    while (value >= 0x80) {
+      output += static_cast<char>((value & 0x7F) | 0x80);
+      value >>= 7;
+    }
+    output += static_cast<char>(value);
+  }
+
+  static void WriteVarInt(std::string& output, std::int64_t value) {
+    // Zigzag encoding, so that small negative numbers are small too.
+    WriteVarUInt(output,
+                 (static_cast<std::uint64_t>(value) << 1) ^
+                     static_cast<std::uint64_t>(value >> 63));
+  }
+
+  std::string buffer;
+  std::unordered_map<gd::String, std::size_t> namesIndex;
+  std::vector<const gd::String*> names;  ///< Pointers to keys of namesIndex.
+};
+
+bool BinaryWriter::WriteElement(const SerializerElement& element) {
+  if (!element.IsValueUndefined()) {
+    WriteValue(element.GetValue());
+    return true;
+  }
+
+  const std::vector<
+      std::pair<gd::String, std::shared_ptr<SerializerElement> > >& children =
+      element.GetAllChildren();
+  const std::map<gd::String, SerializerValue>& attributes =
+      element.GetAllAttributes();
+  bool isArray = element.ConsideredAsArray();
+
+  buffer += static_cast<char>(isArray ? BINARY_ARRAY : BINARY_OBJECT);
+  std::size_t sizePosition = buffer.size();
+  buffer.append(4, '\0');  // Size of the content, written at the end.
+
+  if (isArray) WriteName(element.ConsideredAsArrayOf());
+
+  WriteVarUInt(buffer, attributes.size());
+  for (const auto& attribute : attributes) {
+    WriteName(attribute.first);
+    WriteValue(attribute.second);
+  }
+
+  std::size_t childrenCount = 0;
+  for (const auto& child : children) {
+    if (child.second) ++childrenCount;
+  }
+  WriteVarUInt(buffer, childrenCount);
+  for (const auto& child : children) {
+    if (!child.second) continue;
+
+    // Children of arrays are all named after ConsideredAsArrayOf.
+    if (!isArray) WriteName(child.first);
+    if (!WriteElement(*child.second)) return false;
+  }
+
+  std::uint64_t size = buffer.size() - sizePosition - 4;
+  if (size > 0xFFFFFFFF) {
+    std::cout << "ERROR: A SerializerElement is too large to be serialized to "
+                 "the binary format."
+              << std::endl;
+    return false;
+  }
+  for (std::size_t i = 0; i < 4; ++i)
+    buffer[sizePosition + i] = static_cast<char>((size >> (i * 8)) & 0xFF);
+  return true;
+}
+
+void BinaryWriter::WriteValue(const SerializerValue& value) {
+  if (value.IsBoolean()) {
+    // Normalize the boolean so that only the two valid types are written.
+    bool b = value.GetBool() != false;
+    buffer += static_cast<char>(b ? BINARY_TRUE : BINARY_FALSE);
+  } else if (value.IsInt()) {
+    buffer += static_cast<char>(BINARY_INT);
+    WriteVarInt(buffer, value.GetInt());
+  } else if (value.IsDouble()) {
+    double number = value.GetDouble();
+    // Most of the numbers are integers: store them as varints.
+    if (number >= -9007199254740992.0 && number <= 9007199254740992.0 &&
+        number == static_cast<double>(static_cast<std::int64_t>(number)) &&
+        !(number == 0 && std::signbit(number))) {
+      buffer += static_cast<char>(BINARY_INTEGRAL_DOUBLE);
+      WriteVarInt(buffer, static_cast<std::int64_t>(number));
+    } else {
+      buffer += static_cast<char>(BINARY_DOUBLE);
+      std::uint64_t bits;
+      std::memcpy(&bits, &number, sizeof(bits));
+      for (std::size_t i = 0; i < 8; ++i)
+        buffer += static_cast<char>((bits >> (i * 8)) & 0xFF);
+    }
+  } else {
+    gd::String str = value.GetString();
+    buffer += static_cast<char>(BINARY_STRING);
+    WriteVarUInt(buffer, str.Raw().size());
+    buffer += str.Raw();
+  }
 }
 
 /**
- * Parse a JSON string, starting from pos, and storing the result into the
- * specified element. Note that the parsing is stopped as soon as a valid object
- * is parsed. \return The position at the end of the valid object stored into
- * the element.
+ * \brief Read a gd::SerializerElement written by BinaryWriter.
  */
-size_t ParseJSONObject(const std::string& jsonStr,
-                       size_t startPos,
-                       gd::SerializerElement& element) {
-  size_t pos = SkipBlankChar(jsonStr, startPos);
-  if (pos >= jsonStr.length()) return std::string::npos;
-
-  if (jsonStr[pos] == '{')  // Object
-  {
-    bool firstChild = true;
-    while (firstChild || jsonStr[pos] == ',') {
-      pos++;
-      if (pos < jsonStr.length() && jsonStr[pos] == '}') break;
-
-      std::string childName;
-      pos = SkipString(jsonStr, pos, childName);
-
-      pos++;
-      pos = SkipBlankChar(jsonStr, pos);
-      if (pos >= jsonStr.length() || jsonStr[pos] != ':')
-        return std::string::npos;
-
-      pos++;
-      pos = ParseJSONObject(
-          jsonStr,
-          pos,
-          element.AddChild(gd::String::FromUTF8(childName).ReplaceInvalid()));
-
-      pos = SkipBlankChar(jsonStr, pos);
-      if (pos >= jsonStr.length()) return std::string::npos;
-      firstChild = false;
+class BinaryParser {
+ public:
+  BinaryParser(const char* begin, const char* end)
+      : current(begin), end(end), hasError(false) {}
+
+  /**
+   * \brief Read the header and the string table.
+   * \return false if the binary is invalid.
+   */
+  bool ParseHeader() {
+    if (!gd::Serializer::IsBinary(current, end - current))
+      return Error("Invalid header.");
+    current += binaryHeaderSize;
+
+    std::uint64_t namesCount;
+    if (!ParseVarUInt(namesCount)) return false;
+    if (namesCount > static_cast<std::uint64_t>(end - current))
+      return Error("Invalid string table.");
+
+    names.resize(namesCount);
+    for (gd::String& name : names) {
+      if (!ParseString(name)) return false;
     }
+    return true;
+  }
 
-    if (jsonStr[pos] != '}') {
-      std::cout << "Parsing error: Object not properly formed.";
-      return std::string::npos;
+  /**
+   * \brief Read an element, starting from the current position.
+   * \return false if the binary is invalid.
+   */
+  bool ParseElement(gd::SerializerElement& element) {
+    if (current >= end) return Error("Unexpected end of data.");
+
+    unsigned char type = static_cast<unsigned char>(*current++);
+    if (type != BINARY_OBJECT && type != BINARY_ARRAY) {
+      SerializerValue value;
+      if (!ParseValue(type, value)) return false;
+      element.SetValue(value);
+      return true;
     }
-    return pos + 1;
-  } else if (jsonStr[pos] == '[')  // Array
-  {
-    element.ConsiderAsArray();
-    unsigned int index = 0;
-    while (index == 0 || jsonStr[pos] == ',') {
-      pos++;
-      if (pos < jsonStr.length() && jsonStr[pos] == ']') break;
-      pos = ParseJSONObject(jsonStr, pos, element.AddChild(""));
-
-      pos = SkipBlankChar(jsonStr, pos);
-      if (pos >= jsonStr.length()) {
-        std::cout << "Parsing error: element of array not properly formed.";
-        return std::string::npos;
-      }
-      index++;
+
+    if (end - current < 4) return Error("Unexpected end of data.");
+    std::size_t size = 0;
+    for (std::size_t i = 0; i < 4; ++i)
+      size |= static_cast<std::size_t>(static_cast<unsigned char>(current[i]))
+              << (i * 8);
+    current += 4;
+    if (size > static_cast<std::size_t>(end - current))
+      return Error("Invalid element size.");
+    const char* elementEnd = current + size;
+
+    bool isArray = type == BINARY_ARRAY;
+    const gd::String* arrayOf = nullptr;
+    if (isArray) {
+      if (!ParseName(arrayOf)) return false;
+      if (arrayOf->empty())
+        element.ConsiderAsArray();
+      else
+        element.ConsiderAsArrayOf(*arrayOf);
     }
 
-    if (jsonStr[pos] != ']') {
-      std::cout << "Parsing error: array not properly ended";
-      return std::string::npos;
+    std::uint64_t attributesCount;
+    if (!ParseVarUInt(attributesCount)) return false;
+    for (std::uint64_t i = 0; i < attributesCount; ++i) {
+      const gd::String* name;
+      SerializerValue value;
+      if (!ParseName(name)) return false;
+      if (current >= end) return Error("Unexpected end of data.");
+      if (!ParseValue(static_cast<unsigned char>(*current++), value))
+        return false;
+
+      if (value.IsBoolean())
+        element.SetAttribute(*name, value.GetBool());
+      else if (value.IsInt())
+        element.SetAttribute(*name, value.GetInt());
+      else if (value.IsDouble())
+        element.SetAttribute(*name, value.GetDouble());
+      else
+        element.SetAttribute(*name, value.GetString());
     }
-    return pos + 1;
-  } else if (jsonStr[pos] == '"')  // String
-  {
-    std::string str;
-    pos = SkipString(jsonStr, pos, str);
-    if (pos >= jsonStr.length()) {
-      std::cout << "Parsing error: Invalid string";
-      return std::string::npos;
+
+    std::uint64_t childrenCount;
+    if (!ParseVarUInt(childrenCount)) return false;
+    for (std::uint64_t i = 0; i < childrenCount; ++i) {
+      const gd::String* name = arrayOf;
+      if (!isArray && !ParseName(name)) return false;
+      if (!ParseElement(element.AddChild(*name))) return false;
     }
 
-    element.SetValue(gd::String::FromUTF8(str).ReplaceInvalid());
-    return pos + 1;
-  } else  // Number or boolean
-  {
-    std::string str;
-    size_t endPos = pos;
-    const std::string separators = " \n,}]";
-    while (endPos < jsonStr.length() &&
-           separators.find_first_of(jsonStr[endPos]) == std::string::npos) {
-      endPos++;
+    if (current != elementEnd) return Error("Invalid element size.");
+    return true;
+  }
+
+ private:
+  bool ParseValue(unsigned char type, SerializerValue& value) {
+    switch (type) {
+      case BINARY_FALSE:
+        value.SetBool(false);
+        return true;
+      case BINARY_TRUE:
+        value.SetBool(true);
+        return true;
+      case BINARY_INT: {
+        std::int64_t number;
+        if (!ParseVarInt(number)) return false;
+        value.SetInt(static_cast<int>(number));
+        return true;
+      }
+      case BINARY_INTEGRAL_DOUBLE: {
+        std::int64_t number;
+        if (!ParseVarInt(number)) return false;
+        value.SetDouble(static_cast<double>(number));
+        return true;
+      }
+      case BINARY_DOUBLE: {
+        if (end - current < 8) return Error("Unexpected end of data.");
+        std::uint64_t bits = 0;
+        for (std::size_t i = 0; i < 8; ++i)
+          bits |= static_cast<std::uint64_t>(
+                      static_cast<unsigned char>(current[i]))
+                  << (i * 8);
+        current += 8;
+
+        double number;
+        std::memcpy(&number, &bits, sizeof(number));
+        value.SetDouble(number);
+        return true;
+      }
+      case BINARY_STRING: {
+        gd::String str;
+        if (!ParseString(str)) return false;
+        value.SetString(str);
+        return true;
+      }
+      default:
+        return Error("Unknown type.");
     }
+  }
 
-    str = jsonStr.substr(pos, endPos - pos);
-    if (str == "true")
-      element.SetValue(true);
-    else if (str == "false")
-      element.SetValue(false);
-    else
-      element.SetValue(gd::String::FromUTF8(str).To<double>());
-    return endPos;
+  bool ParseName(const gd::String*& name) {
+    std::uint64_t index;
+    if (!ParseVarUInt(index)) return false;
+    if (index >= names.size()) return Error("Invalid name.");
+
+    name = &names[index];
+    return true;
   }
-}
+
+  bool ParseString(gd::String& str) {
+    std::uint64_t size;
+    if (!ParseVarUInt(size)) return false;
+    if (size > static_cast<std::uint64_t>(end - current))
+      return Error("Unexpected end of data.");
+
+    str.Raw().assign(current, size);
+    current += size;
+
+    bool isAscii = true;
+    for (unsigned char ch : str.Raw()) {
+      if (ch >= 0x80) {
+        isAscii = false;
+        break;
+      }
+    }
+    if (!isAscii && !str.IsValid()) str.ReplaceInvalid();
+    return true;
+  }
+
+  bool ParseVarUInt(std::uint64_t& value) {
+    value = 0;
+    for (unsigned int shift = 0; shift < 64; shift += 7) {
+      if (current >= end) return Error("Unexpected end of data.");
+
+      unsigned char byte = static_cast<unsigned char>(*current++);
+      value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+      if (!(byte & 0x80)) return true;
+    }
+
+    return Error("Invalid variable length integer.");
+  }
+
+  bool ParseVarInt(std::int64_t& value) {
+    std::uint64_t encodedValue;
+    if (!ParseVarUInt(encodedValue)) return false;
+
+    value = static_cast<std::int64_t>(encodedValue >> 1) ^
+            -static_cast<std::int64_t>(encodedValue & 1);
+    return true;
+  }
+
+  bool Error(const char* message) {
+    if (!hasError) std::cout << "Binary parsing error: " << message << std::endl;
+    hasError = true;
+    return false;
+  }
+
+  const char* current;
+  const char* end;
+  bool hasError;
+  std::vector<gd::String> names;  ///< The string table.
+};
 }  // namespace
 
-SerializerElement Serializer::FromJSON(const std::string& jsonStr) {
-  SerializerElement element;
-  if (!jsonStr.empty()) gd::ParseJSONObject(jsonStr, 0, element);
+std::string Serializer::ToBinary(const SerializerElement& element) {
+  BinaryWriter writer;
+  if (!writer.WriteElement(element)) return "";
+
+  std::string output;
+  writer.WriteTo(output);
+  return output;
+}
+
+void Serializer::ToBinary(const SerializerElement& element,
+                          std::ostream& stream) {
+  std::string output = ToBinary(element);
+  if (output.empty()) {
+    stream.setstate(std::ios_base::failbit);
+    return;
+  }
+  stream.write(output.data(), output.size());
+}
+
+SerializerElement Serializer::FromBinary(const char* data,
+                                         std::size_t length,
+                                         bool useArena,
+                                         bool* success) {
+  SerializerElement element(useArena
+                                ? std::make_shared<SerializerElementArena>()
+                                : std::shared_ptr<SerializerElementArena>());
+  BinaryParser parser(data, data + length);
+  bool parsed = parser.ParseHeader() && parser.ParseElement(element);
+
+  if (success) *success = parsed;
   return element;
 }
 
+bool Serializer::IsBinary(const char* data, std::size_t length) {
+  return length >= binaryHeaderSize &&
+         std::memcmp(data, binaryHeader, binaryHeaderSize) == 0;
+}
+
 }  // namespace gd
@@ -6,6 +6,7 @@
 
 #ifndef GDCORE_SERIALIZER_H
 #define GDCORE_SERIALIZER_H
+#include <iosfwd>
 #include <string>
 #include "GDCore/Serialization/SerializerElement.h"
 class TiXmlElement;
@@ -39,10 +40,44 @@ class GD_CORE_API Serializer {
   ///@{
   /**
    * \brief Serialize a gd::SerializerElement to a JSON string.
+   *
+   * \param compact If true, no whitespace is written between keys and values.
    */
-  static gd::String ToJSON(const SerializerElement& element);
+  static gd::String ToJSON(const SerializerElement& element,
+                           bool compact = false);
 
-  static SerializerElement FromJSON(const std::string& json);
+  /**
+   * \brief Serialize a gd::SerializerElement to JSON, written into the
+   * given stream (for example, a std::ofstream to save directly to a file).
+   *
+   * The JSON is written by chunks, so it is never entirely held in memory.
+   *
+   * \param compact If true, no whitespace is written between keys and values.
+   */
+  static void ToJSON(const SerializerElement& element,
+                     std::ostream& stream,
+                     bool compact = false);
+
+  static SerializerElement FromJSON(const std::string& json,
+                                    bool useArena = false,
+                                    bool* success = nullptr);
+
+  /**
+   * \brief Parse a buffer containing UTF8 encoded JSON and returns a
+   * gd::SerializerElement for it.
+   *
+   * The JSON is read in a single pass, directly into the element.
+   *
+   * \param useArena If true, the elements of the tree are allocated from a
+   * gd::SerializerElementArena, which is faster to build and destroy for
+   * large JSON.
+   * \param success If not null, set to false if the JSON is invalid (in which
+   * case the returned element only contains what was parsed before the error).
+   */
+  static SerializerElement FromJSON(const char* json,
+                                    std::size_t length,
+                                    bool useArena = false,
+                                    bool* success = nullptr);
 
   /**
    * \brief Parse a JSON string and returns a gd::SerializerElement for it.
@@ -52,6 +87,62 @@ class GD_CORE_API Serializer {
   }
   ///@}
 
+  /** \name Binary serialization.
+   * Serialize a SerializerElement from/to a compact binary format, much
+   * faster to read than JSON or XML.
+   *
+   * The binary starts with a string table containing the names of the
+   * children and attributes, followed by the root element. Integers are
+   * encoded as variable length integers, and the content of each element
+   * having children is prefixed by its size in bytes, so that a reader can
+   * skip it.
+   */
+  ///@{
+  /**
+   * \brief Serialize a gd::SerializerElement to the binary format.
+   *
+   * \return The binary, or an empty string if an element is too large to be
+   * written (its content is limited to 4 GiB).
+   */
+  static std::string ToBinary(const SerializerElement& element);
+
+  /**
+   * \brief Serialize a gd::SerializerElement to the binary format, written
+   * into the given stream.
+   *
+   * The failbit of the stream is set if an element is too large to be
+   * written.
+   */
+  static void ToBinary(const SerializerElement& element, std::ostream& stream);
+
+  /**
+   * \brief Parse a buffer containing a gd::SerializerElement serialized with
+   * gd::Serializer::ToBinary.
+   *
+   * \param useArena If true, the elements of the tree are allocated from a
+   * gd::SerializerElementArena.
+   * \param success If not null, set to false if the binary is invalid (in
+   * which case the returned element only contains what was read before the
+   * error).
+   */
+  static SerializerElement FromBinary(const char* data,
+                                      std::size_t length,
+                                      bool useArena = false,
+                                      bool* success = nullptr);
+
+  static SerializerElement FromBinary(const std::string& data,
+                                      bool useArena = false,
+                                      bool* success = nullptr) {
+    return FromBinary(data.data(), data.size(), useArena, success);
+  }
+
+  /**
+   * \brief Return true if the buffer starts with the header of the binary
+   * format.
+   */
+  static bool IsBinary(const char* data, std::size_t length);
+  ///@}
+
   virtual ~Serializer(){};
 
  private:
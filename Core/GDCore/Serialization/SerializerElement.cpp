@@ -1,15 +1,33 @@
 #include "GDCore/Serialization/SerializerElement.h"
 
 #include <iostream>
+#include "GDCore/Serialization/SerializerElementArena.h"
 
 namespace gd {
 
 SerializerElement SerializerElement::nullElement;
+constexpr std::size_t SerializerElement::childrenIndexThreshold;
 
-SerializerElement::SerializerElement() : valueUndefined(true), isArray(false) {}
+SerializerElement::SerializerElement()
+    : valueUndefined(true),
+      isArray(false),
+      childrenIndexed(false),
+      arrayElementsState(arrayElementsUnknown) {}
 
 SerializerElement::SerializerElement(const SerializerValue& value)
-    : valueUndefined(false), elementValue(value), isArray(false) {}
+    : valueUndefined(false),
+      elementValue(value),
+      isArray(false),
+      childrenIndexed(false),
+      arrayElementsState(arrayElementsUnknown) {}
+
+SerializerElement::SerializerElement(
+    std::shared_ptr<SerializerElementArena> arena_)
+    : valueUndefined(true),
+      isArray(false),
+      arena(std::move(arena_)),
+      childrenIndexed(false),
+      arrayElementsState(arrayElementsUnknown) {}
 
 SerializerElement::~SerializerElement() {}
 
@@ -154,15 +172,21 @@ SerializerElement& SerializerElement::AddChild(gd::String name) {
 
   // In case of children of objects, there can be only one child with
   // a given name.
-  // Note: searching for the existing children is O(number of children). This
-  // could be improved, but in practice has no visible impact on saving
-  // large projects.
-  if (!isArray && HasChild(name)) {
-    return GetChild(name);
+  if (!isArray) {
+    std::size_t position = FindChildPosition(name);
+    if (position != gd::String::npos) return *children[position].second;
   }
 
-  std::shared_ptr<SerializerElement> newElement(new SerializerElement);
-  children.push_back(std::make_pair(name, newElement));
+  std::shared_ptr<SerializerElement> newElement =
+      arena ? std::allocate_shared<SerializerElement>(
+                  SerializerElementArenaAllocator<SerializerElement>(arena),
+                  arena)
+            : std::shared_ptr<SerializerElement>(new SerializerElement);
+  if (childrenIndexed) childrenIndex.emplace(name, children.size());
+  children.push_back(std::make_pair(std::move(name), newElement));
+  if (!isArray && !childrenIndexed &&
+      children.size() >= childrenIndexThreshold)
+    BuildChildrenIndex();
 
   return *newElement;
 }
@@ -175,6 +199,9 @@ SerializerElement& SerializerElement::GetChild(std::size_t index) const {
     return nullElement;
   }
 
+  if (index < children.size() && AllChildrenAreArrayElements())
+    return *children[index].second;
+
   std::size_t currentIndex = 0;
   for (size_t i = 0; i < children.size(); ++i) {
     if (children[i].second == std::shared_ptr<SerializerElement>()) continue;
@@ -206,17 +233,27 @@ SerializerElement& SerializerElement::GetChild(
     }
   }
 
-  std::size_t currentIndex = 0;
-  for (size_t i = 0; i < children.size(); ++i) {
-    if (children[i].second == std::shared_ptr<SerializerElement>()) continue;
+  if (!isArray && index == 0) {
+    std::size_t position = FindChildPosition(name);
+    if (!deprecatedName.empty()) {
+      std::size_t deprecatedPosition = FindChildPosition(deprecatedName);
+      if (deprecatedPosition < position) position = deprecatedPosition;
+    }
 
-    if (children[i].first == name ||
-        (isArray && children[i].first.empty()) ||
-        (!deprecatedName.empty() && children[i].first == deprecatedName)) {
-      if (index == currentIndex)
-        return *children[i].second;
-      else
-        currentIndex++;
+    if (position != gd::String::npos) return *children[position].second;
+  } else {
+    std::size_t currentIndex = 0;
+    for (size_t i = 0; i < children.size(); ++i) {
+      if (children[i].second == std::shared_ptr<SerializerElement>()) continue;
+
+      if (children[i].first == name ||
+          (isArray && children[i].first.empty()) ||
+          (!deprecatedName.empty() && children[i].first == deprecatedName)) {
+        if (index == currentIndex)
+          return *children[i].second;
+        else
+          currentIndex++;
+      }
     }
   }
 
@@ -225,6 +262,27 @@ SerializerElement& SerializerElement::GetChild(
   return nullElement;
 }
 
+std::shared_ptr<SerializerElement> SerializerElement::GetSharedChild(
+    const gd::String& name, const gd::String& deprecatedName) const {
+  std::size_t position = FindChildPosition(name);
+  if (position == gd::String::npos && !deprecatedName.empty())
+    position = FindChildPosition(deprecatedName);
+
+  return position != gd::String::npos ? children[position].second
+                                      : std::shared_ptr<SerializerElement>();
+}
+
+std::shared_ptr<const SerializerElement>
+SerializerElement::GetSharedChildOutsideArena(
+    const gd::String& name, const gd::String& deprecatedName) const {
+  std::shared_ptr<SerializerElement> child =
+      GetSharedChild(name, deprecatedName);
+  if (child && child->GetArena())
+    return std::make_shared<const SerializerElement>(*child);
+
+  return child;
+}
+
 std::size_t SerializerElement::GetChildrenCount(
     gd::String name, gd::String deprecatedName) const {
   if (name.empty()) {
@@ -240,6 +298,10 @@ std::size_t SerializerElement::GetChildrenCount(
     deprecatedName = deprecatedArrayOf;
   }
 
+  if (isArray && name == arrayOf && deprecatedName == deprecatedArrayOf &&
+      AllChildrenAreArrayElements())
+    return children.size();
+
   std::size_t currentIndex = 0;
   for (size_t i = 0; i < children.size(); ++i) {
     if (children[i].second == std::shared_ptr<SerializerElement>()) continue;
@@ -255,6 +317,12 @@ std::size_t SerializerElement::GetChildrenCount(
 
 bool SerializerElement::HasChild(const gd::String& name,
                                  gd::String deprecatedName) const {
+  if (!isArray) {
+    return FindChildPosition(name) != gd::String::npos ||
+           (!deprecatedName.empty() &&
+            FindChildPosition(deprecatedName) != gd::String::npos);
+  }
+
   for (size_t i = 0; i < children.size(); ++i) {
     if (children[i].second == std::shared_ptr<SerializerElement>()) continue;
 
@@ -267,12 +335,75 @@ bool SerializerElement::HasChild(const gd::String& name,
 }
 
 void SerializerElement::RemoveChild(const gd::String& name) {
+  arrayElementsState = arrayElementsUnknown;
+  if (childrenIndexed && !isArray) {
+    // Children of objects have unique names, so only one child can be removed.
+    auto it = childrenIndex.find(name);
+    if (it == childrenIndex.end()) return;
+
+    std::size_t position = it->second;
+    childrenIndex.erase(it);
+    children.erase(children.begin() + position);
+    for (auto& indexedChild : childrenIndex) {
+      if (indexedChild.second > position) indexedChild.second--;
+    }
+    return;
+  }
+
+  bool removed = false;
   for (size_t i = 0; i < children.size();) {
-    if (children[i].first == name)
+    if (children[i].first == name) {
       children.erase(children.begin() + i);
-    else
+      removed = true;
+    } else
       ++i;
   }
+  if (removed && childrenIndexed) BuildChildrenIndex();
+}
+
+bool SerializerElement::AllChildrenAreArrayElements() const {
+  unsigned char state = arrayElementsState;
+  if (state == arrayElementsUnknown) {
+    state = arrayElementsAll;
+    for (size_t i = 0; i < children.size(); ++i) {
+      if (children[i].second == std::shared_ptr<SerializerElement>() ||
+          !(children[i].first == arrayOf || children[i].first.empty() ||
+            (!deprecatedArrayOf.empty() &&
+             children[i].first == deprecatedArrayOf))) {
+        state = arrayElementsNotAll;
+        break;
+      }
+    }
+    arrayElementsState = state;
+  }
+
+  return state == arrayElementsAll;
+}
+
+std::size_t SerializerElement::FindChildPosition(const gd::String& name) const {
+  if (!isArray && childrenIndexed) {
+    auto it = childrenIndex.find(name);
+    return it != childrenIndex.end() ? it->second : gd::String::npos;
+  }
+
+  for (size_t i = 0; i < children.size(); ++i) {
+    if (children[i].second == std::shared_ptr<SerializerElement>()) continue;
+
+    if (children[i].first == name) return i;
+  }
+
+  return gd::String::npos;
+}
+
+void SerializerElement::BuildChildrenIndex() {
+  childrenIndex.clear();
+  childrenIndex.reserve(children.size());
+  for (size_t i = 0; i < children.size(); ++i) {
+    if (children[i].second == std::shared_ptr<SerializerElement>()) continue;
+
+    childrenIndex.emplace(children[i].first, i);  // Keep the first child.
+  }
+  childrenIndexed = true;
 }
 
 void SerializerElement::Init(const gd::SerializerElement& other) {
@@ -291,6 +422,10 @@ void SerializerElement::Init(const gd::SerializerElement& other) {
   isArray = other.isArray;
   arrayOf = other.arrayOf;
   deprecatedArrayOf = other.deprecatedArrayOf;
+  ClearChildrenIndex();
+  if (!isArray && children.size() >= childrenIndexThreshold)
+    BuildChildrenIndex();
+  arrayElementsState = arrayElementsUnknown;
 }
 
 }  // namespace gd
@@ -6,13 +6,19 @@
 
 #ifndef GDCORE_SERIALIZERELEMENT_H
 #define GDCORE_SERIALIZERELEMENT_H
+#include <atomic>
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include "GDCore/Serialization/SerializerValue.h"
 #include "GDCore/String.h"
 
+namespace gd {
+class SerializerElementArena;
+}
+
 namespace gd {
 
 /**
@@ -27,9 +33,11 @@ namespace gd {
  * It also has specialized methods in GDevelop.js (see postjs.js) to be
  * converted to a JavaScript object.
  *
- * \note Children are stored with their order preserved, but this also
- * means that their access/removal is O(number of children). This class
- * is not appropriated for a use in game where fast access is required.
+ * \note Children are stored with their order preserved. For elements that are
+ * not arrays and have many children, an index of the children names is built
+ * so that access is O(1) on average (removal is still O(number of children)).
+ * This class is not appropriated for a use in game where fast access is
+ * required.
  *
  * \see gd::Serializer
  */
@@ -46,6 +54,18 @@ class GD_CORE_API SerializerElement {
    */
   SerializerElement(const SerializerValue &value);
 
+  /**
+   * \brief Create an empty element whose children (and their own children)
+   * will be allocated from the specified arena.
+   *
+   * Use this for large trees that are built at once and destroyed at once,
+   * like the ones parsed from JSON: this avoids one heap allocation per child
+   * and the memory of all the children is freed at once with the arena.
+   *
+   * \note A copy of the element does not use the arena.
+   */
+  explicit SerializerElement(std::shared_ptr<SerializerElementArena> arena);
+
   /**
    * Copy constructor.
    */
@@ -334,7 +354,12 @@ class GD_CORE_API SerializerElement {
    * When serialized to a format accepting arrays (like JSON), the element will
    * be serialized to an array.
    */
-  void ConsiderAsArray() const { isArray = true; };
+  void ConsiderAsArray() const {
+    if (isArray) return;
+
+    isArray = true;  // Children of arrays are not looked up in the index.
+    arrayElementsState = arrayElementsUnknown;
+  };
 
   /**
    * \brief Check if the element is considered as an array containing its
@@ -353,13 +378,21 @@ class GD_CORE_API SerializerElement {
    * serialized to a format accepting arrays (like JSON), the element will be
    * serialized to an array.
    *
+   * \note This modifies the element unless it is already considered as an
+   * array of the same elements: call it before sharing the element between
+   * threads.
+   *
    * \param name The name of the children.
    */
   void ConsiderAsArrayOf(const gd::String &name,
                          const gd::String &deprecatedName = "") const {
+    if (isArray && arrayOf == name && deprecatedArrayOf == deprecatedName)
+      return;
+
     ConsiderAsArray();
     arrayOf = name;
     deprecatedArrayOf = deprecatedName;
+    arrayElementsState = arrayElementsUnknown;
   };
 
   /**
@@ -381,6 +414,10 @@ class GD_CORE_API SerializerElement {
   /**
    * \brief Get a child of the element using its name.
    *
+   * \note Const accessors of the children don't modify the element, so
+   * several threads can read the same element at the same time, as long as
+   * none of them modifies it.
+   *
    * \param name The name of the child.
    * \param name The index of the child, in case of an array.
    */
@@ -396,6 +433,28 @@ class GD_CORE_API SerializerElement {
    */
   SerializerElement &GetChild(std::size_t index) const;
 
+  /**
+   * \brief Return a pointer to the child with the given name, sharing its
+   * ownership, so that it can be kept after the element is destroyed. Return
+   * an empty pointer if the child does not exist.
+   *
+   * \param name The name of the child.
+   * \param deprecatedName An alternative name for the child.
+   */
+  std::shared_ptr<SerializerElement> GetSharedChild(
+      const gd::String &name, const gd::String &deprecatedName = "") const;
+
+  /**
+   * \brief Same as GetSharedChild, but if the child was allocated from an
+   * arena, return a copy of it allocated on the heap, so that keeping it does
+   * not keep the whole arena (and so the whole tree) alive.
+   *
+   * \param name The name of the child.
+   * \param deprecatedName An alternative name for the child.
+   */
+  std::shared_ptr<const SerializerElement> GetSharedChildOutsideArena(
+      const gd::String &name, const gd::String &deprecatedName = "") const;
+
   /**
    * \brief Get the number of children having a specific name.
    *
@@ -412,7 +471,10 @@ class GD_CORE_API SerializerElement {
 
   /**
    * \brief Return true if the specified child exists.
-   * \note Complexity is O(number of children).
+   * \note Complexity is O(1) on average for elements with many children that
+   * are not arrays, O(number of children) otherwise.
+   * \note Several threads can call this at the same time on the same element,
+   * as long as none of them modifies it (see GetChild).
    * \param name The name of the child to find.
    */
   bool HasChild(const gd::String &name, gd::String deprecatedName = "") const;
@@ -431,6 +493,14 @@ class GD_CORE_API SerializerElement {
       &GetAllChildren() const {
     return children;
   };
+
+  /**
+   * \brief Return the arena used to allocate the children of the element, if
+   * any.
+   */
+  const std::shared_ptr<SerializerElementArena> &GetArena() const {
+    return arena;
+  };
   ///@}
 
   static SerializerElement nullElement;
@@ -442,6 +512,43 @@ class GD_CORE_API SerializerElement {
    */
   void Init(const gd::SerializerElement& other);
 
+  /**
+   * \brief Return the position, in children, of the first child with the
+   * specified name, or gd::String::npos if not found.
+   *
+   * The index of the children names is used if it was built (see
+   * BuildChildrenIndex) and the element is not an array.
+   */
+  std::size_t FindChildPosition(const gd::String& name) const;
+
+  /**
+   * \brief Build the index of the children names.
+   *
+   * This is done when children are added (or when the element is copied), as
+   * soon as there are enough of them, so that reading the element never
+   * modifies it.
+   */
+  void BuildChildrenIndex();
+
+  /**
+   * \brief Return true if all the children are elements of the array (i.e:
+   * named after ConsideredAsArrayOf), so that a child can be accessed
+   * directly from its index.
+   *
+   * The result is computed once and kept until the children or the name of
+   * the array elements are changed. Concurrent readers can compute it at the
+   * same time: they store the same result.
+   */
+  bool AllChildrenAreArrayElements() const;
+
+  /**
+   * \brief Clear the index of the children names.
+   */
+  void ClearChildrenIndex() {
+    childrenIndex.clear();
+    childrenIndexed = false;
+  }
+
   bool valueUndefined;  ///< If true, the element does not have a value.
   SerializerValue elementValue;
 
@@ -452,6 +559,26 @@ class GD_CORE_API SerializerElement {
   mutable gd::String arrayOf;  ///< The name of the children (was useful for XML
                                ///< parsed elements).
   mutable gd::String deprecatedArrayOf;  ///< Alternate name for children
+
+  std::shared_ptr<SerializerElementArena>
+      arena;  ///< If not null, the arena used to allocate children.
+
+  std::unordered_map<gd::String, std::size_t>
+      childrenIndex;  ///< Position of each child in children, by name. Only
+                      ///< used if childrenIndexed is true.
+  bool childrenIndexed;  ///< true if childrenIndex is up to date.
+
+  enum ArrayElementsState : unsigned char {
+    arrayElementsUnknown,
+    arrayElementsAll,
+    arrayElementsNotAll
+  };
+  mutable std::atomic<unsigned char>
+      arrayElementsState;  ///< Cached result of AllChildrenAreArrayElements.
+
+  static constexpr std::size_t
+      childrenIndexThreshold = 16;  ///< The minimum number of children for
+                                    ///< the index of names to be built.
 };
 
 }  // namespace gd
@@ -0,0 +1,46 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+
+#include "GDCore/Serialization/SerializerElementArena.h"
+
+namespace gd {
+
+SerializerElementArena::SerializerElementArena(std::size_t blockSize_)
+    : current(nullptr),
+      end(nullptr),
+      blockSize(blockSize_),
+      allocatedBytes(0),
+      reservedBytes(0) {}
+
+SerializerElementArena::~SerializerElementArena() {
+  for (char* block : blocks) delete[] block;
+}
+
+void* SerializerElementArena::AllocateInNewBlock(std::size_t size,
+                                                 std::size_t alignment) {
+  // Allocations bigger than a block get their own block, so that the
+  // remaining of the current block can still be used.
+  std::size_t newBlockSize = size + alignment;
+  if (newBlockSize <= blockSize) newBlockSize = blockSize;
+
+  char* block = new char[newBlockSize];
+  blocks.push_back(block);
+  reservedBytes += newBlockSize;
+
+  std::size_t padding =
+      (alignment - reinterpret_cast<std::size_t>(block) % alignment) %
+      alignment;
+  char* allocation = block + padding;
+  if (newBlockSize == blockSize) {
+    current = allocation + size;
+    end = block + newBlockSize;
+  }
+
+  allocatedBytes += size;
+  return allocation;
+}
+
+}  // namespace gd
@@ -0,0 +1,122 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+
+#ifndef GDCORE_SERIALIZERELEMENTARENA_H
+#define GDCORE_SERIALIZERELEMENTARENA_H
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace gd {
+
+/**
+ * \brief A bump allocator used to allocate the elements of a tree of
+ * gd::SerializerElement.
+ *
+ * Memory is taken from large blocks and is never given back individually:
+ * all the blocks are freed at once when the arena is destroyed, i.e: when the
+ * last element allocated from it is destroyed.
+ *
+ * \note The arena is not thread safe.
+ *
+ * \see gd::SerializerElement
+ * \see gd::SerializerElementArenaAllocator
+ */
+class GD_CORE_API SerializerElementArena {
+ public:
+  SerializerElementArena(std::size_t blockSize = 64 * 1024);
+  ~SerializerElementArena();
+
+  /**
+   * \brief Allocate \a size bytes, aligned on \a alignment bytes.
+   */
+  void* Allocate(std::size_t size, std::size_t alignment) {
+    std::size_t padding =
+        (alignment - reinterpret_cast<std::size_t>(current) % alignment) %
+        alignment;
+    if (current == nullptr ||
+        static_cast<std::size_t>(end - current) < size + padding)
+      return AllocateInNewBlock(size, alignment);
+
+    char* allocation = current + padding;
+    current = allocation + size;
+    allocatedBytes += size;
+    return allocation;
+  }
+
+  /**
+   * \brief Return the number of bytes allocated from the arena.
+   */
+  std::size_t GetAllocatedBytes() const { return allocatedBytes; }
+
+  /**
+   * \brief Return the number of bytes reserved by the arena (i.e: the total
+   * size of its blocks).
+   */
+  std::size_t GetReservedBytes() const { return reservedBytes; }
+
+ private:
+  SerializerElementArena(const SerializerElementArena&) = delete;
+  SerializerElementArena& operator=(const SerializerElementArena&) = delete;
+
+  void* AllocateInNewBlock(std::size_t size, std::size_t alignment);
+
+  std::vector<char*> blocks;
+  char* current;  ///< The first free byte of the current block.
+  char* end;      ///< The end of the current block.
+  std::size_t blockSize;
+  std::size_t allocatedBytes;
+  std::size_t reservedBytes;
+};
+
+/**
+ * \brief A standard allocator allocating from a gd::SerializerElementArena.
+ *
+ * The allocator keeps the arena alive, so that memory allocated with it stays
+ * valid as long as a copy of the allocator exists (for example in the control
+ * block of a std::shared_ptr created with std::allocate_shared).
+ */
+template <class T>
+class SerializerElementArenaAllocator {
+ public:
+  typedef T value_type;
+
+  SerializerElementArenaAllocator(std::shared_ptr<SerializerElementArena> arena_)
+      : arena(std::move(arena_)) {}
+
+  template <class U>
+  SerializerElementArenaAllocator(
+      const SerializerElementArenaAllocator<U>& other)
+      : arena(other.arena) {}
+
+  T* allocate(std::size_t n) {
+    return static_cast<T*>(arena->Allocate(n * sizeof(T), alignof(T)));
+  }
+
+  void deallocate(T*, std::size_t) {
+    // Memory is freed when the arena is destroyed.
+  }
+
+  template <class U>
+  bool operator==(const SerializerElementArenaAllocator<U>& other) const {
+    return arena == other.arena;
+  }
+
+  template <class U>
+  bool operator!=(const SerializerElementArenaAllocator<U>& other) const {
+    return arena != other.arena;
+  }
+
+ private:
+  template <class U>
+  friend class SerializerElementArenaAllocator;
+
+  std::shared_ptr<SerializerElementArena> arena;
+};
+
+}  // namespace gd
+
+#endif
@@ -15,35 +15,68 @@ namespace gd
 
 constexpr String::size_type String::npos;
 
-String::String() : m_string()
+String::String() : m_string(), m_lengthCache(1)
 {
 
 }
 
-String::String(const char *characters) : m_string()
+String::String(const char *characters) : m_string(), m_lengthCache(npos)
 {
     *this = characters;
 }
 
-String::String(const sf::String &string) : m_string()
+String::String(const sf::String &string) : m_string(), m_lengthCache(npos)
 {
     *this = string;
 }
 
-String::String(const std::u32string &string) : m_string()
+String::String(const std::u32string &string) : m_string(), m_lengthCache(npos)
 {
     *this = string;
 }
 
+String::String(const String &other) :
+    m_string(other.m_string),
+    m_lengthCache(other.m_lengthCache.load(std::memory_order_relaxed))
+{
+
+}
+
+String::String(String &&other) noexcept :
+    m_string(std::move(other.m_string)),
+    m_lengthCache(other.m_lengthCache.load(std::memory_order_relaxed))
+{
+    other.InvalidateLengthCache();
+}
+
 String& String::operator=(const char *characters)
 {
     m_string = std::string(characters);
+    InvalidateLengthCache();
+    return *this;
+}
+
+String& String::operator=(const String &other)
+{
+    m_string = other.m_string;
+    m_lengthCache.store(other.m_lengthCache.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    return *this;
+}
+
+String& String::operator=(String &&other) noexcept
+{
+    if (this == &other)
+        return *this;
+
+    m_string = std::move(other.m_string);
+    m_lengthCache.store(other.m_lengthCache.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    other.InvalidateLengthCache();
     return *this;
 }
 
 String& String::operator=(const sf::String &string)
 {
-    m_string.clear();
+    clear();
 
     //In theory, an UTF8 character can be up to 6 bytes (even if in the current Unicode standard,
     //the last character is 4 bytes long when encoded in UTF8).
@@ -63,7 +96,7 @@ String& String::operator=(const sf::String &string)
 
 String& String::operator=(const std::u32string &string)
 {
-    m_string.clear();
+    clear();
 
     //In theory, an UTF8 character can be up to 6 bytes (even if in the current Unicode standard,
     //the last character is 4 bytes long when encoded in UTF8).
@@ -81,9 +114,16 @@ String& String::operator=(const std::u32string &string)
     return *this;
 }
 
-String::size_type String::size() const
+String::size_type String::ComputeLengthCache() const
 {
-    return std::distance(begin(), end());
+    //Bytes of ASCII characters are lower than 0x80, all the bytes of other
+    //characters (and invalid bytes) are greater.
+    bool isASCII = std::find_if(m_string.begin(), m_string.end(),
+        [](char byte) { return static_cast<unsigned char>(byte) >= 0x80; }) == m_string.end();
+    size_type length = isASCII ? m_string.size() : std::distance(begin(), end());
+
+    SetLengthCache(length, isASCII);
+    return (length << 1) | (isASCII ? 1 : 0);
 }
 
 String::iterator String::begin()
@@ -231,12 +271,16 @@ String& String::ReplaceInvalid( value_type replacement )
     ::utf8::replace_invalid(m_string.begin(), m_string.end(), std::back_inserter(validStr), replacement);
 
     m_string = validStr;
+    InvalidateLengthCache();
 
     return *this;
 }
 
 String::value_type String::operator[]( const String::size_type position ) const
 {
+    if(IsASCII())
+        return static_cast<unsigned char>(m_string[position]);
+
     const_iterator it = begin();
     std::advance(it, position);
     return *it;
@@ -244,7 +288,15 @@ String::value_type String::operator[]( const String::size_type position ) const
 
 String& String::operator+=( const String &other )
 {
+    //Only update the length if it was already known (the length of other is
+    //computed in a time similar to the copy of its characters).
+    size_type cache = m_lengthCache.load(std::memory_order_relaxed);
+    size_type otherCache = cache != npos ? other.GetLengthCache() : npos;
+
     m_string += other.m_string;
+
+    if(cache != npos)
+        SetLengthCache((cache >> 1) + (otherCache >> 1), (cache & otherCache & 1) != 0);
     return *this;
 }
 
@@ -262,21 +314,43 @@ String& String::operator+=( value_type character )
 
 void String::push_back( String::value_type character )
 {
+    size_type cache = m_lengthCache.load(std::memory_order_relaxed);
+
     ::utf8::unchecked::append(character, std::back_inserter(m_string));
+
+    if(cache != npos)
+        SetLengthCache((cache >> 1) + 1, (cache & 1) != 0 && character < 0x80);
 }
 
 void String::pop_back()
 {
+    size_type cache = m_lengthCache.load(std::memory_order_relaxed);
+    if(cache != npos && (cache & 1) != 0)
+    {
+        m_string.pop_back();
+        SetLengthCache((cache >> 1) - 1, true);
+        return;
+    }
+
     m_string.erase((--end()).base(), end().base());
+    InvalidateLengthCache();
 }
 
 String& String::insert( size_type pos, const String &str )
 {
+    if(IsASCII())
+    {
+        m_string.insert( std::min(pos, m_string.size()), str.m_string );
+        InvalidateLengthCache();
+        return *this;
+    }
+
     iterator it = begin();
     std::advance(it, pos);
 
     //Use the real position as bytes using the std::string::iterators
     m_string.insert( std::distance(m_string.begin(), it.base()), str.m_string );
+    InvalidateLengthCache();
 
     return *this;
 }
@@ -284,6 +358,7 @@ String& String::insert( size_type pos, const String &str )
 String& String::replace( iterator i1, iterator i2, const String &str )
 {
     m_string.replace(i1.base(), i2.base(), str.m_string);
+    InvalidateLengthCache();
 
     return *this;
 }
@@ -293,6 +368,13 @@ String& String::replace( String::size_type pos, String::size_type len, const Str
     if(pos > size())
         throw std::out_of_range("[gd::String::replace] starting pos greater than size");
 
+    if(IsASCII())
+    {
+        m_string.replace(pos, len, str.m_string);
+        InvalidateLengthCache();
+        return *this;
+    }
+
     iterator i1 = begin();
     std::advance( i1, pos );
 
@@ -308,11 +390,13 @@ String& String::replace( String::size_type pos, String::size_type len, const Str
 
 String::iterator String::erase( String::iterator first, String::iterator last )
 {
+    InvalidateLengthCache();
     return iterator( m_string.erase( first.base(), last.base() ) );
 }
 
 String::iterator String::erase( String::iterator p )
 {
+    InvalidateLengthCache();
     return iterator( m_string.erase( p.base() ) );
 }
 
@@ -321,6 +405,13 @@ void String::erase( String::size_type pos, String::size_type len )
     if(pos > size())
         throw std::out_of_range("[gd::String::erase] starting pos greater than size");
 
+    if(IsASCII())
+    {
+        m_string.erase(pos, len);
+        SetLengthCache(m_string.size(), true);
+        return;
+    }
+
     iterator i1 = begin();
     std::advance(i1, pos);
 
@@ -386,6 +477,30 @@ String String::LowerCase() const
 
 String String::FindAndReplace(String search, String replacement, bool all) const
 {
+    if(!search.empty())
+    {
+        //The search is done on the UTF8 bytes: as the bytes beginning a character
+        //are different from the other ones, a match is always made of whole characters.
+        //The result is built in a single pass, instead of replacing in place.
+        std::string::size_type pos = m_string.find(search.m_string);
+        if(pos == std::string::npos)
+            return *this;
+
+        gd::String result;
+        std::string::size_type lastPos = 0;
+        do {
+            result.m_string.append(m_string, lastPos, pos - lastPos);
+            result.m_string += replacement.m_string;
+            lastPos = pos + search.m_string.size();
+
+            pos = all ? m_string.find(search.m_string, lastPos) : std::string::npos;
+        } while(pos != std::string::npos);
+        result.m_string.append(m_string, lastPos, std::string::npos);
+        result.InvalidateLengthCache();
+
+        return result;
+    }
+
     gd::String result(*this);
 
     size_type pos, lastPos = 0;
@@ -417,6 +532,7 @@ String& String::Normalize(String::NormForm form)
         newStr = utf8proc_NFKC((unsigned char*)m_string.c_str());
 
     m_string = (char*)newStr;
+    InvalidateLengthCache();
 
     free(newStr);
 
@@ -427,6 +543,16 @@ String String::substr( String::size_type start, String::size_type length ) const
 {
     String str;
 
+    if(IsASCII())
+    {
+        if(start > m_string.size())
+            throw std::out_of_range("[gd::String::substr] starting pos greater than size");
+
+        str.m_string = m_string.substr(start, length);
+        str.SetLengthCache(str.m_string.size(), true);
+        return str;
+    }
+
     const_iterator startIt = begin();
     while(start > 0 && startIt != end())
     {
@@ -444,12 +570,17 @@ String String::substr( String::size_type start, String::size_type length ) const
     }
 
     str.m_string = std::string( startIt.base(), endIt.base() );
+    str.InvalidateLengthCache();
 
     return str;
 }
 
 String::size_type String::find( const String &search, String::size_type pos ) const
 {
+    //Positions as bytes are the same as positions as characters in ASCII strings.
+    if(IsASCII())
+        return pos < m_string.size() ? m_string.find( search.m_string, pos ) : npos;
+
     const_iterator it = begin();
 
     //Move to pos
@@ -488,6 +619,9 @@ String::size_type String::find( const String::value_type search, String::size_ty
 
 String::size_type String::rfind( const String &search, String::size_type pos ) const
 {
+    if(IsASCII())
+        return m_string.rfind( search.m_string, pos < m_string.size() ? pos : std::string::npos );
+
     //Move to pos + 1 (we will then get the last byte of the character at pos)
     const_iterator it = begin();
     std::string::const_iterator baseIt;
@@ -534,6 +668,12 @@ namespace priv
     String::size_type find_first_of( const String &str, const String &match,
         String::size_type startPos, bool not_of )
     {
+        //Bytes of non ASCII characters of match can't be found in an ASCII string,
+        //so the characters can be compared as bytes.
+        if(str.IsASCII())
+            return not_of ? str.Raw().find_first_not_of( match.Raw(), startPos ) :
+                str.Raw().find_first_of( match.Raw(), startPos );
+
         String::const_iterator it = str.begin();
         if(startPos < str.size())
             std::advance( it, startPos );
@@ -566,6 +706,10 @@ namespace priv
     String::size_type find_last_of( const String &str, const String &match,
         String::size_type endPos, bool not_of )
     {
+        if(str.IsASCII())
+            return not_of ? str.Raw().find_last_not_of( match.Raw(), endPos ) :
+                str.Raw().find_last_of( match.Raw(), endPos );
+
         //Temporary store the size to avoid a double call to size()
         String::size_type strSize = str.size();
 
@@ -7,6 +7,7 @@
 #ifndef GDCORE_UTF8_STRING_H
 #define GDCORE_UTF8_STRING_H
 
+#include <atomic>
 #include <functional>
 #include <iostream>
 #include <iterator>
@@ -126,6 +127,10 @@ public:
      */
     String(const sf::String &string);
 
+    String(const String &other);
+
+    String(String &&other) noexcept;
+
 /**
  * \}
  */
@@ -150,6 +155,10 @@ public:
 
     String& operator=(const std::u32string &string);
 
+    String& operator=(const String &other);
+
+    String& operator=(String &&other) noexcept;
+
 /**
  * \}
  */
@@ -166,8 +175,11 @@ public:
 
     /**
      * \brief Returns the string's length.
+     *
+     * The length is computed once (linear on the string size) and then cached
+     * until the string is modified.
      */
-    size_type size() const;
+    size_type size() const { return GetLengthCache() >> 1; }
 
     /**
      * \brief Returns the string's length.
@@ -179,7 +191,16 @@ public:
      *
      * **Iterators :** Obviously, all iterators are invalidated.
      */
-    void clear() { m_string.clear(); }
+    void clear() { m_string.clear(); SetLengthCache(0, true); }
+
+    /**
+     * \brief Returns true if all the characters of the string are ASCII
+     * characters (each one is stored in a single byte).
+     *
+     * Indexing and searching an ASCII string are done directly on the bytes.
+     * Like size(), this is computed once and then cached.
+     */
+    bool IsASCII() const { return (GetLengthCache() & 1) != 0; }
 
 /**
  * \}
@@ -367,15 +388,20 @@ public:
     /**
      * \brief Returns the code point at the specified position
      * \warning This operator has a linear complexity on the character's
-     * position. You should avoid to use it in a loop and use the iterators
-     * provided by this class instead.
+     * position (unless the string is made only of ASCII characters). You should
+     * avoid to use it in a loop and use the iterators provided by this class
+     * instead.
      */
     value_type operator[]( const size_type position ) const;
 
     /**
      * \brief Get the raw UTF8-encoded std::string
+     *
+     * \warning The returned reference must not be kept to modify the string
+     * after other methods of the String have been called, as the cached length
+     * of the string is only reset by this call.
      */
-    std::string& Raw() { return m_string; }
+    std::string& Raw() { InvalidateLengthCache(); return m_string; }
 
     /**
      * \brief Get the raw UTF8-encoded std::string
@@ -633,7 +659,25 @@ public:
  */
 
 private:
+    /**
+     * \brief Return the cached length of the string (shifted by one bit), with
+     * the lowest bit set if the string is made only of ASCII characters.
+     * The cache is computed if the string was modified since the last call.
+     */
+    size_type GetLengthCache() const
+    {
+        size_type cache = m_lengthCache.load(std::memory_order_relaxed);
+        return cache != npos ? cache : ComputeLengthCache();
+    }
+    size_type ComputeLengthCache() const;
+    void SetLengthCache(size_type length, bool isASCII) const
+    {
+        m_lengthCache.store((length << 1) | (isASCII ? 1 : 0), std::memory_order_relaxed);
+    }
+    void InvalidateLengthCache() { m_lengthCache.store(npos, std::memory_order_relaxed); }
+
     std::string m_string; ///< Internal std::string container
+    mutable std::atomic<size_type> m_lengthCache; ///< See GetLengthCache. npos if it must be computed again. Atomic as const Strings can be read by several threads.
 
 };
 
@@ -811,8 +855,10 @@ namespace std
  * \section Performance Performance
  * The UTF8 encoding has the advantage to reduce the RAM consumption compared to UTF16 or UTF32 for strings using a lot
  * of latin characters. But the characters variable length brings some performance issues compared to fixed size encoding.
- * That's why the complexity of each methods is written in their documentation. For instance, the size() method is linear
- * on the string size and so is the operator[]().
+ * That's why the complexity of each methods is written in their documentation. For instance, the operator[]() is linear
+ * on the string size. To limit this cost, the length of the string is cached (so size() is linear only the first time it's
+ * called after a modification) and strings made only of ASCII characters, which are the most common ones, are indexed and
+ * searched directly on their bytes.
  *
  * \section Conversion Conversions from/to other string types
  * The String handles implicit conversion with sf::String (implicit constructor and implicit conversion
@@ -0,0 +1,40 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Tools/Symbol.h"
+#include <mutex>
+#include <unordered_set>
+
+namespace gd {
+
+namespace {
+std::mutex& GetSymbolsMutex() {
+  static std::mutex mutex;
+  return mutex;
+}
+
+std::unordered_set<gd::String>& GetSymbols() {
+  // Never destroyed, so that symbols stay valid during static destruction.
+  static std::unordered_set<gd::String>* symbols =
+      new std::unordered_set<gd::String>;
+  return *symbols;
+}
+}  // namespace
+
+Symbol::Symbol() {
+  static const gd::String* emptyString = Intern("");
+  str = emptyString;
+}
+
+Symbol::Symbol(const gd::String& string) : str(Intern(string)) {}
+
+Symbol::Symbol(const char* string) : str(Intern(string)) {}
+
+const gd::String* Symbol::Intern(const gd::String& string) {
+  std::lock_guard<std::mutex> lock(GetSymbolsMutex());
+  return &*GetSymbols().insert(string).first;
+}
+
+}  // namespace gd
@@ -0,0 +1,100 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDCORE_SYMBOL_H
+#define GDCORE_SYMBOL_H
+#include <functional>
+#include "GDCore/String.h"
+
+namespace gd {
+
+/**
+ * \brief An interned string, used for identifiers taking a limited set of
+ * values, like instruction types or parameter types.
+ *
+ * All the symbols created from equal strings share the same string, stored
+ * once for the whole program. Comparing two symbols is a pointer comparison
+ * and copying a symbol costs nothing.
+ *
+ * Creating a symbol from a string requires a lookup in the (thread-safe)
+ * table of symbols, so constructors are explicit: create the symbols used
+ * for comparisons once, for example as static variables.
+ *
+ * \warning Symbols are never freed: don't use them for strings entered by the
+ * user, like object names or texts.
+ */
+class GD_CORE_API Symbol {
+ public:
+  /**
+   * \brief Construct the empty symbol.
+   */
+  Symbol();
+
+  explicit Symbol(const gd::String& string);
+  explicit Symbol(const char* string);
+
+  Symbol& operator=(const gd::String& string) {
+    str = Intern(string);
+    return *this;
+  }
+  Symbol& operator=(const char* string) {
+    str = Intern(string);
+    return *this;
+  }
+
+  /**
+   * \brief Return the string of the symbol.
+   */
+  const gd::String& GetString() const { return *str; }
+  operator const gd::String&() const { return *str; }
+
+  const char* c_str() const { return str->c_str(); }
+  bool empty() const { return str->empty(); }
+
+  bool operator==(const Symbol& other) const { return str == other.str; }
+  bool operator!=(const Symbol& other) const { return str != other.str; }
+  bool operator==(const gd::String& other) const { return *str == other; }
+  bool operator!=(const gd::String& other) const { return *str != other; }
+  bool operator==(const char* other) const { return *str == other; }
+  bool operator!=(const char* other) const { return *str != other; }
+
+ private:
+  /**
+   * \brief Return the unique string equal to the given string, adding it to
+   * the table of symbols if needed.
+   */
+  static const gd::String* Intern(const gd::String& string);
+
+  const gd::String* str;
+};
+
+inline bool operator==(const gd::String& lhs, const Symbol& rhs) {
+  return rhs == lhs;
+}
+inline bool operator!=(const gd::String& lhs, const Symbol& rhs) {
+  return rhs != lhs;
+}
+inline bool operator==(const char* lhs, const Symbol& rhs) {
+  return rhs == lhs;
+}
+inline bool operator!=(const char* lhs, const Symbol& rhs) {
+  return rhs != lhs;
+}
+
+}  // namespace gd
+
+namespace std {
+/**
+ * std::hash specialization for gd::Symbol
+ */
+template <>
+struct hash<gd::Symbol> {
+  size_t operator()(const gd::Symbol& x) const {
+    return hash<const gd::String*>()(&x.GetString());
+  }
+};
+}  // namespace std
+
+#endif  // GDCORE_SYMBOL_H
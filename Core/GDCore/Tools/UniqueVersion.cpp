@@ -0,0 +1,16 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Tools/UniqueVersion.h"
+#include <atomic>
+
+namespace gd {
+
+std::size_t UniqueVersion::Next() {
+  static std::atomic<std::size_t> lastVersion(0);
+  return ++lastVersion;
+}
+
+}  // namespace gd
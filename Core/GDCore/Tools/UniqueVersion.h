@@ -0,0 +1,50 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDCORE_UNIQUEVERSION_H
+#define GDCORE_UNIQUEVERSION_H
+#include <cstddef>
+
+namespace gd {
+
+/**
+ * \brief A version number, changed each time the owner is modified, that is
+ * unique in the whole program.
+ *
+ * Versions are taken from a single counter, so the version of an object is
+ * never the version of another object, even one that was allocated at the
+ * same address before. A copy gets a new version.
+ *
+ * This can be used to know if something computed from an object (for example
+ * a cached result) is still valid.
+ */
+class GD_CORE_API UniqueVersion {
+ public:
+  UniqueVersion() : version(Next()){};
+  UniqueVersion(const UniqueVersion &) : version(Next()){};
+  UniqueVersion &operator=(const UniqueVersion &) {
+    version = Next();
+    return *this;
+  }
+
+  /**
+   * \brief Get a new version, to be called when the owner is modified.
+   */
+  void Change() { version = Next(); }
+
+  /**
+   * \brief Return the version.
+   */
+  std::size_t Get() const { return version; }
+
+ private:
+  static std::size_t Next();
+
+  std::size_t version;
+};
+
+}  // namespace gd
+
+#endif  // GDCORE_UNIQUEVERSION_H
@@ -6,15 +6,45 @@
 #include <chrono>
 #include <numeric>
 #include "DummyPlatform.h"
+#include "GDCore/Events/CodeGeneration/EventsCodeGenerationContext.h"
+#include "GDCore/Events/CodeGeneration/EventsCodeGenerator.h"
+#include "GDCore/Events/CodeGeneration/ExpressionCodeGenerator.h"
 #include "GDCore/Events/Parsers/ExpressionParser2.h"
+#include "GDCore/Events/Parsers/ExpressionParser2Arena.h"
+#include "GDCore/Events/Parsers/ExpressionParser2Cache.h"
+#include "GDCore/Extensions/Metadata/MetadataProvider.h"
 #include "GDCore/Extensions/Platform.h"
 #include "GDCore/Extensions/PlatformExtension.h"
 #include "GDCore/IDE/Events/ExpressionValidator.h"
+#include "GDCore/Project/Object.h"
 #include "GDCore/Project/Layout.h"
 #include "GDCore/Project/Project.h"
 #include "catch.hpp"
 
-TEST_CASE("ExpressionParser2 - Benchmarks", "[common][events]") {
+namespace {
+/**
+ * \brief Add extensions declaring objects with expressions to the platform,
+ * to check that metadata lookups don't depend on the number of extensions.
+ */
+void AddManyExtensions(gd::Platform &platform, std::size_t extensionsCount) {
+  for (std::size_t i = 0; i < extensionsCount; ++i) {
+    gd::String extensionName = "FillerExtension" + gd::String::From(i);
+    auto extension = std::make_shared<gd::PlatformExtension>();
+    extension->SetExtensionInformation(extensionName, "", "", "", "");
+    extension->AddExpression("GetNumber", "", "", "", "");
+
+    for (std::size_t j = 0; j < 10; ++j) {
+      auto &object = extension->AddObject<gd::Object>(
+          "Object" + gd::String::From(j), "", "", "");
+      object.AddExpression("GetNumber", "", "", "", "");
+      object.AddStrExpression("GetString", "", "", "", "");
+    }
+    platform.AddExtension(extension);
+  }
+}
+}  // namespace
+
+TEST_CASE("ExpressionParser2 - Benchmarks", "[benchmarks][common][events]") {
   gd::Project project;
   gd::Platform platform;
   SetupProjectWithDummyPlatform(project, platform);
@@ -23,7 +53,8 @@ TEST_CASE("ExpressionParser2 - Benchmarks", "[common][events]") {
 
   gd::ExpressionParser2 parser(platform, project, layout1);
 
-  auto parseExpression = [&parser](const gd::String &expression) {
+  auto parseExpression = [](gd::ExpressionParser2 &parser,
+                            const gd::String &expression) {
     auto parseExpressionWithType = [&parser,
                                     &expression](const gd::String &type) {
       auto node = parser.ParseExpression(type, expression);
@@ -63,57 +94,264 @@ TEST_CASE("ExpressionParser2 - Benchmarks", "[common][events]") {
               << " microseconds" << std::endl;
   };
 
+  const gd::String longExpression =
+      "MySpriteObject.X()+MySpriteObject.X()/cos(3.123456789)+"
+      "MySpriteObject.X()+MySpriteObject.X()/cos(3.123456789)+"
+      "MySpriteObject.X()+MySpriteObject.X()+MySpriteObject.X()/"
+      "cos(3.123456789)+"
+      "MySpriteObject.X()+MySpriteObject.X()/cos(3.123456789)+"
+      "MySpriteObject.X()+MySpriteObject.X()+MySpriteObject.X()/"
+      "cos(3.123456789)+"
+      "MySpriteObject.X()+MySpriteObject.X()/cos(3.123456789)+"
+      "MySpriteObject.X()+MySpriteObject.X()+MySpriteObject.X()/"
+      "cos(3.123456789)+"
+      "MySpriteObject.X()+MySpriteObject.X()/cos(3.123456789)+"
+      "MySpriteObject.X()+MySpriteObject.X()+MySpriteObject.X()/"
+      "cos(3.123456789)+"
+      "MySpriteObject.X()+MySpriteObject.X()/cos(3.123456789)+"
+      "MySpriteObject.X()+MySpriteObject.X()+MySpriteObject.X()/"
+      "cos(3.123456789)+"
+      "MySpriteObject.X()+MySpriteObject.X()/cos(3.123456789)+"
+      "MySpriteObject.X()+MySpriteObject.X()+MySpriteObject.X()/"
+      "cos(3.123456789)+"
+      "MySpriteObject.X()+MySpriteObject.X()/cos(3.123456789)+"
+      "MySpriteObject.X()+MySpriteObject.X()+MySpriteObject.X()/"
+      "cos(3.123456789)+"
+      "MySpriteObject.X()+MySpriteObject.X()/cos(3.123456789)+"
+      "MySpriteObject.X()+MySpriteObject.X()+MySpriteObject.X()/"
+      "cos(3.123456789)+"
+      "MySpriteObject.X()+MySpriteObject.X()/cos(3.123456789)+"
+      "MySpriteObject.X()+MySpriteObject.X()+MySpriteObject.X()/"
+      "cos(3.123456789)+"
+      "MySpriteObject.X()+MySpriteObject.X()/cos(3.123456789)+"
+      "MySpriteObject.X()+MySpriteObject.X()+MySpriteObject.X()/"
+      "cos(3.123456789)+"
+      "MySpriteObject.X()+MySpriteObject.X()/cos(3.123456789)+"
+      "MySpriteObject.X()+MySpriteObject.X()+MySpriteObject.X()/"
+      "cos(3.123456789)+"
+      "MySpriteObject.X()+MySpriteObject.X()/cos(3.123456789)+"
+      "MySpriteObject.X()+MySpriteObject.X()+MySpriteObject.X()/"
+      "cos(3.123456789)+"
+      "MySpriteObject.X()+MySpriteObject.X()/cos(3.123456789)+"
+      "MySpriteObject.X()+MySpriteObject.X()+MySpriteObject.X()/"
+      "cos(3.123456789)+"
+      "MySpriteObject.X()+MySpriteObject.X()/"
+      "cos(3.123456789)+MySpriteObject.X()+0";
+
+  auto reportAllocations = [](const gd::String &benchmarkName,
+                               gd::ExpressionParser2 &parser,
+                               const gd::String &expression) {
+    std::size_t initialNodesCount =
+        gd::ExpressionParserArena::GetNodesAllocationsCount();
+    std::size_t initialAllocationsCount =
+        gd::ExpressionParserArena::GetSystemAllocationsCount();
+    {
+      auto node = parser.ParseExpression("number", expression);
+      REQUIRE(node != nullptr);
+    }
+    std::size_t nodesCount =
+        gd::ExpressionParserArena::GetNodesAllocationsCount() -
+        initialNodesCount;
+    std::size_t allocationsCount =
+        gd::ExpressionParserArena::GetSystemAllocationsCount() -
+        initialAllocationsCount;
+    std::cout << benchmarkName << ": " << nodesCount << " nodes, "
+              << allocationsCount << " allocations per parse" << std::endl;
+    if (parser.IsUsingArena())
+      REQUIRE(allocationsCount < nodesCount);
+    else
+      REQUIRE(allocationsCount == nodesCount);
+  };
+
   SECTION("Parse long expression") {
     doBenchmark("Parse long expression", 10, [&]() {
-      REQUIRE_NOTHROW(parseExpression(
-          "MySpriteObject.X()+MySpriteObject.X()/cos(3.123456789)+"
-          "MySpriteObject.X()+MySpriteObject.X()/cos(3.123456789)+"
-          "MySpriteObject.X()+MySpriteObject.X()+MySpriteObject.X()/"
-          "cos(3.123456789)+"
-          "MySpriteObject.X()+MySpriteObject.X()/cos(3.123456789)+"
-          "MySpriteObject.X()+MySpriteObject.X()+MySpriteObject.X()/"
-          "cos(3.123456789)+"
-          "MySpriteObject.X()+MySpriteObject.X()/cos(3.123456789)+"
-          "MySpriteObject.X()+MySpriteObject.X()+MySpriteObject.X()/"
-          "cos(3.123456789)+"
-          "MySpriteObject.X()+MySpriteObject.X()/cos(3.123456789)+"
-          "MySpriteObject.X()+MySpriteObject.X()+MySpriteObject.X()/"
-          "cos(3.123456789)+"
-          "MySpriteObject.X()+MySpriteObject.X()/cos(3.123456789)+"
-          "MySpriteObject.X()+MySpriteObject.X()+MySpriteObject.X()/"
-          "cos(3.123456789)+"
-          "MySpriteObject.X()+MySpriteObject.X()/cos(3.123456789)+"
-          "MySpriteObject.X()+MySpriteObject.X()+MySpriteObject.X()/"
-          "cos(3.123456789)+"
-          "MySpriteObject.X()+MySpriteObject.X()/cos(3.123456789)+"
-          "MySpriteObject.X()+MySpriteObject.X()+MySpriteObject.X()/"
-          "cos(3.123456789)+"
-          "MySpriteObject.X()+MySpriteObject.X()/cos(3.123456789)+"
-          "MySpriteObject.X()+MySpriteObject.X()+MySpriteObject.X()/"
-          "cos(3.123456789)+"
-          "MySpriteObject.X()+MySpriteObject.X()/cos(3.123456789)+"
-          "MySpriteObject.X()+MySpriteObject.X()+MySpriteObject.X()/"
-          "cos(3.123456789)+"
-          "MySpriteObject.X()+MySpriteObject.X()/cos(3.123456789)+"
-          "MySpriteObject.X()+MySpriteObject.X()+MySpriteObject.X()/"
-          "cos(3.123456789)+"
-          "MySpriteObject.X()+MySpriteObject.X()/cos(3.123456789)+"
-          "MySpriteObject.X()+MySpriteObject.X()+MySpriteObject.X()/"
-          "cos(3.123456789)+"
-          "MySpriteObject.X()+MySpriteObject.X()/cos(3.123456789)+"
-          "MySpriteObject.X()+MySpriteObject.X()+MySpriteObject.X()/"
-          "cos(3.123456789)+"
-          "MySpriteObject.X()+MySpriteObject.X()/cos(3.123456789)+"
-          "MySpriteObject.X()+MySpriteObject.X()+MySpriteObject.X()/"
-          "cos(3.123456789)+"
-          "MySpriteObject.X()+MySpriteObject.X()/"
-          "cos(3.123456789)+MySpriteObject.X()+0"));
+      REQUIRE_NOTHROW(parseExpression(parser, longExpression));
+    });
+
+    parser.SetUseArena(false);
+    doBenchmark("Parse long expression (without arena)", 10, [&]() {
+      REQUIRE_NOTHROW(parseExpression(parser, longExpression));
+    });
+  }
+
+  SECTION("Parse 10000 characters expressions") {
+    // The time to parse an expression must be proportional to its length,
+    // including when it contains non ASCII characters.
+    auto makeExpression = [](const gd::String &term,
+                             std::size_t termLength,
+                             const gd::String &end,
+                             std::size_t &length) {
+      gd::String expression;
+      length = 0;
+      while (length < 10000) {
+        expression += term;
+        length += termLength;
+      }
+      expression += end;
+      length += end.size();
+      return expression;
+    };
+
+    std::size_t asciiLength;
+    const gd::String asciiExpression = makeExpression(
+        "MySpriteObject.X()/cos(3.1)+", 28, "0", asciiLength);
+    std::size_t unicodeLength;
+    const gd::String unicodeExpression =
+        makeExpression(u8"\"Ŝömé tèxt\"+ToString(MySpriteObject.X())+",
+                       41,
+                       u8"\"ëñd\"",
+                       unicodeLength);
+    REQUIRE(asciiExpression.size() == asciiLength);
+    REQUIRE(unicodeExpression.size() == unicodeLength);
+
+    doBenchmark("Parse 10000 characters expression", 10, [&]() {
+      auto node = parser.ParseExpression("number", asciiExpression);
+      REQUIRE(node != nullptr);
+      REQUIRE(node->location.GetEndPosition() == asciiLength);
+    });
+    doBenchmark("Parse 10000 characters expression (non ASCII)", 10, [&]() {
+      auto node = parser.ParseExpression("string", unicodeExpression);
+      REQUIRE(node != nullptr);
+      REQUIRE(node->location.GetEndPosition() == unicodeLength);
+    });
+  }
+
+  SECTION("Allocations done while parsing") {
+    const gd::String shortExpression = "MySpriteObject.X() + 1";
+    reportAllocations("Short expression", parser, shortExpression);
+    reportAllocations("Long expression", parser, longExpression);
+
+    parser.SetUseArena(false);
+    reportAllocations(
+        "Short expression (without arena)", parser, shortExpression);
+    reportAllocations("Long expression (without arena)", parser, longExpression);
+  }
+
+  SECTION("Parse repeated expressions") {
+    // Like in a real project, the same expressions are used again and again.
+    std::vector<gd::String> expressions;
+    for (std::size_t i = 0; i < 10000; ++i) {
+      expressions.push_back(
+          "MySpriteObject.GetObjectNumber() + " + gd::String::From(i % 50) +
+          " * MyExtension::GetNumberWith2Params("
+          "MySpriteObject.GetObjectNumber() / 2, \"Text\")");
+    }
+
+    doBenchmark("Parse 10000 repeated expressions", 10, [&]() {
+      std::size_t parsedCount = 0;
+      for (const auto &expression : expressions)
+        parsedCount += parser.ParseExpression("number", expression) != nullptr;
+      REQUIRE(parsedCount == expressions.size());
+    });
+
+    gd::ExpressionParser2Cache cache;
+    doBenchmark("Parse 10000 repeated expressions (cache)", 10, [&]() {
+      std::size_t parsedCount = 0;
+      for (const auto &expression : expressions)
+        parsedCount += cache.ParseExpression(platform,
+                                             project,
+                                             layout1,
+                                             "number",
+                                             expression) != nullptr;
+      REQUIRE(parsedCount == expressions.size());
+    });
+    std::cout << "  Cache hits: " << cache.GetHitsCount()
+              << ", misses: " << cache.GetMissesCount() << " (hit rate: "
+              << 100.0 * cache.GetHitsCount() /
+                     (cache.GetHitsCount() + cache.GetMissesCount())
+              << "%)" << std::endl;
+    REQUIRE(cache.GetMissesCount() == 50);
+    REQUIRE(cache.GetHitsCount() == 10 * expressions.size() - 50);
+
+    gd::EventsCodeGenerator codeGenerator(project, layout1, platform);
+    unsigned int maxDepth = 0;
+    gd::EventsCodeGenerationContext context(&maxDepth);
+    std::size_t generatedCount = 0;
+    doBenchmark("Generate code for 10000 repeated expressions", 1, [&]() {
+      for (const auto &expression : expressions) {
+        gd::String code = gd::ExpressionCodeGenerator::GenerateExpressionCode(
+            codeGenerator, context, "number", expression);
+        generatedCount += code.find("getNumberWith2Params") != gd::String::npos;
+      }
+    });
+    REQUIRE(generatedCount == expressions.size());
+    const auto &codeGenerationCache = codeGenerator.GetExpressionParserCache();
+    std::cout << "  Cache hits: " << codeGenerationCache.GetHitsCount()
+              << ", misses: " << codeGenerationCache.GetMissesCount()
+              << std::endl;
+    REQUIRE(codeGenerationCache.GetMissesCount() == 50);
+    REQUIRE(codeGenerationCache.GetHitsCount() == expressions.size() - 50);
+  }
+
+  SECTION("Parse long expression, with many extensions loaded") {
+    gd::Project projectWithManyExtensions;
+    gd::Platform platformWithManyExtensions;
+    platformWithManyExtensions.EnableExtensionLoadingLogs(false);
+    AddManyExtensions(platformWithManyExtensions, 100);
+    SetupProjectWithDummyPlatform(projectWithManyExtensions,
+                                  platformWithManyExtensions);
+    auto &layout = projectWithManyExtensions.InsertNewLayout("Layout1", 0);
+    layout.InsertNewObject(projectWithManyExtensions,
+                           "MyExtension::Sprite",
+                           "MySpriteObject",
+                           0);
+    gd::ExpressionParser2 parserWithManyExtensions(
+        platformWithManyExtensions, projectWithManyExtensions, layout);
+
+    doBenchmark("Parse long expression (100 extensions loaded)", 10, [&]() {
+      REQUIRE_NOTHROW(
+          parseExpression(parserWithManyExtensions, longExpression));
+    });
+    doBenchmark("Get 10000 metadata (100 extensions loaded)", 10, [&]() {
+      std::size_t foundCount = 0;
+      for (std::size_t i = 0; i < 1000; ++i) {
+        gd::String objectType =
+            "FillerExtension" + gd::String::From(i % 100) + "::Object3";
+        foundCount +=
+            !gd::MetadataProvider::IsBadExpressionMetadata(
+                gd::MetadataProvider::GetObjectExpressionMetadata(
+                    platformWithManyExtensions, objectType, "GetNumber"));
+        foundCount +=
+            !gd::MetadataProvider::IsBadExpressionMetadata(
+                gd::MetadataProvider::GetObjectStrExpressionMetadata(
+                    platformWithManyExtensions, objectType, "GetString"));
+        foundCount +=
+            !gd::MetadataProvider::IsBadExpressionMetadata(
+                gd::MetadataProvider::GetObjectExpressionMetadata(
+                    platformWithManyExtensions, objectType, "X"));
+        foundCount +=
+            !gd::MetadataProvider::IsBadExpressionMetadata(
+                gd::MetadataProvider::GetExpressionMetadata(
+                    platformWithManyExtensions,
+                    "FillerExtension" + gd::String::From(i % 100) +
+                        "::GetNumber"));
+        foundCount +=
+            !gd::MetadataProvider::IsBadExpressionMetadata(
+                gd::MetadataProvider::GetExpressionMetadata(
+                    platformWithManyExtensions, "cos"));
+        foundCount += gd::MetadataProvider::HasObjectExpression(
+            platformWithManyExtensions, objectType, "GetNumber");
+        foundCount += gd::MetadataProvider::HasAction(
+            platformWithManyExtensions, "MyExtension::DoSomething");
+        foundCount += gd::MetadataProvider::GetExtensionAndActionMetadata(
+                          platformWithManyExtensions, "MyExtension::DoSomething")
+                          .GetMetadata()
+                          .GetFullName() == "Do something";
+        foundCount += gd::MetadataProvider::GetObjectMetadata(
+                          platformWithManyExtensions, objectType)
+                          .GetName() == objectType;
+        foundCount += gd::MetadataProvider::GetBehaviorMetadata(
+                          platformWithManyExtensions, "MyExtension::MyBehavior")
+                          .GetName() == "MyExtension::MyBehavior";
+      }
+      REQUIRE(foundCount == 8000);
     });
   }
 
   SECTION("Parse long expression") {
     doBenchmark("Long identifier", 100, [&]() {
       REQUIRE_NOTHROW(parseExpression(
+          parser,
           "MyLoooooongIdentifierThatNeverStoooooopsAndContinueAgainAndAgainAndA"
           "gainAndAgainAndAgainAndAgainAndAgainAndAgainAndAgainAndAgainAndAgain"
           "AndAgainAndAgainAndAgainAndAgainAndAgainAndAgainAndAgain"));
@@ -0,0 +1,120 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Events/Parsers/ExpressionParser2Cache.h"
+#include "DummyPlatform.h"
+#include "GDCore/Events/Parsers/ExpressionParser2.h"
+#include "GDCore/Events/Parsers/ExpressionParser2Node.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Extensions/PlatformExtension.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Project.h"
+#include "catch.hpp"
+
+TEST_CASE("ExpressionParser2Cache", "[common][events]") {
+  gd::Project project;
+  gd::Platform platform;
+  SetupProjectWithDummyPlatform(project, platform);
+  auto &layout1 = project.InsertNewLayout("Layout1", 0);
+  layout1.InsertNewObject(project, "MyExtension::Sprite", "MySpriteObject", 0);
+
+  gd::ExpressionParser2Cache cache;
+
+  SECTION("Same expressions") {
+    auto node = cache.ParseExpression(
+        platform, project, layout1, "number", "MySpriteObject.X() + 1");
+    REQUIRE(node != nullptr);
+    REQUIRE(dynamic_cast<gd::OperatorNode *>(node.get()) != nullptr);
+    REQUIRE(cache.GetMissesCount() == 1);
+    REQUIRE(cache.GetHitsCount() == 0);
+
+    REQUIRE(cache.ParseExpression(platform,
+                                  project,
+                                  layout1,
+                                  "number",
+                                  "MySpriteObject.X() + 1") == node);
+    REQUIRE(cache.GetMissesCount() == 1);
+    REQUIRE(cache.GetHitsCount() == 1);
+    REQUIRE(cache.GetEntriesCount() == 1);
+  }
+
+  SECTION("Different types, expressions or objects containers") {
+    auto node = cache.ParseExpression(
+        platform, project, layout1, "number", "MySpriteObject.X()");
+    REQUIRE(cache.ParseExpression(
+                platform, project, layout1, "string", "MySpriteObject.X()") !=
+            node);
+    REQUIRE(cache.ParseExpression(
+                platform, project, layout1, "number", "MySpriteObject.Y()") !=
+            node);
+    REQUIRE(cache.ParseExpression(platform,
+                                  project,
+                                  layout1,
+                                  "objectvar",
+                                  "MySpriteObject.X()",
+                                  "MySpriteObject") != node);
+
+    auto &layout2 = project.InsertNewLayout("Layout2", 1);
+    REQUIRE(cache.ParseExpression(
+                platform, project, layout2, "number", "MySpriteObject.X()") !=
+            node);
+    REQUIRE(cache.GetMissesCount() == 5);
+    REQUIRE(cache.GetHitsCount() == 0);
+  }
+
+  SECTION("Objects, groups or extensions changed") {
+    auto node = cache.ParseExpression(
+        platform, project, layout1, "number", "MySpriteObject.X()");
+
+    layout1.InsertNewObject(project, "MyExtension::Sprite", "MyOtherObject", 1);
+    auto nodeAfterObjectAdded = cache.ParseExpression(
+        platform, project, layout1, "number", "MySpriteObject.X()");
+    REQUIRE(nodeAfterObjectAdded != node);
+
+    layout1.GetObjectGroups().InsertNew("MyGroup");
+    auto nodeAfterGroupAdded = cache.ParseExpression(
+        platform, project, layout1, "number", "MySpriteObject.X()");
+    REQUIRE(nodeAfterGroupAdded != nodeAfterObjectAdded);
+
+    project.InsertNewObject(
+        project, "MyExtension::Sprite", "MyGlobalObject", 0);
+    auto nodeAfterGlobalObjectAdded = cache.ParseExpression(
+        platform, project, layout1, "number", "MySpriteObject.X()");
+    REQUIRE(nodeAfterGlobalObjectAdded != nodeAfterGroupAdded);
+
+    auto extension = std::make_shared<gd::PlatformExtension>();
+    extension->SetExtensionInformation("MyOtherExtension", "", "", "", "");
+    platform.AddExtension(extension);
+    REQUIRE(cache.ParseExpression(platform,
+                                  project,
+                                  layout1,
+                                  "number",
+                                  "MySpriteObject.X()") !=
+            nodeAfterGlobalObjectAdded);
+    REQUIRE(cache.GetHitsCount() == 0);
+
+    cache.Clear();
+    REQUIRE(cache.GetEntriesCount() == 0);
+  }
+
+  SECTION("Least recently used expressions are removed") {
+    gd::ExpressionParser2Cache smallCache(2);
+    auto node1 =
+        smallCache.ParseExpression(platform, project, layout1, "number", "1");
+    auto node2 =
+        smallCache.ParseExpression(platform, project, layout1, "number", "2");
+    REQUIRE(smallCache.ParseExpression(
+                platform, project, layout1, "number", "1") == node1);
+
+    smallCache.ParseExpression(platform, project, layout1, "number", "3");
+    REQUIRE(smallCache.GetEntriesCount() == 2);
+    REQUIRE(smallCache.ParseExpression(
+                platform, project, layout1, "number", "1") == node1);
+    REQUIRE(smallCache.ParseExpression(
+                platform, project, layout1, "number", "2") != node2);
+    REQUIRE(smallCache.GetHitsCount() == 2);
+    REQUIRE(smallCache.GetMissesCount() == 4);
+  }
+}
@@ -0,0 +1,113 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering MetadataProvider of GDevelop Core.
+ */
+#include "GDCore/Extensions/Metadata/MetadataProvider.h"
+#include "DummyPlatform.h"
+#include "GDCore/Extensions/Metadata/BehaviorMetadata.h"
+#include "GDCore/Extensions/Metadata/ExpressionMetadata.h"
+#include "GDCore/Extensions/Metadata/ObjectMetadata.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Extensions/PlatformExtension.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Project/Project.h"
+#include "catch.hpp"
+
+TEST_CASE("MetadataProvider", "[common]") {
+  gd::Project project;
+  gd::Platform platform;
+  SetupProjectWithDummyPlatform(project, platform);
+
+  SECTION("Find metadata") {
+    REQUIRE(gd::MetadataProvider::HasAction(platform,
+                                            "MyExtension::DoSomething"));
+    REQUIRE(!gd::MetadataProvider::HasAction(platform, "DoSomething"));
+    REQUIRE(gd::MetadataProvider::GetExtensionAndActionMetadata(
+                platform, "MyExtension::DoSomething")
+                .GetExtension()
+                .GetName() == "MyExtension");
+    REQUIRE(gd::MetadataProvider::GetObjectMetadata(platform,
+                                                    "MyExtension::Sprite")
+                .GetName() == "MyExtension::Sprite");
+    REQUIRE(gd::MetadataProvider::GetBehaviorMetadata(
+                platform, "MyExtension::MyBehavior")
+                .GetName() == "MyExtension::MyBehavior");
+    REQUIRE(gd::MetadataProvider::HasObjectExpression(
+        platform, "MyExtension::Sprite", "GetObjectNumber"));
+    REQUIRE(!gd::MetadataProvider::HasObjectExpression(
+        platform, "MyExtension::Sprite", "GetNumber"));
+    REQUIRE(gd::MetadataProvider::IsBadExpressionMetadata(
+        gd::MetadataProvider::GetExpressionMetadata(platform,
+                                                    "MyExtension::Unknown")));
+  }
+
+  SECTION("Find metadata of the base object") {
+    auto baseObjectExtension = platform.GetExtension("BuiltinObject");
+    baseObjectExtension->GetObjectMetadata("").AddExpression(
+        "BaseExpression", "", "", "", "");
+    platform.AddExtension(baseObjectExtension);
+
+    REQUIRE(gd::MetadataProvider::HasObjectExpression(
+        platform, "MyExtension::Sprite", "BaseExpression"));
+    REQUIRE(gd::MetadataProvider::GetExtensionAndObjectExpressionMetadata(
+                platform, "MyExtension::Sprite", "BaseExpression")
+                .GetExtension()
+                .GetName() == "BuiltinObject");
+  }
+
+  SECTION("Extensions added or removed") {
+    REQUIRE(gd::MetadataProvider::HasExpression(platform,
+                                                "MyExtension::GetNumber"));
+    REQUIRE(!gd::MetadataProvider::HasExpression(
+        platform, "MyOtherExtension::GetNumber"));
+
+    auto otherExtension = std::make_shared<gd::PlatformExtension>();
+    otherExtension->SetExtensionInformation(
+        "MyOtherExtension", "", "", "", "");
+    otherExtension->AddExpression("GetNumber", "", "", "", "");
+    platform.AddExtension(otherExtension);
+    REQUIRE(gd::MetadataProvider::HasExpression(
+        platform, "MyOtherExtension::GetNumber"));
+
+    platform.RemoveExtension("MyExtension");
+    REQUIRE(!gd::MetadataProvider::HasExpression(platform,
+                                                 "MyExtension::GetNumber"));
+    REQUIRE(gd::MetadataProvider::GetObjectMetadata(platform,
+                                                    "MyExtension::Sprite")
+                .GetName() == "");
+    REQUIRE(gd::MetadataProvider::HasExpression(
+        platform, "MyOtherExtension::GetNumber"));
+  }
+
+  SECTION("Metadata added to extensions already added") {
+    auto extension = platform.GetExtension("MyExtension");
+    REQUIRE(!gd::MetadataProvider::HasExpression(
+        platform, "MyExtension::GetOtherNumber"));
+    REQUIRE(!gd::MetadataProvider::HasAction(platform,
+                                             "MyExtension::DoSomethingElse"));
+    REQUIRE(!gd::MetadataProvider::HasObjectExpression(
+        platform, "MyExtension::Sprite", "GetOtherObjectNumber"));
+    REQUIRE(!gd::MetadataProvider::HasBehaviorAction(
+        platform, "MyExtension::MyBehavior", "MyExtension::DoBehaviorThing"));
+
+    extension->AddExpression("GetOtherNumber", "", "", "", "");
+    extension->AddAction("DoSomethingElse", "", "", "", "", "", "");
+    extension->GetObjectMetadata("MyExtension::Sprite")
+        .AddExpression("GetOtherObjectNumber", "", "", "", "");
+    extension->GetBehaviorMetadata("MyExtension::MyBehavior")
+        .AddAction("DoBehaviorThing", "", "", "", "", "", "");
+
+    REQUIRE(gd::MetadataProvider::HasExpression(
+        platform, "MyExtension::GetOtherNumber"));
+    REQUIRE(gd::MetadataProvider::HasAction(platform,
+                                            "MyExtension::DoSomethingElse"));
+    REQUIRE(gd::MetadataProvider::HasObjectExpression(
+        platform, "MyExtension::Sprite", "GetOtherObjectNumber"));
+    REQUIRE(gd::MetadataProvider::HasBehaviorAction(
+        platform, "MyExtension::MyBehavior", "MyExtension::DoBehaviorThing"));
+  }
+}
@@ -0,0 +1,147 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the snapshots of projects (see
+ * gd::Project::InitAsSnapshotOf).
+ */
+#include <map>
+#include <memory>
+
+#include "DummyPlatform.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Extensions/PlatformExtension.h"
+#include "GDCore/IDE/Project/ArbitraryResourceWorker.h"
+#include "GDCore/IDE/Project/ResourcesRenamer.h"
+#include "GDCore/IDE/ProjectStripper.h"
+#include "GDCore/Project/ExternalEvents.h"
+#include "GDCore/Project/ExternalLayout.h"
+#include "GDCore/Project/InitialInstancesContainer.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Project.h"
+#include "catch.hpp"
+
+namespace {
+
+/**
+ * An extension exposing the sound played by its "PlaySound" action.
+ */
+class SoundExtension : public gd::PlatformExtension {
+ public:
+  SoundExtension() {
+    SetExtensionInformation("SoundExtension", "Sound extension", "", "", "");
+    AddAction("PlaySound", "Play a sound", "", "", "", "", "")
+        .AddParameter("soundfile", "Sound")
+        .SetFunctionName("playSound");
+  }
+
+  virtual void ExposeActionsResources(
+      gd::Instruction& action, gd::ArbitraryResourceWorker& worker) override {
+    if (action.GetType() == "SoundExtension::PlaySound") {
+      gd::String parameter = action.GetParameter(0).GetPlainString();
+      worker.ExposeAudio(parameter);
+      action.SetParameter(0, parameter);
+    }
+  }
+};
+
+void AddPlaySoundAction(gd::EventsList& events, const gd::String& sound) {
+  gd::StandardEvent event;
+  gd::Instruction action("SoundExtension::PlaySound");
+  action.SetParametersCount(1);
+  action.SetParameter(0, sound);
+  event.GetActions().Insert(action);
+  events.InsertEvent(event);
+}
+
+}  // namespace
+
+TEST_CASE("ProjectSnapshot", "[common]") {
+  gd::Platform platform;
+  gd::Project project;
+  SetupProjectWithDummyPlatform(project, platform);
+  platform.AddExtension(std::make_shared<SoundExtension>());
+  project.GetUsedExtensions().push_back("SoundExtension");
+
+  gd::Layout& layout = project.InsertNewLayout("Scene", 0);
+  AddPlaySoundAction(layout.GetEvents(), "Sound.wav");
+  layout.GetInitialInstances().InsertNewInitialInstance().SetObjectName(
+      "MyObject");
+
+  gd::ExternalEvents& externalEvents =
+      project.InsertNewExternalEvents("External events", 0);
+  AddPlaySoundAction(externalEvents.GetEvents(), "Sound.wav");
+
+  gd::ExternalLayout& externalLayout =
+      project.InsertNewExternalLayout("External layout", 0);
+  externalLayout.GetInitialInstances().InsertNewInitialInstance();
+
+  gd::Project snapshot;
+  snapshot.InitAsSnapshotOf(project);
+  const gd::Project& constSnapshot = snapshot;
+
+  SECTION("Events and instances are shared") {
+    REQUIRE(snapshot.GetLayoutsCount() == 1);
+    REQUIRE(&snapshot.GetLayout(0) != &layout);
+    REQUIRE(&constSnapshot.GetLayout(0).GetEvents() == &layout.GetEvents());
+    REQUIRE(&constSnapshot.GetLayout(0).GetInitialInstances() ==
+            &layout.GetInitialInstances());
+    REQUIRE(&constSnapshot.GetExternalEvents(0).GetEvents() ==
+            &externalEvents.GetEvents());
+    REQUIRE(&constSnapshot.GetExternalLayout(0).GetInitialInstances() ==
+            &externalLayout.GetInitialInstances());
+  }
+
+  SECTION("Events and instances are copied when modified") {
+    gd::Layout& snapshotLayout = snapshot.GetLayout(0);
+    REQUIRE(snapshotLayout.HasSharedEvents());
+    snapshotLayout.GetEvents().RemoveEvent(0);
+    REQUIRE(!snapshotLayout.HasSharedEvents());
+    REQUIRE(snapshotLayout.GetEvents().GetEventsCount() == 0);
+    REQUIRE(layout.GetEvents().GetEventsCount() == 1);
+
+    snapshotLayout.GetInitialInstances().InsertNewInitialInstance();
+    REQUIRE(snapshotLayout.GetInitialInstances().GetInstancesCount() == 2);
+    REQUIRE(layout.GetInitialInstances().GetInstancesCount() == 1);
+
+    snapshot.GetExternalLayout(0).GetInitialInstances().Clear();
+    REQUIRE(externalLayout.GetInitialInstances().GetInstancesCount() == 1);
+  }
+
+  SECTION("Stripping the snapshot does not change the project") {
+    gd::ProjectStripper::StripProjectForExport(snapshot);
+    REQUIRE(snapshot.GetLayout(0).GetEvents().GetEventsCount() == 0);
+    REQUIRE(snapshot.GetExternalEventsCount() == 0);
+    REQUIRE(layout.GetEvents().GetEventsCount() == 1);
+    REQUIRE(project.GetExternalEventsCount() == 1);
+  }
+
+  SECTION("Resources of shared events are only copied when renamed") {
+    std::map<gd::String, gd::String> unrelatedNames = {{"Other.wav", "A.wav"}};
+    gd::ResourcesRenamer unrelatedRenamer(unrelatedNames);
+    snapshot.ExposeResources(unrelatedRenamer);
+    REQUIRE(snapshot.GetLayout(0).HasSharedEvents());
+    REQUIRE(snapshot.GetExternalEvents(0).HasSharedEvents());
+
+    std::map<gd::String, gd::String> newNames = {{"Sound.wav", "New.wav"}};
+    gd::ResourcesRenamer renamer(newNames);
+    snapshot.ExposeResources(renamer);
+    REQUIRE(!snapshot.GetLayout(0).HasSharedEvents());
+    REQUIRE(!snapshot.GetExternalEvents(0).HasSharedEvents());
+
+    auto getSound = [](const gd::EventsList& events) {
+      const auto& event =
+          dynamic_cast<const gd::StandardEvent&>(events.GetEvent(0));
+      return event.GetActions().Get(0).GetParameter(0).GetPlainString();
+    };
+    REQUIRE(getSound(constSnapshot.GetLayout(0).GetEvents()) == "New.wav");
+    REQUIRE(getSound(constSnapshot.GetExternalEvents(0).GetEvents()) ==
+            "New.wav");
+    REQUIRE(getSound(layout.GetEvents()) == "Sound.wav");
+    REQUIRE(getSound(externalEvents.GetEvents()) == "Sound.wav");
+  }
+}
@@ -7,14 +7,23 @@
  * @file Tests covering serialization to JSON.
  */
 #include "GDCore/Serialization/Serializer.h"
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <thread>
 #include "GDCore/CommonTools.h"
 #include "GDCore/Events/Builtin/StandardEvent.h"
 #include "GDCore/Events/Event.h"
 #include "GDCore/Events/EventsList.h"
 #include "GDCore/Events/Serialization.h"
+#include "GDCore/Project/ExternalEvents.h"
+#include "GDCore/Project/ExternalLayout.h"
+#include "GDCore/Project/InitialInstance.h"
+#include "GDCore/Project/InitialInstancesContainer.h"
 #include "GDCore/Project/Layout.h"
 #include "GDCore/Project/Project.h"
 #include "GDCore/Project/Variable.h"
+#include "GDCore/Serialization/SerializerElementArena.h"
 #include "GDCore/Tools/SystemStats.h"
 #include "GDCore/Tools/VersionWrapper.h"
 #include "catch.hpp"
@@ -81,6 +90,28 @@ TEST_CASE("SerializerElement", "[common]") {
     REQUIRE(element.GetChild(2).GetDoubleValue() == 45.6);
   }
 
+  SECTION("Arrays with children having other names") {
+    SerializerElement element;
+    element.AddChild("other").SetStringValue("ignored");
+    element.AddChild("namedElement").SetStringValue("value123");
+    element.AddChild("oldNamedElement").SetStringValue("value456");
+    element.ConsiderAsArrayOf("namedElement", "oldNamedElement");
+
+    REQUIRE(element.GetChildrenCount() == 2);
+    REQUIRE(element.GetChild(0).GetStringValue() == "value123");
+    REQUIRE(element.GetChild(1).GetStringValue() == "value456");
+
+    element.RemoveChild("other");
+    element.AddChild("namedElement").SetDoubleValue(45.6);
+    REQUIRE(element.GetChildrenCount() == 3);
+    REQUIRE(element.GetChild(0).GetStringValue() == "value123");
+    REQUIRE(element.GetChild(2).GetDoubleValue() == 45.6);
+
+    element.ConsiderAsArrayOf("namedElement");
+    REQUIRE(element.GetChildrenCount() == 2);
+    REQUIRE(element.GetChild(1).GetDoubleValue() == 45.6);
+  }
+
   SECTION("(Deprecated) attributes") {
     SerializerElement element;
     element.AddChild("child1").SetStringValue("value123");
@@ -99,6 +130,75 @@ TEST_CASE("SerializerElement", "[common]") {
     REQUIRE(element.GetStringAttribute("attr1") == "attr123");
     REQUIRE(element.GetStringAttribute("child1") == "value456");
   }
+
+  SECTION("Many children") {
+    SerializerElement element;
+    for (int i = 0; i < 100; ++i)
+      element.AddChild("child" + gd::String::From(i)).SetIntValue(i);
+
+    REQUIRE(element.GetChild("child0").GetIntValue() == 0);
+    REQUIRE(element.GetChild("child42").GetIntValue() == 42);
+    REQUIRE(element.GetChild("child99").GetIntValue() == 99);
+    REQUIRE(element.GetChild("child100", 0, "child50").GetIntValue() == 50);
+    REQUIRE(element.HasChild("child100") == false);
+    REQUIRE(element.HasChild("child100", "child7") == true);
+
+    // Adding an existing child returns it.
+    element.AddChild("child42").SetIntValue(4242);
+    REQUIRE(element.GetAllChildren().size() == 100);
+    REQUIRE(element.GetChild("child42").GetIntValue() == 4242);
+
+    // Removing children keeps the others accessible.
+    element.RemoveChild("child10");
+    element.RemoveChild("child0");
+    element.RemoveChild("child1000");
+    REQUIRE(element.GetAllChildren().size() == 98);
+    REQUIRE(element.HasChild("child10") == false);
+    REQUIRE(element.HasChild("child0") == false);
+    REQUIRE(element.GetChild("child11").GetIntValue() == 11);
+    REQUIRE(element.GetChild("child99").GetIntValue() == 99);
+    REQUIRE(element.GetAllChildren()[0].first == "child1");
+
+    // Children are still stored in their insertion order.
+    element.AddChild("child0").SetIntValue(0);
+    REQUIRE(element.GetAllChildren().back().first == "child0");
+    REQUIRE(element.GetChild("child0").GetIntValue() == 0);
+
+    SerializerElement copiedElement = element;
+    REQUIRE(copiedElement.GetChild("child0").GetIntValue() == 0);
+    REQUIRE(copiedElement.GetChild("child98").GetIntValue() == 98);
+    REQUIRE(copiedElement.HasChild("child10") == false);
+  }
+
+  SECTION("Reading children from several threads") {
+    SerializerElement element;
+    for (int i = 0; i < 100; ++i)
+      element.AddChild("child" + gd::String::From(i)).SetIntValue(i);
+    SerializerElement& array = element.AddChild("array");
+    array.ConsiderAsArrayOf("item");
+    for (int i = 0; i < 100; ++i) array.AddChild("item").SetIntValue(i);
+
+    const SerializerElement& constElement = element;
+    std::vector<std::thread> threads;
+    std::vector<int> errors(4, 0);
+    for (std::size_t t = 0; t < errors.size(); ++t) {
+      threads.emplace_back([&constElement, &errors, t]() {
+        for (int i = 0; i < 100; ++i) {
+          const SerializerElement& array = constElement.GetChild("array");
+          array.ConsiderAsArrayOf("item");
+          if (!constElement.HasChild("child" + gd::String::From(i)) ||
+              constElement.GetChild("child" + gd::String::From(i))
+                      .GetIntValue() != i ||
+              array.GetChildrenCount() != 100 ||
+              array.GetChild(i).GetIntValue() != i)
+            errors[t]++;
+        }
+      });
+    }
+    for (auto& thread : threads) thread.join();
+
+    for (int threadErrors : errors) REQUIRE(threadErrors == 0);
+  }
 }
 
 TEST_CASE("Serializer", "[common]") {
@@ -144,6 +244,159 @@ TEST_CASE("Serializer", "[common]") {
     REQUIRE(json == originalJSON);
   }
 
+  SECTION("Unicode escape sequences") {
+    gd::String originalJSON =
+        "{\"a\": \"\\u00e9t\\u00C9\",\"b\": \"\\ud83d\\ude00\",\"c\": "
+        "\"\\u0041\\/\"}";
+    SerializerElement element = Serializer::FromJSON(originalJSON);
+    REQUIRE(element.GetChild("a").GetStringValue() == u8"étÉ");
+    REQUIRE(element.GetChild("b").GetStringValue() == u8"\U0001F600");
+    REQUIRE(element.GetChild("c").GetStringValue() == "A/");
+  }
+
+  SECTION("Blank characters") {
+    gd::String originalJSON =
+        "\r\n{\t\"a\" :\r\n [ 1 , \"2\" ,\n{ } ] ,\t\"b\":\ttrue\r\n}  ";
+    SerializerElement element = Serializer::FromJSON(originalJSON);
+    REQUIRE(element.GetChild("a").GetChildrenCount() == 3);
+    REQUIRE(element.GetChild("a").GetChild(0).GetDoubleValue() == 1);
+    REQUIRE(element.GetChild("a").GetChild(1).GetStringValue() == "2");
+    REQUIRE(element.GetChild("b").GetBoolValue() == true);
+
+    gd::String json = Serializer::ToJSON(element);
+    REQUIRE(json == "{\"a\": [1,\"2\",{}],\"b\": true}");
+  }
+
+  SECTION("Numbers") {
+    SerializerElement element = Serializer::FromJSON(
+        gd::String("[0,-12,3.5,-0.25,1e3,12345678901234567890]"));
+    REQUIRE(element.GetChild(0).GetDoubleValue() == 0);
+    REQUIRE(element.GetChild(1).GetDoubleValue() == -12);
+    REQUIRE(element.GetChild(2).GetDoubleValue() == 3.5);
+    REQUIRE(element.GetChild(3).GetDoubleValue() == -0.25);
+    REQUIRE(element.GetChild(4).GetDoubleValue() == 1000);
+    REQUIRE(element.GetChild(5).GetDoubleValue() == 12345678901234567890.0);
+  }
+
+  SECTION("Invalid JSON") {
+    SerializerElement element = Serializer::FromJSON(
+        gd::String("{\"a\": 1,\"b\": \"unterminated"));
+    REQUIRE(element.GetChild("a").GetDoubleValue() == 1);
+
+    SerializerElement element2 =
+        Serializer::FromJSON(gd::String("{\"a\" 1}"));
+    REQUIRE(element2.HasChild("a") == false);
+  }
+
+  SECTION("Compact JSON and JSON written in a stream") {
+    gd::String originalJSON =
+        "{\"a\": [1,2.5,{}],\"b\": {\"c\": \"\\u0001 \\\"d\\\"\"}}";
+    SerializerElement element = Serializer::FromJSON(originalJSON);
+    REQUIRE(Serializer::ToJSON(element) == originalJSON);
+    REQUIRE(Serializer::ToJSON(element, true) ==
+            "{\"a\":[1,2.5,{}],\"b\":{\"c\":\"\\u0001 \\\"d\\\"\"}}");
+
+    std::ostringstream stream;
+    Serializer::ToJSON(element, stream);
+    REQUIRE(stream.str() == originalJSON.Raw());
+
+    std::ostringstream compactStream;
+    Serializer::ToJSON(element, compactStream, true);
+    REQUIRE(compactStream.str() == Serializer::ToJSON(element, true).Raw());
+  }
+
+  SECTION("Binary format") {
+    gd::String originalJSON =
+        u8"{\"a\": [1,-2.5,{},\"été\"],\"b\": {\"c\": \"\\\"d\\\"\",\"e\": "
+        u8"false},\"f\": 123456,\"g\": -0.125,\"h\": \"\"}";
+    SerializerElement element = Serializer::FromJSON(originalJSON);
+    element.GetChild("b").SetAttribute("attr", 42);
+    element.GetChild("b").SetAttribute("attr2", gd::String("hello"));
+
+    std::string binary = Serializer::ToBinary(element);
+    REQUIRE(Serializer::IsBinary(binary.data(), binary.size()));
+    REQUIRE(Serializer::IsBinary(originalJSON.c_str(),
+                                 originalJSON.Raw().size()) == false);
+
+    SerializerElement binaryElement = Serializer::FromBinary(binary);
+    REQUIRE(binaryElement.GetChild("b").GetIntAttribute("attr") == 42);
+    REQUIRE(binaryElement.GetChild("b").GetStringAttribute("attr2") ==
+            "hello");
+    REQUIRE(binaryElement.GetChild("a").ConsideredAsArray());
+    REQUIRE(binaryElement.GetChild("a").GetChild(3).GetStringValue() ==
+            u8"été");
+    REQUIRE(binaryElement.GetChild("g").GetDoubleValue() == -0.125);
+
+    // Round-trip from and to JSON
+    SerializerElement jsonElement = Serializer::FromJSON(originalJSON);
+    SerializerElement roundTripElement =
+        Serializer::FromBinary(Serializer::ToBinary(jsonElement), true);
+    REQUIRE(Serializer::ToJSON(roundTripElement) == originalJSON);
+    REQUIRE(Serializer::ToBinary(roundTripElement) ==
+            Serializer::ToBinary(jsonElement));
+
+    std::ostringstream stream;
+    Serializer::ToBinary(jsonElement, stream);
+    REQUIRE(stream.str() == Serializer::ToBinary(jsonElement));
+  }
+
+  SECTION("Invalid binary") {
+    std::string binary = Serializer::ToBinary(
+        Serializer::FromJSON(gd::String("{\"a\": 1,\"b\": [\"hello\"]}")));
+
+    bool success = false;
+    Serializer::FromBinary(binary, false, &success);
+    REQUIRE(success == true);
+
+    // Truncated data must not be read beyond the end.
+    for (std::size_t length = 0; length < binary.size(); ++length) {
+      SerializerElement element =
+          Serializer::FromBinary(binary.data(), length, false, &success);
+      REQUIRE(element.GetChildrenCount() <= 2);
+      REQUIRE(success == false);
+    }
+
+    // An unknown type is an error.
+    SerializerElement number;
+    number.SetValue(1);
+    std::string invalidType = Serializer::ToBinary(number);
+    invalidType[invalidType.size() - 2] = static_cast<char>(0x7F);
+    Serializer::FromBinary(invalidType, false, &success);
+    REQUIRE(success == false);
+
+    // Invalid UTF-8 in strings is replaced, as when reading JSON.
+    SerializerElement text;
+    text.AddChild(u8"nämé").SetStringValue(u8"été");
+    std::string invalidUtf8 = Serializer::ToBinary(text);
+    for (std::size_t i = 0; i < invalidUtf8.size(); ++i) {
+      if (invalidUtf8[i] == '\xC3') invalidUtf8[i] = '\xFF';
+    }
+    SerializerElement invalidUtf8Element =
+        Serializer::FromBinary(invalidUtf8, false, &success);
+    REQUIRE(success == true);
+    REQUIRE(invalidUtf8Element.GetAllChildren().size() == 1);
+    REQUIRE(invalidUtf8Element.GetAllChildren()[0].first.IsValid());
+    gd::String replacedText =
+        invalidUtf8Element.GetAllChildren()[0].second->GetStringValue();
+    REQUIRE(replacedText.IsValid());
+    REQUIRE(replacedText.find(U'\U0000FFFD') != gd::String::npos);
+
+    SerializerElement element =
+        Serializer::FromBinary(std::string("not binary"), false, &success);
+    REQUIRE(element.GetAllChildren().size() == 0);
+    REQUIRE(success == false);
+  }
+
+  SECTION("Invalid JSON") {
+    bool success = false;
+    Serializer::FromJSON(std::string("{\"a\": [1, 2]}"), false, &success);
+    REQUIRE(success == true);
+    Serializer::FromJSON(std::string("{\"a\": [1, 2}"), false, &success);
+    REQUIRE(success == false);
+    Serializer::FromJSON(std::string(), false, &success);
+    REQUIRE(success == false);
+  }
+
   SECTION("Idempotency of unserializing and serializing again") {
     auto unserializeAndSerializeToJSON = [](const gd::String& originalJSON) {
       SerializerElement element = Serializer::FromJSON(originalJSON);
@@ -204,3 +457,134 @@ TEST_CASE("Serializer", "[common]") {
     REQUIRE(json == "{\"hello\": \"world1\",\"ok\": true,\"hello2\": \"world2\"}");
   }
 }
+
+TEST_CASE("Project saved to files", "[common]") {
+  for (bool binary : {false, true}) {
+    gd::Project project;
+    project.SetName("My project");
+    project.InsertNewLayout("Scene", 0);
+    project.InsertNewLayout(u8"Scène 2", 1);
+
+    gd::String filename =
+        binary ? "SerializerTest.gdbin" : "SerializerTest.json";
+    REQUIRE(project.SaveToFile(filename, binary) == true);
+
+    gd::Project loadedProject;
+    REQUIRE(loadedProject.LoadFromFile(filename) == true);
+    REQUIRE(loadedProject.GetName() == "My project");
+    REQUIRE(loadedProject.GetLayoutsCount() == 2);
+    REQUIRE(loadedProject.GetLayout(1).GetName() == u8"Scène 2");
+    REQUIRE(loadedProject.GetProjectFile() == filename);
+    std::remove(filename.c_str());
+  }
+
+  gd::Project project;
+  REQUIRE(project.LoadFromFile("SerializerTest.missing") == false);
+
+  {
+    std::ofstream file("SerializerTest.invalid");
+    file << "{\"properties\": {\"name\": \"My project\"";
+  }
+  REQUIRE(project.LoadFromFile("SerializerTest.invalid") == false);
+  REQUIRE(project.GetName() != "My project");
+  std::remove("SerializerTest.invalid");
+}
+
+TEST_CASE("Project lazily loaded", "[common]") {
+  gd::Project project;
+  project.InsertNewLayout("Scene", 0);
+  project.InsertNewLayout("Scene2", 1)
+      .GetInitialInstances()
+      .InsertNewInitialInstance()
+      .SetObjectName("MyObject");
+  project.InsertNewExternalLayout("ExternalLayout", 0)
+      .GetInitialInstances()
+      .InsertNewInitialInstance()
+      .SetObjectName("MyOtherObject");
+  project.InsertNewExternalEvents("ExternalEvents", 0);
+
+  gd::SerializerElement element;
+  project.SerializeTo(element);
+
+  gd::Project loadedProject;
+  loadedProject.UnserializeFrom(element, true);
+  REQUIRE(loadedProject.GetLayoutsCount() == 2);
+  REQUIRE(loadedProject.GetFullyLoadedLayoutsCount() == 0);
+  REQUIRE(loadedProject.GetFullyLoadedExternalLayoutsCount() == 0);
+  REQUIRE(loadedProject.GetFullyLoadedExternalEventsCount() == 0);
+
+  // Content is loaded only when accessed.
+  gd::Layout &layout = loadedProject.GetLayout("Scene2");
+  REQUIRE(layout.IsFullyLoaded() == false);
+  REQUIRE(layout.GetInitialInstances().GetInstancesCount() == 1);
+  REQUIRE(layout.IsFullyLoaded() == true);
+  REQUIRE(loadedProject.GetFullyLoadedLayoutsCount() == 1);
+
+  REQUIRE(loadedProject.GetExternalLayout("ExternalLayout")
+              .GetInitialInstances()
+              .GetInstancesCount() == 1);
+  REQUIRE(loadedProject.GetFullyLoadedExternalLayoutsCount() == 1);
+
+  loadedProject.GetExternalEvents("ExternalEvents").GetEvents();
+  REQUIRE(loadedProject.GetFullyLoadedExternalEventsCount() == 1);
+
+  // Lazily loaded content can be accessed from several threads.
+  gd::Project concurrentlyLoadedProject;
+  concurrentlyLoadedProject.UnserializeFrom(element, true);
+  const gd::Project &constProject = concurrentlyLoadedProject;
+  std::vector<std::thread> threads;
+  std::vector<std::size_t> instancesCounts(4, 0);
+  for (std::size_t t = 0; t < instancesCounts.size(); ++t) {
+    threads.emplace_back([&constProject, &instancesCounts, t]() {
+      instancesCounts[t] = constProject.GetLayout("Scene2")
+                               .GetInitialInstances()
+                               .GetInstancesCount() +
+                           constProject.GetExternalLayout("ExternalLayout")
+                               .GetInitialInstances()
+                               .GetInstancesCount();
+      constProject.GetExternalEvents("ExternalEvents").GetEvents();
+    });
+  }
+  for (auto &thread : threads) thread.join();
+  for (std::size_t instancesCount : instancesCounts)
+    REQUIRE(instancesCount == 2);
+  REQUIRE(concurrentlyLoadedProject.GetFullyLoadedLayoutsCount() == 1);
+  REQUIRE(concurrentlyLoadedProject.GetFullyLoadedExternalEventsCount() == 1);
+
+  // A copy or a serialization of a lazily loaded project is complete.
+  gd::Project copiedProject(loadedProject);
+  REQUIRE(copiedProject.GetFullyLoadedLayoutsCount() == 2);
+
+  gd::SerializerElement reserializedElement;
+  loadedProject.SerializeTo(reserializedElement);
+  REQUIRE(Serializer::ToJSON(reserializedElement) == Serializer::ToJSON(element));
+
+  // Lazily loaded content does not keep the arena of the elements alive.
+  std::weak_ptr<gd::SerializerElementArena> arena;
+  gd::Project projectLoadedFromArena;
+  {
+    gd::SerializerElement arenaElement =
+        Serializer::FromJSON(Serializer::ToJSON(element).Raw(), true);
+    arena = arenaElement.GetArena();
+    REQUIRE(arena.expired() == false);
+    projectLoadedFromArena.UnserializeFrom(arenaElement, true);
+  }
+  REQUIRE(arena.expired() == true);
+  REQUIRE(projectLoadedFromArena.GetFullyLoadedLayoutsCount() == 0);
+  REQUIRE(projectLoadedFromArena.GetLayout("Scene2")
+              .GetInitialInstances()
+              .GetInstancesCount() == 1);
+  REQUIRE(projectLoadedFromArena.GetExternalLayout("ExternalLayout")
+              .GetInitialInstances()
+              .GetInstancesCount() == 1);
+
+  // Projects can be lazily loaded from files.
+  REQUIRE(project.SaveToFile("SerializerTest.json") == true);
+  gd::Project projectLoadedFromFile;
+  REQUIRE(projectLoadedFromFile.LoadFromFile("SerializerTest.json", true));
+  REQUIRE(projectLoadedFromFile.GetFullyLoadedLayoutsCount() == 0);
+  REQUIRE(projectLoadedFromFile.GetLayout("Scene2")
+              .GetInitialInstances()
+              .GetInstancesCount() == 1);
+  std::remove("SerializerTest.json");
+}
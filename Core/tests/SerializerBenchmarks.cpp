@@ -0,0 +1,234 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include <chrono>
+#include <fstream>
+#include <numeric>
+#include <sstream>
+#include "DummyPlatform.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Project/InitialInstance.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Serialization/Serializer.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "GDCore/Serialization/SerializerElementArena.h"
+#include "catch.hpp"
+
+namespace {
+/**
+ * \brief Fill the project with layouts containing objects, instances and
+ * events, to get a project weighting a few megabytes once serialized.
+ */
+void FillProjectWithLayouts(gd::Project &project,
+                            std::size_t layoutsCount,
+                            std::size_t instancesCount) {
+  for (std::size_t i = 0; i < layoutsCount; ++i) {
+    auto &layout = project.InsertNewLayout(
+        "Layout" + gd::String::From(i), project.GetLayoutsCount());
+
+    for (std::size_t j = 0; j < 50; ++j) {
+      layout.InsertNewObject(project,
+                             "MyExtension::Sprite",
+                             "MySpriteObject" + gd::String::From(j),
+                             layout.GetObjectsCount());
+    }
+
+    for (std::size_t j = 0; j < instancesCount; ++j) {
+      auto &instance = layout.GetInitialInstances().InsertNewInitialInstance();
+      instance.SetObjectName("MySpriteObject" + gd::String::From(j % 50));
+      instance.SetX(j * 12.5f);
+      instance.SetY(j * 7.25f);
+      instance.SetLayer(u8"Calque spécial");
+    }
+
+    for (std::size_t j = 0; j < 100; ++j) {
+      gd::StandardEvent event;
+      gd::Instruction instruction;
+      instruction.SetType("MyExtension::DoSomething");
+      instruction.SetParametersCount(1);
+      instruction.SetParameter(
+          0,
+          gd::Expression("MySpriteObject" + gd::String::From(j % 50) +
+                         ".X() + \"A \\\"quoted\\\" string\""));
+      event.GetActions().Insert(instruction);
+      layout.GetEvents().InsertEvent(event);
+    }
+  }
+}
+
+/**
+ * \brief Return the resident set size of the process (or its peak), in
+ * kilobytes, or 0 if not supported (Linux only).
+ */
+std::size_t GetMemoryUsage(bool peak) {
+  std::ifstream status("/proc/self/status");
+  std::string field = peak ? "VmHWM:" : "VmRSS:";
+  std::string line;
+  while (std::getline(status, line)) {
+    if (line.compare(0, field.size(), field) == 0)
+      return gd::String::FromUTF8(line.substr(field.size()))
+          .To<std::size_t>();
+  }
+
+  return 0;
+}
+}  // namespace
+
+TEST_CASE("Serializer - Benchmarks", "[benchmarks][common]") {
+  gd::Project project;
+  gd::Platform platform;
+  SetupProjectWithDummyPlatform(project, platform);
+  FillProjectWithLayouts(project, 20, 1000);
+
+  gd::SerializerElement projectElement;
+  project.SerializeTo(projectElement);
+  std::string json = gd::Serializer::ToJSON(projectElement).Raw();
+  REQUIRE(json.size() > 1024 * 1024);
+
+  auto doBenchmark = [](const gd::String &benchmarkName,
+                        const size_t runsCount,
+                        const size_t bytesCount,
+                        std::function<void()> func) {
+    std::vector<long long> timesInMicroseconds;
+
+    for (size_t i = 0; i < runsCount; i++) {
+      auto start = std::chrono::steady_clock::now();
+      func();
+      auto end = std::chrono::steady_clock::now();
+
+      timesInMicroseconds.push_back(
+          std::chrono::duration_cast<std::chrono::microseconds>(end - start)
+              .count());
+    }
+
+    float averageTime = (float)std::accumulate(timesInMicroseconds.begin(),
+                                               timesInMicroseconds.end(),
+                                               0LL) /
+                        (float)runsCount;
+    std::cout << benchmarkName << " benchmark (" << runsCount
+              << " runs): " << averageTime << " microseconds";
+    if (bytesCount > 0 && averageTime > 0) {
+      std::cout << " (" << bytesCount << " bytes, "
+                << (float)bytesCount / averageTime << " MB/s)";
+    }
+    std::cout << std::endl;
+  };
+
+  SECTION("Parse a multi-megabytes project") {
+    doBenchmark("Parse project JSON", 5, json.size(), [&]() {
+      gd::SerializerElement element = gd::Serializer::FromJSON(json);
+      REQUIRE(element.GetChild("layouts").GetChildrenCount() == 20);
+    });
+  }
+
+  SECTION("Parse a multi-megabytes project, with an arena") {
+    doBenchmark("Parse project JSON (arena)", 5, json.size(), [&]() {
+      gd::SerializerElement element = gd::Serializer::FromJSON(json, true);
+      REQUIRE(element.GetArena() != nullptr);
+      REQUIRE(element.GetChild("layouts").GetChildrenCount() == 20);
+    });
+  }
+
+  SECTION("Load and destroy a multi-megabytes project") {
+    for (bool useArena : {false, true}) {
+      std::size_t initialMemoryUsage = GetMemoryUsage(false);
+      std::size_t loadedMemoryUsage = 0;
+      std::size_t arenaReservedBytes = 0;
+      doBenchmark(useArena ? "Load and destroy project JSON (arena)"
+                           : "Load and destroy project JSON",
+                  1,
+                  json.size(),
+                  [&]() {
+                    gd::SerializerElement element =
+                        gd::Serializer::FromJSON(json, useArena);
+                    loadedMemoryUsage = GetMemoryUsage(false);
+                    if (element.GetArena())
+                      arenaReservedBytes =
+                          element.GetArena()->GetReservedBytes();
+                  });
+
+      if (loadedMemoryUsage > 0) {
+        std::cout << "  RSS while loaded: +"
+                  << (long long)loadedMemoryUsage -
+                         (long long)initialMemoryUsage
+                  << "kB (peak RSS: " << GetMemoryUsage(true) << "kB)"
+                  << std::endl;
+      }
+      if (arenaReservedBytes > 0) {
+        std::cout << "  Arena: " << arenaReservedBytes / 1024 << "kB reserved"
+                  << std::endl;
+      }
+    }
+  }
+
+  SECTION("Read and write a multi-megabytes project in the binary format") {
+    std::string binary = gd::Serializer::ToBinary(projectElement);
+    std::cout << "Project binary size: " << binary.size()
+              << " bytes (JSON: " << json.size() << " bytes)" << std::endl;
+
+    doBenchmark("Write project binary", 5, 0, [&]() {
+      REQUIRE(gd::Serializer::ToBinary(projectElement).size() ==
+              binary.size());
+    });
+    doBenchmark("Parse project binary", 5, binary.size(), [&]() {
+      gd::SerializerElement element = gd::Serializer::FromBinary(binary);
+      REQUIRE(element.GetChild("layouts").GetChildrenCount() == 20);
+    });
+    doBenchmark("Parse project binary (arena)", 5, binary.size(), [&]() {
+      gd::SerializerElement element = gd::Serializer::FromBinary(binary, true);
+      REQUIRE(element.GetChild("layouts").GetChildrenCount() == 20);
+    });
+    doBenchmark("Load project from binary", 5, 0, [&]() {
+      gd::Project loadedProject;
+      loadedProject.AddPlatform(platform);
+      loadedProject.UnserializeFrom(gd::Serializer::FromBinary(binary, true));
+      REQUIRE(loadedProject.GetLayoutsCount() == 20);
+    });
+    doBenchmark("Load project from JSON", 5, 0, [&]() {
+      gd::Project loadedProject;
+      loadedProject.AddPlatform(platform);
+      loadedProject.UnserializeFrom(gd::Serializer::FromJSON(json, true));
+      REQUIRE(loadedProject.GetLayoutsCount() == 20);
+    });
+    doBenchmark("Load project from binary (lazy loading)", 5, 0, [&]() {
+      gd::Project loadedProject;
+      loadedProject.AddPlatform(platform);
+      loadedProject.UnserializeFrom(gd::Serializer::FromBinary(binary, true),
+                                    true);
+      REQUIRE(loadedProject.GetLayoutsCount() == 20);
+      REQUIRE(loadedProject.GetLayout(0).GetEvents().GetEventsCount() == 100);
+      REQUIRE(loadedProject.GetFullyLoadedLayoutsCount() == 1);
+    });
+  }
+
+  SECTION("Write a multi-megabytes project") {
+    doBenchmark("Write project JSON", 5, json.size(), [&]() {
+      REQUIRE(gd::Serializer::ToJSON(projectElement).size() > 0);
+    });
+    doBenchmark("Write project JSON (compact)", 5, json.size(), [&]() {
+      REQUIRE(gd::Serializer::ToJSON(projectElement, true).size() > 0);
+    });
+    doBenchmark("Write project JSON in a stream", 5, json.size(), [&]() {
+      std::ostringstream stream;
+      gd::Serializer::ToJSON(projectElement, stream);
+      REQUIRE(stream.str().size() == json.size());
+    });
+  }
+
+  SECTION("Access children of an element with many children") {
+    doBenchmark("Add and get 20000 children", 5, 0, [&]() {
+      gd::SerializerElement element;
+      for (std::size_t i = 0; i < 20000; ++i)
+        element.AddChild("child" + gd::String::From(i)).SetIntValue(i);
+      int sum = 0;
+      for (std::size_t i = 0; i < 20000; ++i)
+        sum += element.GetChild("child" + gd::String::From(i)).GetIntValue();
+      REQUIRE(sum == 19999 * 20000 / 2);
+    });
+  }
+}
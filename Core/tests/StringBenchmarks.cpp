@@ -0,0 +1,102 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <vector>
+#include "GDCore/String.h"
+#include "catch.hpp"
+
+TEST_CASE("String - Benchmarks", "[benchmarks][common][utf8]") {
+  auto doBenchmark = [](const gd::String &benchmarkName,
+                        const size_t runsCount,
+                        std::function<void()> func) {
+    std::vector<long long> timesInMicroseconds;
+
+    for (size_t i = 0; i < runsCount; i++) {
+      auto start = std::chrono::steady_clock::now();
+      func();
+      auto end = std::chrono::steady_clock::now();
+
+      timesInMicroseconds.push_back(
+          std::chrono::duration_cast<std::chrono::microseconds>(end - start)
+              .count());
+    }
+
+    std::cout << benchmarkName << " benchmark (" << runsCount << " runs): "
+              << (float)std::accumulate(timesInMicroseconds.begin(),
+                                        timesInMicroseconds.end(),
+                                        0) /
+                     (float)runsCount
+              << " microseconds" << std::endl;
+  };
+
+  // Run the same operations on a string made of ASCII characters and on a
+  // string with multi-bytes characters, both of 10000 characters.
+  gd::String asciiString;
+  gd::String utf8String;
+  for (std::size_t i = 0; i < 1000; ++i) {
+    asciiString += "Hello you.";
+    utf8String += u8"Héllo yoü.";
+  }
+
+  for (const gd::String *str : {&asciiString, &utf8String}) {
+    const gd::String kind = str == &asciiString ? "ASCII" : "UTF8";
+    const std::size_t length = 10000;
+
+    doBenchmark("size (" + kind + ")", 10, [&]() {
+      std::size_t totalLength = 0;
+      for (std::size_t i = 0; i < 1000; ++i) totalLength += str->size();
+      REQUIRE(totalLength == length * 1000);
+    });
+
+    doBenchmark("operator[] (" + kind + ")", 10, [&]() {
+      std::size_t count = 0;
+      for (std::size_t i = 0; i < length; i += 10)
+        if ((*str)[i] == U'H') count++;
+      REQUIRE(count == 1000);
+    });
+
+    doBenchmark("substr (" + kind + ")", 10, [&]() {
+      std::size_t count = 0;
+      for (std::size_t i = 0; i < length; i += 10)
+        if (str->substr(i, 5) == "Hello") count++;
+      REQUIRE(count == (str == &asciiString ? 1000 : 0));
+    });
+
+    doBenchmark("find (" + kind + ")", 10, [&]() {
+      std::size_t count = 0;
+      for (std::size_t pos = str->find(U'.'); pos != gd::String::npos;
+           pos = str->find(U'.', pos + 1))
+        count++;
+      REQUIRE(count == 1000);
+    });
+
+    doBenchmark("rfind (" + kind + ")", 10, [&]() {
+      std::size_t count = 0;
+      for (std::size_t pos = str->rfind("y"); pos != gd::String::npos;
+           pos = pos == 0 ? gd::String::npos : str->rfind("y", pos - 1))
+        count++;
+      REQUIRE(count == 1000);
+    });
+
+    doBenchmark("FindAndReplace (" + kind + ")", 10, [&]() {
+      REQUIRE(str->FindAndReplace("yo", "the").size() == length + 1000);
+    });
+
+    doBenchmark("operator+= and push_back (" + kind + ")", 10, [&]() {
+      gd::String result;
+      std::size_t totalLength = 0;
+      for (std::size_t i = 0; i < 1000; ++i) {
+        result += str->substr(0, 9);
+        result.push_back(U'!');
+        totalLength += result.size();
+      }
+      REQUIRE(totalLength == 10 * 1000 * 1001 / 2);
+    });
+  }
+}
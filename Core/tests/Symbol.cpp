@@ -0,0 +1,89 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering gd::Symbol.
+ */
+#include "GDCore/Tools/Symbol.h"
+#include <unordered_set>
+#include "GDCore/Extensions/Metadata/InstructionMetadata.h"
+#include "GDCore/String.h"
+#include "catch.hpp"
+
+TEST_CASE("Symbol", "[common]") {
+  SECTION("Basics") {
+    gd::Symbol empty;
+    REQUIRE(empty.empty());
+    REQUIRE(empty == gd::Symbol(""));
+    REQUIRE(empty == "");
+
+    gd::Symbol number("number");
+    gd::Symbol otherNumber(gd::String("num") + "ber");
+    REQUIRE(number == otherNumber);
+    REQUIRE(&number.GetString() == &otherNumber.GetString());
+    REQUIRE(number != gd::Symbol("string"));
+    REQUIRE(number != empty);
+
+    gd::Symbol copy = number;
+    REQUIRE(copy == number);
+    copy = "string";
+    REQUIRE(copy == gd::Symbol("string"));
+    REQUIRE(number == gd::Symbol("number"));
+  }
+
+  SECTION("Comparisons with strings") {
+    gd::Symbol symbol(u8"Calque spécial");
+    REQUIRE(symbol == u8"Calque spécial");
+    REQUIRE(symbol == gd::String(u8"Calque spécial"));
+    REQUIRE(gd::String(u8"Calque spécial") == symbol);
+    REQUIRE(symbol != "Calque");
+    REQUIRE("Calque" != symbol);
+    REQUIRE((gd::String(symbol) + "!") == u8"Calque spécial!");
+
+    std::unordered_set<gd::Symbol> symbols;
+    symbols.insert(gd::Symbol("a"));
+    symbols.insert(gd::Symbol(gd::String("a")));
+    symbols.insert(gd::Symbol("b"));
+    REQUIRE(symbols.size() == 2);
+  }
+
+  SECTION("Parameter types") {
+    gd::ParameterMetadata parameter;
+    parameter.SetType("objectList");
+    REQUIRE(gd::ParameterMetadata::IsObject(parameter.GetType()));
+    REQUIRE(gd::ParameterMetadata::IsObject(parameter.GetType().GetString()));
+    REQUIRE(!gd::ParameterMetadata::IsBehavior(parameter.GetType()));
+
+    for (const char *type : {"expression",
+                             "camera",
+                             "forceMultiplier",
+                             "string",
+                             "layer",
+                             "color",
+                             "file",
+                             "joyaxis",
+                             "stringWithSelector",
+                             "sceneName",
+                             "objectvar",
+                             "globalvar",
+                             "scenevar",
+                             "object",
+                             "unknown"}) {
+      parameter.SetType(type);
+      for (const char *expressionType : {"number", "string", "variable"}) {
+        REQUIRE(gd::ParameterMetadata::IsExpression(expressionType,
+                                                    parameter.GetType()) ==
+                gd::ParameterMetadata::IsExpression(
+                    expressionType, parameter.GetType().GetString()));
+      }
+    }
+
+    REQUIRE(gd::ParameterMetadata::IsExpression("number", "camera"));
+    REQUIRE(gd::ParameterMetadata::IsExpression("string", "sceneName"));
+    REQUIRE(gd::ParameterMetadata::IsExpression("variable", "scenevar"));
+    REQUIRE(!gd::ParameterMetadata::IsExpression("number", "scenevar"));
+    REQUIRE(!gd::ParameterMetadata::IsExpression("unknown", "expression"));
+  }
+}
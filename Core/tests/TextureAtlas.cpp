@@ -0,0 +1,163 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering texture atlases and their packing.
+ */
+#include "GDCore/Project/TextureAtlas.h"
+#include "GDCore/Extensions/Builtin/SpriteExtension/Animation.h"
+#include "GDCore/Extensions/Builtin/SpriteExtension/Direction.h"
+#include "GDCore/Extensions/Builtin/SpriteExtension/Sprite.h"
+#include "GDCore/Extensions/Builtin/SpriteExtension/SpriteObject.h"
+#include "GDCore/IDE/Project/TextureAtlasPacker.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Project/ResourcesManager.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "catch.hpp"
+
+namespace {
+
+gd::SpriteObject CreateSpriteObject(const gd::String& name,
+                                    const std::vector<gd::String>& images,
+                                    const gd::String& type = "Sprite") {
+  gd::SpriteObject object(name);
+  object.SetType(type);
+
+  gd::Animation animation;
+  animation.SetDirectionsCount(1);
+  for (const gd::String& image : images) {
+    gd::Sprite sprite;
+    sprite.SetImageName(image);
+    animation.GetDirection(0).AddSprite(sprite);
+  }
+  object.AddAnimation(animation);
+
+  return object;
+}
+
+bool RegionsOverlap(const gd::TextureAtlas::Region& a,
+                    const gd::TextureAtlas::Region& b) {
+  return a.page == b.page && a.x < b.x + b.width && b.x < a.x + a.width &&
+         a.y < b.y + b.height && b.y < a.y + a.height;
+}
+
+}  // namespace
+
+TEST_CASE("TextureAtlas", "[common][resources]") {
+  SECTION("Serialization") {
+    gd::ResourcesManager resourcesManager;
+    gd::TextureAtlas& atlas = resourcesManager.GetTextureAtlas();
+    atlas.AddPage("Page0.png");
+    atlas.AddPage("Page1.png");
+    atlas.SetRegion("Image.png", gd::TextureAtlas::Region(1, 2, 3, 40, 50));
+
+    gd::SerializerElement element;
+    resourcesManager.SerializeTo(element);
+    gd::ResourcesManager unserialized;
+    unserialized.UnserializeFrom(element);
+
+    const gd::TextureAtlas& unserializedAtlas = unserialized.GetTextureAtlas();
+    REQUIRE(unserializedAtlas.GetPagesCount() == 2);
+    REQUIRE(unserializedAtlas.GetPage(1) == "Page1.png");
+    REQUIRE(unserializedAtlas.HasRegion("Image.png"));
+    REQUIRE(unserializedAtlas.HasRegion("Other.png") == false);
+    const gd::TextureAtlas::Region& region =
+        unserializedAtlas.GetRegion("Image.png");
+    REQUIRE(region.page == 1);
+    REQUIRE(region.x == 2);
+    REQUIRE(region.y == 3);
+    REQUIRE(region.width == 40);
+    REQUIRE(region.height == 50);
+
+    // A project without atlas is serialized as before.
+    gd::SerializerElement emptyElement;
+    gd::ResourcesManager().SerializeTo(emptyElement);
+    REQUIRE(emptyElement.HasChild("textureAtlas") == false);
+    unserialized.UnserializeFrom(emptyElement);
+    REQUIRE(unserialized.GetTextureAtlas().IsEmpty());
+  }
+}
+
+TEST_CASE("TextureAtlasPacker", "[common][resources]") {
+  SECTION("Images are packed without overlapping") {
+    gd::TextureAtlasPacker packer(128, 2);
+    for (std::size_t i = 0; i < 20; ++i)
+      packer.AddImage("", "Image" + gd::String::From(i), 10 + i, 30 - i);
+    packer.AddImage("", "Too large", 200, 10);
+    packer.Pack();
+
+    REQUIRE(packer.GetImagesNotPacked() ==
+            std::vector<gd::String>({"Too large"}));
+
+    std::vector<gd::TextureAtlas::Region> regions;
+    for (std::size_t i = 0; i < packer.GetPagesCount(); ++i) {
+      const gd::TextureAtlasPacker::Page& page = packer.GetPage(i);
+      REQUIRE(page.width <= 128);
+      REQUIRE(page.height <= 128);
+      for (const auto& it : page.regions) {
+        REQUIRE(it.second.page == i);
+        REQUIRE(it.second.x >= 2);
+        REQUIRE(it.second.y >= 2);
+        REQUIRE(page.width >= it.second.x + it.second.width + 2);
+        REQUIRE(page.height >= it.second.y + it.second.height + 2);
+        regions.push_back(it.second);
+      }
+    }
+    REQUIRE(regions.size() == 20);
+    for (std::size_t i = 0; i < regions.size(); ++i)
+      for (std::size_t j = i + 1; j < regions.size(); ++j)
+        REQUIRE(RegionsOverlap(regions[i], regions[j]) == false);
+  }
+
+  SECTION("Groups are packed in different pages") {
+    gd::TextureAtlasPacker packer(1024, 2);
+    packer.AddImage("Layout1", "A.png", 32, 32);
+    packer.AddImage("Layout2", "B.png", 32, 32);
+    packer.AddImage("Layout2", "C.png", 16, 16);
+    packer.AddImage("Layout2", "A.png", 32, 32);
+    packer.Pack();
+
+    REQUIRE(packer.GetPagesCount() == 2);
+    REQUIRE(packer.GetPage(0).group == "Layout1");
+    REQUIRE(packer.GetPage(0).regions.size() == 1);
+    REQUIRE(packer.GetPage(1).group == "Layout2");
+    REQUIRE(packer.GetPage(1).regions.size() == 2);
+
+    // Pages are trimmed to the images they contain.
+    REQUIRE(packer.GetPage(1).width == 2 + 32 + 2 + 16 + 2);
+    REQUIRE(packer.GetPage(1).height == 2 + 32 + 2);
+
+    gd::TextureAtlas atlas;
+    atlas.AddPage("Existing page.png");
+    packer.FillTextureAtlas(atlas, {"Page1.png", "Page2.png"});
+    REQUIRE(atlas.GetPagesCount() == 3);
+    REQUIRE(atlas.GetRegion("A.png").page == 1);
+    REQUIRE(atlas.GetRegion("C.png").page == 2);
+    REQUIRE(atlas.GetRegion("C.png").x == 2 + 32 + 2);
+  }
+
+  SECTION("Images are grouped by layout") {
+    gd::Project project;
+    project.InsertObject(CreateSpriteObject("Global", {"Global.png"}), 0);
+    gd::Layout& layout1 = project.InsertNewLayout("Layout1", 0);
+    gd::Layout& layout2 = project.InsertNewLayout("Layout2", 1);
+    layout1.InsertObject(
+        CreateSpriteObject("Player", {"Player1.png", "Player2.png"}), 0);
+    layout1.InsertObject(CreateSpriteObject("Coin", {"Coin.png"}), 1);
+    layout2.InsertObject(CreateSpriteObject("Enemy", {"Enemy.png"}), 0);
+    layout2.InsertObject(CreateSpriteObject("Coin", {"Coin.png"}), 1);
+    layout2.InsertObject(
+        CreateSpriteObject("Tiled", {"Tile.png", "Enemy.png"}, "TiledSprite"),
+        2);
+
+    auto groups = gd::TextureAtlasPacker::GetSpritesImagesGroups(project);
+    REQUIRE(groups.size() == 2);
+    REQUIRE(groups[""] == std::set<gd::String>({"Coin.png", "Global.png"}));
+    REQUIRE(groups["Layout1"] ==
+            std::set<gd::String>({"Player1.png", "Player2.png"}));
+    REQUIRE(groups.find("Layout2") == groups.end());
+  }
+}
@@ -289,4 +289,51 @@ TEST_CASE("Utf8 String", "[common][utf8]") {
     gd::String str6 = u8"ßßß";
     REQUIRE(str6.FindAndReplace(u8"ßß", u8"ß") == u8"ßß");
   }
+
+  SECTION("cached length and ASCII strings") {
+    gd::String str = "Hello";
+    REQUIRE(str.IsASCII() == true);
+    REQUIRE(str.size() == 5);
+    REQUIRE(str[1] == U'e');
+
+    str += u8" wörld";
+    REQUIRE(str.IsASCII() == false);
+    REQUIRE(str.size() == 11);
+    REQUIRE(str[7] == U'ö');
+    REQUIRE(str.find("r") == 8);
+
+    str.pop_back();
+    str.erase(6, 2);
+    REQUIRE(str == "Hello rl");
+    REQUIRE(str.IsASCII() == true);
+    REQUIRE(str.size() == 8);
+    REQUIRE(str.find("l", 3) == 3);
+    REQUIRE(str.rfind("l") == 7);
+    REQUIRE(str.find_first_of(u8"ör") == 6);
+    REQUIRE(str.find_last_not_of(u8"lö") == 6);
+
+    str.push_back(U'ß');
+    REQUIRE(str.IsASCII() == false);
+    REQUIRE(str.size() == 9);
+    REQUIRE(str.substr(6) == u8"rlß");
+
+    str.Raw() = "Raw";
+    REQUIRE(str.IsASCII() == true);
+    REQUIRE(str.size() == 3);
+    REQUIRE_THROWS_AS(str.substr(4), std::out_of_range);
+
+    gd::String copy = str;
+    gd::String moved = std::move(copy);
+    REQUIRE(moved.size() == 3);
+    moved.insert(1, u8"é");
+    REQUIRE(moved == u8"Réaw");
+    REQUIRE(moved.size() == 4);
+    moved.replace(0, 2, "R");
+    REQUIRE(moved == "Raw");
+    REQUIRE(moved.IsASCII() == true);
+
+    moved.clear();
+    REQUIRE(moved.size() == 0);
+    REQUIRE(moved.IsASCII() == true);
+  }
 }
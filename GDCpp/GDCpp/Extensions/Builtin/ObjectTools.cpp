@@ -14,6 +14,33 @@
 
 using namespace std;
 
+namespace {
+/**
+ * Return the square, centered on the center of the object, containing all the
+ * points closer to the center than the given distance.
+ */
+sf::FloatRect GetAreaAroundCenter(RuntimeObject *obj, float distance) {
+  // Add a small margin so that rounding errors can't exclude objects that are
+  // exactly at the given distance.
+  distance = std::abs(distance) + 1;
+  return sf::FloatRect(obj->GetDrawableX() + obj->GetCenterX() - distance,
+                       obj->GetDrawableY() + obj->GetCenterY() - distance,
+                       2 * distance,
+                       2 * distance);
+}
+
+/**
+ * Return the area around the bounding circle used by
+ * RuntimeObject::IsCollidingWith: objects with non overlapping areas are never
+ * colliding.
+ */
+sf::FloatRect GetBoundingCircleArea(RuntimeObject *obj) {
+  float width = obj->GetWidth();
+  float height = obj->GetHeight();
+  return GetAreaAroundCenter(obj, sqrt(width * width + height * height) / 2.0);
+}
+}  // namespace
+
 double GD_API PickedObjectsCount(
     std::map<gd::String, std::vector<RuntimeObject *> *> objectsLists) {
   std::size_t size = 0;
@@ -34,10 +61,11 @@ bool GD_API HitBoxesCollision(
     bool conditionInverted,
     RuntimeScene & /*scene*/,
     bool ignoreTouchingEdges) {
-  return TwoObjectListsTest(
+  return TwoObjectListsTestWithBroadPhase(
       objectsLists1,
       objectsLists2,
       conditionInverted,
+      GetBoundingCircleArea,
       [ignoreTouchingEdges](RuntimeObject *obj1, RuntimeObject *obj2) {
         return obj1->IsCollidingWith(obj2, ignoreTouchingEdges);
       });
@@ -70,11 +98,17 @@ float GD_API DistanceBetweenObjects(
     std::map<gd::String, std::vector<RuntimeObject *> *> objectsLists2,
     float length,
     bool conditionInverted) {
+  // Objects closer than length have overlapping squares of half this size
+  // around their centers.
+  float halfLength = length / 2;
   length *= length;
-  return TwoObjectListsTest(
+  return TwoObjectListsTestWithBroadPhase(
       objectsLists1,
       objectsLists2,
       conditionInverted,
+      [halfLength](RuntimeObject *obj) {
+        return GetAreaAroundCenter(obj, halfLength);
+      },
       [length](RuntimeObject *obj1, RuntimeObject *obj2) {
         float X = obj1->GetDrawableX() + obj1->GetCenterX() -
                   (obj2->GetDrawableX() + obj2->GetCenterX());
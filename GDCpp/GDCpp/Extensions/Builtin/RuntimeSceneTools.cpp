@@ -72,19 +72,14 @@ bool GD_API SceneJustBegins(RuntimeScene &scene) {
 }
 
 void GD_API MoveObjects(RuntimeScene &scene) {
-  RuntimeObjNonOwningPtrList allObjects =
-      scene.objectsInstances.GetAllObjects();
-
-  for (std::size_t id = 0; id < allObjects.size(); ++id) {
+  scene.objectsInstances.ForEachObject([&scene](RuntimeObject *object) {
     double elapsedTime =
-        static_cast<double>(allObjects[id]->GetElapsedTime(scene)) / 1000000.0;
-    allObjects[id]->SetX(allObjects[id]->GetX() +
-                         allObjects[id]->TotalForceX() * elapsedTime);
-    allObjects[id]->SetY(allObjects[id]->GetY() +
-                         allObjects[id]->TotalForceY() * elapsedTime);
+        static_cast<double>(object->GetElapsedTime(scene)) / 1000000.0;
+    object->SetX(object->GetX() + object->TotalForceX() * elapsedTime);
+    object->SetY(object->GetY() + object->TotalForceY() * elapsedTime);
 
-    allObjects[id]->UpdateForce(elapsedTime);
-  }
+    object->UpdateForce(elapsedTime);
+  });
 
   return;
 }
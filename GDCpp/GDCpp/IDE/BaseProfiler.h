@@ -46,6 +46,7 @@ public:
     unsigned long int lastRenderingTime; ///< Time used by rendering during the last frame
     unsigned long int totalSceneTime; ///< Total time used by events and rendering since the beginning.
     unsigned long int totalEventsTime; ///< Total time used by events since the beginning.
+    std::size_t lastObjectsListsAllocations; ///< Number of lists of objects allocated by the scene objects container during the last frame.
 
     btClock eventsClock; ///< Used to compute time used by events during the frame
     btClock renderingClock; ///< Used to compute time used by rendering during the frame
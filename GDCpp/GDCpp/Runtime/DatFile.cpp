@@ -6,92 +6,140 @@
 #include <fstream>
 #include <iostream>
 #include "GDCpp/Runtime/Tools/FileStream.h"
+#include "GDCpp/Runtime/Tools/LZ4Block.h"
+#if defined(WINDOWS)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
-DatFile::DatFile(void) { m_buffer = NULL; }
+namespace {
 
-DatFile::~DatFile(void) {
-  if (m_buffer != NULL) delete[] m_buffer;
+const std::size_t headerSize = sizeof(sDATHeader) + sizeof(std::uint32_t);
+
+/**
+ * \brief FNV-1a hash of a file name.
+ */
+std::uint32_t HashName(const char* name, std::size_t size) {
+  std::uint32_t hash = 2166136261u;
+  for (std::size_t i = 0; i < size; ++i) {
+    hash ^= static_cast<unsigned char>(name[i]);
+    hash *= 16777619u;
+  }
+  return hash;
 }
-bool DatFile::Create(std::vector<gd::String> files,
-                     gd::String directory,
-                     gd::String destination) {
-  // An file entry in order to push it in the object's std::vector
-  sFileEntry entry;
+
+}  // namespace
+
+DatFile::DatFile(void)
+    : m_data(NULL),
+      m_dataSize(0),
+#if defined(WINDOWS)
+      m_fileHandle(NULL),
+      m_mappingHandle(NULL),
+#endif
+      m_entries(NULL),
+      m_buckets(NULL),
+      m_bucketsCount(0),
+      m_names(NULL) {
+  memset(&m_header, 0, sizeof(m_header));
+}
+
+DatFile::~DatFile(void) { Close(); }
+
+bool DatFile::Create(const std::vector<gd::String>& files,
+                     const gd::String& directory,
+                     const gd::String& destination,
+                     bool compress) {
   // An input file stream to read each file included
   gd::FileStream file;
   // An output file stream to write our DAT file
   gd::FileStream datfile;
-  // The buffer used to read/write the DAT file
-  char buffer[1];
 
   // DATHeader
-  // We start by filling it with 0
-  memset(&m_header, 0, sizeof(m_header));
-  // Then we copy the ID
-  memcpy(m_header.uniqueID, "EXEGD", 5);  // EXEcutable GDevelop
-  // Then the version
-  memcpy(m_header.version, "0.1", 3);
-  // Then the number of files to include
-  m_header.nb_files = files.size();
-
-  // Next, we open each file in orderto create the File Entries Table
+  sDATHeader header;
+  memset(&header, 0, sizeof(header));
+  memcpy(header.uniqueID, "EXEGD", 5);  // EXEcutable GDevelop
+  memcpy(header.version, "0.2", 3);
+  header.nb_files = files.size();
+
+  // Read each file, to create the File Entries Table and the names table.
+  std::vector<sFileEntryV2> entries(files.size());
+  std::vector<std::string> contents(files.size());
+  std::string names;
   for (std::size_t i = 0; i < files.size(); i++) {
     gd::String fileToOpen = directory + "/" + files[i];
     file.open(fileToOpen, std::ios_base::in | std::ios_base::binary);
-    if (file.is_open()) {
-      // Filling the FileEntry with 0
-      memset(&entry, 0, sizeof(sFileEntry));
-      // We keep the file name
-      memcpy(entry.name, files[i].c_str(), strlen(files[i].c_str()));
-      // We calculate its size
-      file.seekg(0, std::ios::end);
-      entry.size = file.tellg();
-      // Since we don't know exactly its final position in the DAT file, let's
-      // use 0
-      entry.offset = 0;
-      // We finished with this file
-      file.close();
-
-      // Finally, we add this File Entry in our std::vector
-      m_entries.push_back(entry);
-    } else {
-      // Simple error track
+    if (!file.is_open()) {
       std::cout << "File " << files[i] << " raise an error." << std::endl;
-      return (false);
+      return false;
     }
+    std::string& content = contents[i];
+    file.seekg(0, std::ios::end);
+    content.resize(file.tellg());
+    file.seekg(0, std::ios::beg);
+    file.read(&content[0], content.size());
+    file.close();
+
+    sFileEntryV2& entry = entries[i];
+    memset(&entry, 0, sizeof(sFileEntryV2));
+    entry.originalSize = content.size();
+    if (compress && !content.empty()) {
+      std::string compressed(gd::LZ4Block::CompressBound(content.size()), 0);
+      std::size_t compressedSize = gd::LZ4Block::Compress(
+          content.data(), content.size(), &compressed[0], compressed.size());
+      if (compressedSize != 0 && compressedSize < content.size()) {
+        compressed.resize(compressedSize);
+        content.swap(compressed);
+        entry.flags |= CompressedFile;
+      }
+    }
+    entry.size = content.size();
+
+    const std::string& name = files[i].Raw();
+    entry.nameOffset = names.size();
+    entry.nameSize = name.size();
+    entry.nameHash = HashName(name.data(), name.size());
+    names += name;
+  }
+
+  // The hash table is kept at most half full, so that few probes are needed.
+  std::uint32_t bucketsCount = 1;
+  while (bucketsCount < 2 * entries.size()) bucketsCount *= 2;
+  std::vector<std::uint32_t> buckets(bucketsCount, 0);
+  for (std::size_t i = 0; i < entries.size(); i++) {
+    std::uint32_t bucket = entries[i].nameHash & (bucketsCount - 1);
+    while (buckets[bucket] != 0) bucket = (bucket + 1) & (bucketsCount - 1);
+    buckets[bucket] = i + 1;
   }
 
   // Now, we know everything about our files, we can update offsets
-  long actual_offset = 0;
-  actual_offset += sizeof(sDATHeader);
-  actual_offset += m_header.nb_files * sizeof(sFileEntry);
-  for (std::size_t i = 0; i < m_entries.size(); i++) {
-    m_entries[i].offset = actual_offset;
-    actual_offset += m_entries[i].size;
+  std::uint64_t actual_offset = headerSize;
+  actual_offset += entries.size() * sizeof(sFileEntryV2);
+  actual_offset += bucketsCount * sizeof(std::uint32_t);
+  actual_offset += names.size();
+  for (std::size_t i = 0; i < entries.size(); i++) {
+    entries[i].offset = actual_offset;
+    actual_offset += entries[i].size;
   }
 
   // And finally, we are writing the DAT file
   datfile.open(destination, std::ios_base::out | std::ios_base::binary);
-
-  // First, we write the header
-  datfile.write((char*)&m_header, sizeof(sDATHeader));
-
-  // Then, the File Entries Table
-  for (std::size_t i = 0; i < m_entries.size(); i++) {
-    datfile.write((char*)&m_entries[i], sizeof(sFileEntry));
-  }
-
-  // Finally, we write each file
-  for (std::size_t i = 0; i < m_entries.size(); i++) {
-    gd::String fileToOpen = directory + "/" + files[i];
-    file.open(fileToOpen, std::ios_base::in | std::ios_base::binary);
-    if (file.is_open()) {
-      file.seekg(0, std::ios::beg);
-      datfile << file.rdbuf();
-      file.close();
-    }
+  if (!datfile.is_open()) {
+    std::cout << "Unable to write " << destination << "." << std::endl;
+    return false;
   }
-  // And it's finished
+  datfile.write((char*)&header, sizeof(sDATHeader));
+  datfile.write((char*)&bucketsCount, sizeof(std::uint32_t));
+  if (!entries.empty())
+    datfile.write((char*)&entries[0], entries.size() * sizeof(sFileEntryV2));
+  datfile.write((char*)&buckets[0], bucketsCount * sizeof(std::uint32_t));
+  datfile.write(names.data(), names.size());
+  for (std::size_t i = 0; i < contents.size(); i++)
+    datfile.write(contents[i].data(), contents[i].size());
   datfile.close();
   return true;
 }
@@ -99,104 +147,270 @@ bool DatFile::Create(std::vector<gd::String> files,
 /**
  * Load the DatFile from a file. Return true on success
  */
-bool DatFile::Read(gd::String source) {
-  bool success = false;
+bool DatFile::Read(const gd::String& source) {
+  Close();
+  if (!MapFile(source)) return false;
 
-  // The input file stream from which we want informations
-  gd::FileStream datfile;
-  // A file entry in order to push it in the object's std::vector
-  sFileEntry entry;
+  if (m_dataSize < sizeof(sDATHeader)) {
+    Close();
+    return false;
+  }
+  memcpy(&m_header, m_data, sizeof(sDATHeader));
 
-  // Filling the header with 0
-  memset(&m_header, 0, sizeof(m_header));
-  // We open the DAT file to read it
-  datfile.open(source, std::ios_base::in | std::ios_base::binary);
-  if (datfile.is_open()) {
-    // Getting to the Header position
-    datfile.seekg(0, std::ios::beg);
-    // Reading the DAT Header
-    datfile.read((char*)&m_header, sizeof(sDATHeader));
-    // Next we are reading each file entry
+  if (memcmp(m_header.uniqueID, "EXEGD", 5) != 0) {
+    std::cout << "Invalid resource file " << source << std::endl;
+    Close();
+    return false;
+  }
+
+  if (memcmp(m_header.version, "0.2", 3) == 0) {
+    if (m_dataSize < headerSize) {
+      Close();
+      return false;
+    }
+    memcpy(&m_bucketsCount, m_data + sizeof(sDATHeader), sizeof(std::uint32_t));
+
+    std::uint64_t entriesSize =
+        std::uint64_t(m_header.nb_files) * sizeof(sFileEntryV2);
+    std::uint64_t bucketsSize =
+        std::uint64_t(m_bucketsCount) * sizeof(std::uint32_t);
+    if (m_bucketsCount == 0 || (m_bucketsCount & (m_bucketsCount - 1)) != 0 ||
+        m_bucketsCount < m_header.nb_files ||
+        headerSize + entriesSize + bucketsSize > m_dataSize) {
+      std::cout << "Invalid resource file " << source << std::endl;
+      Close();
+      return false;
+    }
+
+    // Entries and buckets are aligned, as the header size is a multiple of 8.
+    m_entries = reinterpret_cast<const sFileEntryV2*>(m_data + headerSize);
+    m_buckets = reinterpret_cast<const std::uint32_t*>(m_data + headerSize +
+                                                       entriesSize);
+    m_names = m_data + headerSize + entriesSize + bucketsSize;
+    std::uint64_t namesSize =
+        m_dataSize - (headerSize + entriesSize + bucketsSize);
+
+    // Check the file once, so that no check is needed when getting files.
     for (std::size_t i = 0; i < m_header.nb_files; i++) {
-      // Reading a File Entry
-      datfile.read((char*)&entry, sizeof(sFileEntry));
-      // Pushing it in our std::vector
-      m_entries.push_back(entry);
+      const sFileEntryV2& entry = m_entries[i];
+      if (entry.offset > m_dataSize || entry.size > m_dataSize - entry.offset ||
+          entry.nameOffset > namesSize ||
+          entry.nameSize > namesSize - entry.nameOffset ||
+          ((entry.flags & CompressedFile) == 0
+               ? entry.originalSize != entry.size
+               : entry.originalSize >
+                     gd::LZ4Block::UncompressBound(entry.size))) {
+        std::cout << "Invalid resource file " << source << std::endl;
+        Close();
+        return false;
+      }
+    }
+    for (std::size_t i = 0; i < m_bucketsCount; i++) {
+      if (m_buckets[i] > m_header.nb_files) {
+        std::cout << "Invalid resource file " << source << std::endl;
+        Close();
+        return false;
+      }
+    }
+  } else if (memcmp(m_header.version, "0.1", 3) == 0) {
+    // Version 0.1: the entries are read to build an index.
+    if (sizeof(sDATHeader) +
+            std::uint64_t(m_header.nb_files) * sizeof(sFileEntry) >
+        m_dataSize) {
+      std::cout << "Invalid resource file " << source << std::endl;
+      Close();
+      return false;
     }
-    // Since all seems ok, we keep the DAT file name
-    m_datfile = source;
-    success = true;
-  }
-  // Closing the DAT file
-  datfile.close();
-  return success;
-}
 
-////////////////////////////////////////////////////////////
-/// Check if the DatFile contains a file
-////////////////////////////////////////////////////////////
-bool DatFile::ContainsFile(const gd::String& filename) {
-  if (m_header.nb_files != m_entries.size()) return false;
+    sFileEntry entry;
+    m_legacyEntries.resize(m_header.nb_files);
+    for (std::size_t i = 0; i < m_header.nb_files; i++) {
+      memcpy(&entry,
+             m_data + sizeof(sDATHeader) + i * sizeof(sFileEntry),
+             sizeof(sFileEntry));
+      entry.name[sizeof(entry.name) - 1] = 0;
 
-  for (std::size_t i = 0; i < m_header.nb_files; i++) {
-    if (gd::String(m_entries[i].name) == filename) return true;
+      sFileEntryV2& legacyEntry = m_legacyEntries[i];
+      memset(&legacyEntry, 0, sizeof(sFileEntryV2));
+      legacyEntry.offset = entry.offset;
+      legacyEntry.size = entry.size;
+      legacyEntry.originalSize = entry.size;
+      if (entry.offset < 0 || entry.size < 0 ||
+          legacyEntry.offset > m_dataSize ||
+          legacyEntry.size > m_dataSize - legacyEntry.offset) {
+        std::cout << "Invalid resource file " << source << std::endl;
+        Close();
+        return false;
+      }
+
+      m_legacyIndex[gd::String(entry.name)] = i;
+    }
+    m_entries = m_legacyEntries.data();
+  } else {
+    std::cout << "Unsupported version of the resource file " << source
+              << std::endl;
+    Close();
+    return false;
   }
 
-  return false;
+  // Since all seems ok, we keep the DAT file name
+  m_datfile = source;
+  return true;
 }
 
-char* DatFile::GetFile(gd::String filename) {
-  // The input file stream from which we want information
+bool DatFile::MapFile(const gd::String& source) {
+#if defined(WINDOWS)
+  HANDLE file = CreateFileW(source.ToWide().c_str(),
+                            GENERIC_READ,
+                            FILE_SHARE_READ,
+                            NULL,
+                            OPEN_EXISTING,
+                            FILE_ATTRIBUTE_NORMAL,
+                            NULL);
+  if (file != INVALID_HANDLE_VALUE) {
+    LARGE_INTEGER size;
+    if (GetFileSizeEx(file, &size) && size.QuadPart > 0) {
+      HANDLE mapping =
+          CreateFileMappingW(file, NULL, PAGE_READONLY, 0, 0, NULL);
+      if (mapping != NULL) {
+        void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        if (view != NULL) {
+          m_fileHandle = file;
+          m_mappingHandle = mapping;
+          m_data = static_cast<const char*>(view);
+          m_dataSize = size.QuadPart;
+          return true;
+        }
+        CloseHandle(mapping);
+      }
+    }
+    CloseHandle(file);
+  }
+#else
+  int file = open(source.ToLocale().c_str(), O_RDONLY);
+  if (file != -1) {
+    struct stat fileStat;
+    if (fstat(file, &fileStat) == 0 && fileStat.st_size > 0) {
+      void* view =
+          mmap(NULL, fileStat.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+      if (view != MAP_FAILED) {
+        close(file);  // The mapping stays valid.
+        m_data = static_cast<const char*>(view);
+        m_dataSize = fileStat.st_size;
+        return true;
+      }
+    }
+    close(file);
+  }
+#endif
+
+  // The file can't be mapped in memory (it can be in an archive): read it.
   gd::FileStream datfile;
+  datfile.open(source, std::ios_base::in | std::ios_base::binary);
+  if (!datfile.is_open()) return false;
+
+  datfile.seekg(0, std::ios::end);
+  m_fileContent.resize(datfile.tellg());
+  datfile.seekg(0, std::ios::beg);
+  if (!m_fileContent.empty())
+    datfile.read(&m_fileContent[0], m_fileContent.size());
+  datfile.close();
+
+  m_data = m_fileContent.data();
+  m_dataSize = m_fileContent.size();
+  return true;
+}
 
-  // Cleaning properly an ancient file loaded
-  if (m_buffer != NULL) {
-    delete[] m_buffer;
-    m_buffer = NULL;
+void DatFile::Close() {
+  if (m_data != NULL && m_data != m_fileContent.data()) {
+#if defined(WINDOWS)
+    UnmapViewOfFile(m_data);
+    CloseHandle(m_mappingHandle);
+    CloseHandle(m_fileHandle);
+    m_mappingHandle = NULL;
+    m_fileHandle = NULL;
+#else
+    munmap(const_cast<char*>(m_data), m_dataSize);
+#endif
   }
 
-  // First, we have to find the file needed
-  for (std::size_t i = 0; i < m_header.nb_files; i++) {
-    // If we found it
-    if (gd::String(m_entries[i].name) == filename) {
-      // We are allocating memory to the buffer
-      m_buffer = new char[(m_entries[i].size)];
-      // Simple error catch
-      if (m_buffer == NULL) {
-        cout << "Unable to allocate a buffer of length " << (m_entries[i].size)
-             << " when loading " << filename << endl;
-        return (NULL);
-      }
+  m_data = NULL;
+  m_dataSize = 0;
+  m_fileContent.clear();
+  m_fileContent.shrink_to_fit();
+  m_entries = NULL;
+  m_buckets = NULL;
+  m_bucketsCount = 0;
+  m_names = NULL;
+  m_legacyEntries.clear();
+  m_legacyIndex.clear();
+  m_uncompressedFiles.clear();
+  memset(&m_header, 0, sizeof(m_header));
+  m_datfile.clear();
+}
 
-      // Opening the DAT file ot read the file datas needed
-      datfile.open(m_datfile, std::ios_base::in | std::ios_base::binary);
-      if (datfile.is_open()) {
-        // Going to the right position
-        datfile.seekg(m_entries[i].offset, std::ios::beg);
-        // Reading
-        datfile.read(m_buffer, m_entries[i].size);
-        // We can close the DAT file
-        datfile.close();
-        // Returning the buffer
-        cout << "Successfully loaded " << filename << endl;
-        return (m_buffer);
-      }
-      cout << "Unable to open file " << m_datfile << " when loading "
-           << filename << endl;
+const sFileEntryV2* DatFile::FindEntry(const gd::String& filename) const {
+  if (m_buckets != NULL) {
+    const std::string& name = filename.Raw();
+    std::uint32_t hash = HashName(name.data(), name.size());
+    std::uint32_t mask = m_bucketsCount - 1;
+    for (std::uint32_t i = 0, bucket = hash & mask; i < m_bucketsCount;
+         i++, bucket = (bucket + 1) & mask) {
+      std::uint32_t index = m_buckets[bucket];
+      if (index == 0) return NULL;
+
+      const sFileEntryV2& entry = m_entries[index - 1];
+      if (entry.nameHash == hash && entry.nameSize == name.size() &&
+          memcmp(m_names + entry.nameOffset, name.data(), name.size()) == 0)
+        return &entry;
     }
+
+    return NULL;
   }
-  // Finally, there is no such file in our DAT file
-  return (NULL);
+
+  auto it = m_legacyIndex.find(filename);
+  return it != m_legacyIndex.end() ? &m_legacyEntries[it->second] : NULL;
 }
 
-long int DatFile::GetFileSize(gd::String filename) {
-  // First, we have to find the file needed
-  for (std::size_t i = 0; i < m_header.nb_files; i++) {
-    // If we found it
-    if (gd::String(m_entries[i].name) == filename) {
-      // Returning the size of the file found
-      return (m_entries[i].size);
-    }
+////////////////////////////////////////////////////////////
+/// Check if the DatFile contains a file
+////////////////////////////////////////////////////////////
+bool DatFile::ContainsFile(const gd::String& filename) const {
+  return FindEntry(filename) != NULL;
+}
+
+const char* DatFile::GetFile(const gd::String& filename) {
+  const sFileEntryV2* entry = FindEntry(filename);
+  if (entry == NULL) return NULL;
+
+  const char* data = m_data + entry->offset;
+  if ((entry->flags & CompressedFile) == 0) return data;
+
+  // Compressed files are uncompressed once, and kept in memory.
+  {
+    std::lock_guard<std::mutex> lock(m_uncompressedFilesMutex);
+    auto it = m_uncompressedFiles.find(entry);
+    if (it != m_uncompressedFiles.end()) return it->second.data();
   }
-  return (0);
+
+  // The file is uncompressed without holding the lock, so that other
+  // threads can read files at the same time.
+  std::vector<char> buffer(entry->originalSize);
+  if (!gd::LZ4Block::Uncompress(
+          data, entry->size, buffer.data(), buffer.size())) {
+    cout << "Unable to uncompress " << filename << " from " << m_datfile
+         << endl;
+    return NULL;
+  }
+
+  // If another thread uncompressed the file in the meantime, its buffer is
+  // kept as it may already be used.
+  std::lock_guard<std::mutex> lock(m_uncompressedFilesMutex);
+  return m_uncompressedFiles.emplace(entry, std::move(buffer))
+      .first->second.data();
+}
+
+long int DatFile::GetFileSize(const gd::String& filename) const {
+  const sFileEntryV2* entry = FindEntry(filename);
+  return entry != NULL ? entry->originalSize : 0;
 }
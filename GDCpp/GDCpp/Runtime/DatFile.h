@@ -8,7 +8,11 @@
 #ifndef DATFILE_H
 #define DATFILE_H
 
+#include <cstdint>
+#include <map>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include "GDCpp/Runtime/String.h"
 
@@ -27,7 +31,8 @@ struct sDATHeader {
 };
 
 /**
- * \brief Internal class related to DatFile
+ * \brief Internal class related to DatFile: a file entry of the version 0.1
+ * of the format, which can still be read.
  *
  * \ingroup ResourcesManagement
  */
@@ -37,27 +42,115 @@ struct sFileEntry {
   long offset;      /// Offset, in the DAT file where the file is
 };
 
+/**
+ * \brief Internal class related to DatFile: a file entry of the version 0.2
+ * of the format.
+ *
+ * \ingroup ResourcesManagement
+ */
+struct sFileEntryV2 {
+  std::uint64_t offset;        /// Offset, in the DAT file where the file is
+  std::uint64_t size;          /// Size of the file in the DAT file
+  std::uint64_t originalSize;  /// Size of the file once uncompressed
+  std::uint32_t nameOffset;    /// Offset of the name in the names table
+  std::uint32_t nameSize;      /// Size of the name, in bytes
+  std::uint32_t nameHash;      /// Hash of the name
+  std::uint32_t flags;         /// DatFile::CompressedFile if compressed
+};
+
 /**
  * \brief Internal class used to create and access "DAT files".
  *
+ * The version 0.2 of the format is made to be memory mapped:
+ * - the header is followed by the number of buckets of a hash table, the
+ * file entries, the hash table (the index + 1 of the entries, or 0 for empty
+ * buckets, using linear probing), the names of the files and their data,
+ * - files are found without reading the whole table of entries, and their
+ * data is returned without being copied, unless they are compressed (using
+ * the LZ4 block format).
+ *
+ * DAT files of the version 0.1 (with fixed size names) can still be read.
+ *
  * \ingroup ResourcesManagement
  */
 class GD_API DatFile {
- private:
-  gd::String m_datfile;               /// name of the DAT file
-  sDATHeader m_header;                /// file header
-  std::vector<sFileEntry> m_entries;  /// vector of files entries
-  char* m_buffer;                     /// Buffer pointing on a file in memory
  public:
+  static const std::uint32_t CompressedFile = 1;
+
   DatFile(void);
   ~DatFile(void);
-  bool Create(std::vector<gd::String> files,
-              gd::String directory,
-              gd::String destination);
-  bool ContainsFile(const gd::String& filename);
-  bool Read(gd::String source);
-  char* GetFile(gd::String filename);
-  long int GetFileSize(gd::String filename);
+
+  /**
+   * \brief Create a DAT file containing the files (relative to \a directory).
+   * \param compress If true, files are compressed if it makes them smaller.
+   */
+  bool Create(const std::vector<gd::String>& files,
+              const gd::String& directory,
+              const gd::String& destination,
+              bool compress = false);
+
+  /**
+   * \brief Check if the DAT file contains a file.
+   */
+  bool ContainsFile(const gd::String& filename) const;
+
+  /**
+   * \brief Open a DAT file.
+   * \return true on success, false if the file can't be read or is not a
+   * valid DAT file of a known version.
+   */
+  bool Read(const gd::String& source);
+
+  /**
+   * \brief Return the content of a file, or NULL if the file does not exist.
+   *
+   * The content is not copied: it stays valid as long as the DatFile exists
+   * and no other DAT file is opened.
+   *
+   * \note Files can be read from several threads at the same time (but not
+   * while the DAT file is opened or closed).
+   */
+  const char* GetFile(const gd::String& filename);
+
+  /**
+   * \brief Return the size of a file (once uncompressed), or 0 if the file
+   * does not exist.
+   */
+  long int GetFileSize(const gd::String& filename) const;
+
+ private:
+  /**
+   * \brief Return the entry of a file, or NULL if the file does not exist.
+   */
+  const sFileEntryV2* FindEntry(const gd::String& filename) const;
+
+  bool MapFile(const gd::String& source);
+  void Close();
+
+  gd::String m_datfile;  /// name of the DAT file
+  sDATHeader m_header;   /// file header
+
+  const char* m_data;        /// The content of the DAT file
+  std::size_t m_dataSize;    /// The size of the DAT file
+  std::vector<char> m_fileContent;  /// The DAT file content when it can't be
+                                    /// mapped in memory.
+#if defined(WINDOWS)
+  void* m_fileHandle;
+  void* m_mappingHandle;
+#endif
+
+  const sFileEntryV2* m_entries;  /// The files entries
+  const std::uint32_t* m_buckets;  /// The hash table (version 0.2 only)
+  std::uint32_t m_bucketsCount;
+  const char* m_names;  /// The names of the files (version 0.2 only)
+
+  std::vector<sFileEntryV2> m_legacyEntries;  /// Entries of a version 0.1 file
+  std::unordered_map<gd::String, std::size_t>
+      m_legacyIndex;  /// Index of the entries of a version 0.1 file
+
+  std::map<const sFileEntryV2*, std::vector<char> >
+      m_uncompressedFiles;  /// The compressed files which were uncompressed
+  std::mutex m_uncompressedFilesMutex;  /// Protects m_uncompressedFiles
 };
 
 #endif  // DATFILE_H
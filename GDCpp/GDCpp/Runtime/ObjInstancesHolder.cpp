@@ -8,59 +8,132 @@
 #include "GDCpp/Runtime/profile.h"
 
 RuntimeObject* ObjInstancesHolder::AddObject(RuntimeObjSPtr&& object) {
-  auto it = objectsInstances[object->GetName()].insert(
-      objectsInstances[object->GetName()].end(), std::move(object));
-  objectsInstancesRefs[(*it)->GetName()].push_back(it->get());
+  RuntimeObject* objectPtr = object.get();
+  ObjectsList& list = GetList(object->GetName());
 
-  return it->get();
+  objectsSlots[objectPtr] = ObjectSlot{&list, list.objects.size()};
+  list.objects.push_back(std::move(object));
+  list.rawPointers.push_back(objectPtr);
+  list.addedObjectsIndices.push_back(addedObjectsCount++);
+  changesCount++;
+
+  return objectPtr;
+}
+
+ObjInstancesHolder::ObjectsList& ObjInstancesHolder::GetList(
+    const gd::String& name) {
+  auto it = objectsInstances.find(name);
+  if (it != objectsInstances.end()) return it->second;
+
+  ObjectsList& list = objectsInstances[name];
+  lists.push_back(&list);
+  return list;
+}
+
+const RuntimeObjList& ObjInstancesHolder::GetObjects(const gd::String& name) {
+  ObjectsList& list = GetList(name);
+  if (list.removedObjectsCount != 0) Compact(list);
+
+  return list.objects;
 }
 
 RuntimeObjNonOwningPtrList ObjInstancesHolder::GetObjectsRawPointers(
     const gd::String& name) {
-  return objectsInstancesRefs[name];
+  const ObjectsList& list = GetList(name);
+  listsAllocationsCount++;
+  if (list.removedObjectsCount == 0) return list.rawPointers;
+
+  RuntimeObjNonOwningPtrList objects;
+  objects.reserve(list.rawPointers.size() - list.removedObjectsCount);
+  for (RuntimeObject* object : list.rawPointers) {
+    if (object) objects.push_back(object);
+  }
+
+  return objects;
+}
+
+std::unique_ptr<RuntimeObject> ObjInstancesHolder::TakeObject(
+    const RuntimeObject* object) {
+  auto slotIt = objectsSlots.find(object);
+  if (slotIt == objectsSlots.end()) return nullptr;
+
+  ObjectsList& list = *slotIt->second.list;
+  std::size_t index = slotIt->second.index;
+  objectsSlots.erase(slotIt);
+  changesCount++;
+
+  // Leave the slot empty, so that the other objects keep their positions
+  // until the list is compacted.
+  std::unique_ptr<RuntimeObject> theObject = std::move(list.objects[index]);
+  list.rawPointers[index] = nullptr;
+  if (list.removedObjectsCount++ == 0) listsToCompact.push_back(&list);
+
+  return theObject;
+}
+
+void ObjInstancesHolder::RemoveObject(RuntimeObject* object) {
+  TakeObject(object);
+}
+
+void ObjInstancesHolder::RemoveObjects(const gd::String& name) {
+  ObjectsList& list = GetList(name);
+  for (RuntimeObject* object : list.rawPointers) {
+    if (object) objectsSlots.erase(object);
+  }
+
+  list.objects.clear();
+  list.rawPointers.clear();
+  list.addedObjectsIndices.clear();
+  list.removedObjectsCount = 0;
+  changesCount++;
 }
 
 void ObjInstancesHolder::ObjectNameHasChanged(const RuntimeObject* object) {
-  std::unique_ptr<RuntimeObject> theObject;  // We need the object to keep
-                                             // alive.
-
-  // Find and erase the object from the object lists.
-  for (auto it = objectsInstances.begin(); it != objectsInstances.end(); ++it) {
-    RuntimeObjList& list = it->second;
-    for (std::size_t i = 0; i < list.size(); ++i) {
-      if (list[i].get() == object) {
-        theObject = std::move(list[i]);
-        list.erase(list.begin() + i);
-        break;
-      }
+  std::unique_ptr<RuntimeObject> theObject =
+      TakeObject(object);  // We need the object to keep alive.
+  if (theObject) AddObject(std::move(theObject));
+}
+
+void ObjInstancesHolder::Compact() {
+  for (ObjectsList* list : listsToCompact) Compact(*list);
+
+  listsToCompact.clear();
+}
+
+void ObjInstancesHolder::Compact(ObjectsList& list) {
+  if (list.removedObjectsCount == 0) return;
+
+  std::size_t newSize = 0;
+  for (std::size_t i = 0; i < list.objects.size(); ++i) {
+    if (!list.objects[i]) continue;
+
+    if (newSize != i) {
+      list.objects[newSize] = std::move(list.objects[i]);
+      list.rawPointers[newSize] = list.rawPointers[i];
+      list.addedObjectsIndices[newSize] = list.addedObjectsIndices[i];
+      objectsSlots[list.rawPointers[newSize]].index = newSize;
     }
-  }
-  // Find and erase the object from the object raw pointers lists.
-  for (auto it = objectsInstancesRefs.begin(); it != objectsInstancesRefs.end();
-       ++it) {
-    RuntimeObjNonOwningPtrList& associatedList = it->second;
-    associatedList.erase(
-        std::remove(associatedList.begin(), associatedList.end(), object),
-        associatedList.end());
+    newSize++;
   }
 
-  AddObject(std::move(theObject));
+  list.objects.resize(newSize);
+  list.rawPointers.resize(newSize);
+  list.addedObjectsIndices.resize(newSize);
+  list.removedObjectsCount = 0;
 }
 
 void ObjInstancesHolder::Init(const ObjInstancesHolder& other) {
-  objectsInstances.clear();
-  objectsInstancesRefs.clear();
-
-  for (auto it = other.objectsInstances.cbegin();
-       it != other.objectsInstances.cend();
-       ++it) {
-    for (std::size_t i = 0; i < it->second.size();
-         ++i)  // We need to really copy the objects
-      AddObject(std::unique_ptr<RuntimeObject>(it->second[i]->Clone()));
+  Clear();
+
+  for (const ObjectsList* list : other.lists) {
+    for (RuntimeObject* object :
+         list->rawPointers)  // We need to really copy the objects
+      if (object) AddObject(std::unique_ptr<RuntimeObject>(object->Clone()));
   }
 }
 
-ObjInstancesHolder::ObjInstancesHolder(const ObjInstancesHolder& other) {
+ObjInstancesHolder::ObjInstancesHolder(const ObjInstancesHolder& other)
+    : addedObjectsCount(0), changesCount(0), listsAllocationsCount(0) {
   Init(other);
 }
 
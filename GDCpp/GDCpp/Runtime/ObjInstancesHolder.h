@@ -20,6 +20,12 @@ using RuntimeObjSPtr = std::unique_ptr<RuntimeObject>;
 /**
  * \brief Contains lists of objects classified by the name of the objects.
  *
+ * The container remembers the position of each object in its list, so that
+ * removing an object (or changing its name) is done in constant time: the
+ * object is destroyed and its slot is left empty. Empty slots are removed,
+ * keeping the order of the objects, by Compact (called by the scene at the end
+ * of each frame) or when the list of objects is requested.
+ *
  * \see RuntimeScene
  * \ingroup GameEngine
  */
@@ -28,7 +34,8 @@ class GD_API ObjInstancesHolder {
   /**
    * \brief Default constructor
    */
-  ObjInstancesHolder(){};
+  ObjInstancesHolder()
+      : addedObjectsCount(0), changesCount(0), listsAllocationsCount(0){};
 
   /**
    * \brief Copy constructor
@@ -55,10 +62,11 @@ class GD_API ObjInstancesHolder {
 
   /**
    * \brief Get all objects with the specified name
+   *
+   * \warning The list is compacted, so this must not be called while iterating
+   * on the objects with ForEachObject.
    */
-  inline const RuntimeObjList& GetObjects(const gd::String& name) {
-    return objectsInstances[name];
-  }
+  const RuntimeObjList& GetObjects(const gd::String& name);
 
   /**
    * \brief Get a "raw pointers" list to objects with the specified name
@@ -67,20 +75,60 @@ class GD_API ObjInstancesHolder {
 
   /**
    * \brief Get a list of all objects contained.
+   *
+   * \note Prefer ForEachObject when the list is not kept, to avoid allocating
+   * it.
    */
   inline RuntimeObjNonOwningPtrList GetAllObjects() {
     RuntimeObjNonOwningPtrList objList;
+    objList.reserve(objectsSlots.size());
+    ForEachObject([&objList](RuntimeObject* object) {
+      objList.push_back(object);
+    });
+    listsAllocationsCount++;
 
-    for (auto it = objectsInstances.begin(); it != objectsInstances.end();
-         ++it) {
-      for (auto it2 = it->second.begin(); it2 != it->second.end(); ++it2) {
-        objList.push_back(it2->get());
+    return objList;
+  }
+
+  /**
+   * \brief Call \a function for each object contained, grouped by name, in the
+   * order they were added.
+   *
+   * Objects can be added, removed or renamed by \a function: objects
+   * removed before being visited are skipped, and objects added during the
+   * iteration are not visited. Renamed objects are considered as added again,
+   * so that they are never visited twice.
+   */
+  template <typename Function>
+  void ForEachObject(Function function) {
+    std::size_t iterationEnd = addedObjectsCount;
+    for (std::size_t i = 0; i < lists.size(); ++i) {
+      ObjectsList& list = *lists[i];
+      for (std::size_t j = 0; j < list.rawPointers.size(); ++j) {
+        RuntimeObject* object = list.rawPointers[j];
+        if (object && list.addedObjectsIndices[j] < iterationEnd)
+          function(object);
       }
     }
+  }
 
-    return objList;
+  /**
+   * \brief Return the number of lists of objects allocated by GetAllObjects and
+   * GetObjectsRawPointers since the container was created.
+   *
+   * \note This is used by the profiler to show the lists allocated during a
+   * frame.
+   */
+  std::size_t GetListsAllocationsCount() const {
+    return listsAllocationsCount;
   }
 
+  /**
+   * \brief Return a number that is changed every time an object is added,
+   * removed or renamed.
+   */
+  std::size_t GetChangesCount() const { return changesCount; }
+
   /**
    * \brief Remove an object
    *
@@ -90,36 +138,12 @@ class GD_API ObjInstancesHolder {
    * scene.objectsInstances.ObjectNameHasChanged(myObject);
    * \endcode
    */
-  inline void RemoveObject(RuntimeObject* object) {
-    for (auto it = objectsInstances.begin(); it != objectsInstances.end();
-         ++it) {
-      RuntimeObjList& associatedList = it->second;
-      associatedList.erase(
-          std::remove_if(
-              associatedList.begin(),
-              associatedList.end(),
-              [&object](const std::unique_ptr<RuntimeObject>& objectPtr) {
-                return objectPtr.get() == object;
-              }),
-          associatedList.end());
-    }
-    for (auto it = objectsInstancesRefs.begin();
-         it != objectsInstancesRefs.end();
-         ++it) {
-      RuntimeObjNonOwningPtrList& associatedList = it->second;
-      associatedList.erase(
-          std::remove(associatedList.begin(), associatedList.end(), object),
-          associatedList.end());
-    }
-  }
+  void RemoveObject(RuntimeObject* object);
 
   /**
    * \brief Remove an entire list of object with a given name
    */
-  inline void RemoveObjects(const gd::String& name) {
-    objectsInstances[name].clear();
-    objectsInstancesRefs[name].clear();
-  }
+  void RemoveObjects(const gd::String& name);
 
   /**
    * \brief To be called when an object has changed its name.
@@ -131,18 +155,62 @@ class GD_API ObjInstancesHolder {
    * \note All objects contained inside are destroyed.
    */
   inline void Clear() {
+    changesCount++;
     objectsInstances.clear();
-    objectsInstancesRefs.clear();
+    lists.clear();
+    objectsSlots.clear();
+    listsToCompact.clear();
   }
 
+  /**
+   * \brief Remove the empty slots left by the objects removed (or renamed)
+   * since the last call, keeping the order of the other objects.
+   *
+   * \note This is done at the end of each frame by the scene.
+   */
+  void Compact();
+
  private:
+  /**
+   * \brief The objects having the same name. Removed objects leave a null
+   * slot in both lists until the lists are compacted.
+   */
+  struct ObjectsList {
+    ObjectsList() : removedObjectsCount(0){};
+
+    RuntimeObjList objects;
+    RuntimeObjNonOwningPtrList
+        rawPointers;  ///< Same as objects, but with raw pointers.
+    std::vector<std::size_t>
+        addedObjectsIndices;  ///< For each object, the number of objects added
+                              ///< to the container before it.
+    std::size_t removedObjectsCount;  ///< The number of null slots.
+  };
+
+  /**
+   * \brief The position of an object in the lists.
+   */
+  struct ObjectSlot {
+    ObjectsList* list;
+    std::size_t index;
+  };
+
   void Init(const ObjInstancesHolder& other);
+  std::unique_ptr<RuntimeObject> TakeObject(const RuntimeObject* object);
+  ObjectsList& GetList(const gd::String& name);
+  void Compact(ObjectsList& list);
 
-  std::unordered_map<gd::String, RuntimeObjList>
+  std::unordered_map<gd::String, ObjectsList>
       objectsInstances;  ///< The list of all objects, classified by name
-  std::unordered_map<gd::String, RuntimeObjNonOwningPtrList>
-      objectsInstancesRefs;  ///< Clones of the objectsInstances lists, but with
-                             ///< references instead.
+  std::vector<ObjectsList*>
+      lists;  ///< The lists of objectsInstances, in the order of creation.
+  std::unordered_map<const RuntimeObject*, ObjectSlot>
+      objectsSlots;  ///< The position of each object in objectsInstances.
+  std::vector<ObjectsList*>
+      listsToCompact;  ///< The lists having at least a null slot.
+  std::size_t addedObjectsCount;
+  std::size_t changesCount;
+  std::size_t listsAllocationsCount;
 };
 
 #endif  // OBJINSTANCESHOLDER_H
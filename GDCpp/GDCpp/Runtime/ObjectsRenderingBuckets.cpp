@@ -0,0 +1,105 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCpp/Runtime/ObjectsRenderingBuckets.h"
+#include <algorithm>
+#include "GDCpp/Runtime/ObjInstancesHolder.h"
+#include "GDCpp/Runtime/RuntimeLayer.h"
+#include "GDCpp/Runtime/RuntimeObject.h"
+
+namespace {
+bool IsOnALayer(const RuntimeObject* object,
+                const std::vector<RuntimeLayer>& layers) {
+  for (const RuntimeLayer& layer : layers) {
+    if (object->GetLayer() == layer.GetName()) return true;
+  }
+
+  return false;
+}
+}  // namespace
+
+ObjectsRenderingBuckets::ObjectsRenderingBuckets()
+    : objectsChangesCount(0), classified(false), sortsCount(0) {}
+
+void ObjectsRenderingBuckets::Update(ObjInstancesHolder& objects,
+                                     const std::vector<RuntimeLayer>& layers) {
+  if (!IsUpToDate(objects, layers)) Classify(objects, layers);
+
+  for (Bucket& bucket : buckets) {
+    for (std::size_t i = 0; i < bucket.entries.size() && bucket.sorted; ++i) {
+      if (bucket.entries[i].object->GetZOrder() != bucket.entries[i].zOrder)
+        bucket.sorted = false;
+    }
+
+    if (!bucket.sorted) Sort(bucket);
+  }
+}
+
+bool ObjectsRenderingBuckets::IsUpToDate(
+    const ObjInstancesHolder& objects,
+    const std::vector<RuntimeLayer>& layers) const {
+  if (!classified || objects.GetChangesCount() != objectsChangesCount ||
+      layers.size() != buckets.size())
+    return false;
+
+  for (std::size_t i = 0; i < buckets.size(); ++i) {
+    const Bucket& bucket = buckets[i];
+    if (bucket.layerName != layers[i].GetName()) return false;
+
+    for (const Entry& entry : bucket.entries) {
+      if (entry.object->GetLayer() != bucket.layerName) return false;
+    }
+  }
+
+  for (const RuntimeObject* object : objectsOutsideLayers) {
+    if (IsOnALayer(object, layers)) return false;
+  }
+
+  return true;
+}
+
+void ObjectsRenderingBuckets::Classify(
+    ObjInstancesHolder& objects, const std::vector<RuntimeLayer>& layers) {
+  buckets.resize(layers.size());
+  for (std::size_t i = 0; i < buckets.size(); ++i) {
+    buckets[i].layerName = layers[i].GetName();
+    buckets[i].entries.clear();
+    buckets[i].sorted = false;
+  }
+  objectsOutsideLayers.clear();
+
+  std::size_t order = 0;
+  objects.ForEachObject([this, &order](RuntimeObject* object) {
+    for (Bucket& bucket : buckets) {
+      if (object->GetLayer() == bucket.layerName) {
+        bucket.entries.push_back(Entry{object->GetZOrder(), order++, object});
+        return;
+      }
+    }
+
+    objectsOutsideLayers.push_back(object);
+  });
+
+  objectsChangesCount = objects.GetChangesCount();
+  classified = true;
+}
+
+void ObjectsRenderingBuckets::Sort(Bucket& bucket) {
+  for (Entry& entry : bucket.entries) entry.zOrder = entry.object->GetZOrder();
+
+  std::sort(bucket.entries.begin(),
+            bucket.entries.end(),
+            [](const Entry& a, const Entry& b) {
+              return a.zOrder < b.zOrder ||
+                     (a.zOrder == b.zOrder && a.order < b.order);
+            });
+
+  bucket.objects.clear();
+  for (const Entry& entry : bucket.entries)
+    bucket.objects.push_back(entry.object);
+
+  bucket.sorted = true;
+  sortsCount++;
+}
@@ -0,0 +1,86 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef OBJECTSRENDERINGBUCKETS_H
+#define OBJECTSRENDERINGBUCKETS_H
+#include <vector>
+#include "GDCpp/Runtime/String.h"
+class ObjInstancesHolder;
+class RuntimeLayer;
+class RuntimeObject;
+
+/**
+ * \brief The objects of a scene, classified by layer and sorted by Z order,
+ * used to render the scene.
+ *
+ * The objects are classified again only when objects were added, removed or
+ * renamed, or when an object changed of layer. Otherwise, only the layers
+ * where the Z order of an object changed are sorted again.
+ *
+ * \see RuntimeScene
+ * \ingroup GameEngine
+ */
+class GD_API ObjectsRenderingBuckets {
+ public:
+  ObjectsRenderingBuckets();
+  virtual ~ObjectsRenderingBuckets(){};
+
+  /**
+   * \brief Update the objects of each layer, so that they are sorted by Z
+   * order.
+   *
+   * Objects with the same Z order are sorted in the order they are iterated
+   * by ObjInstancesHolder::ForEachObject.
+   */
+  void Update(ObjInstancesHolder& objects,
+              const std::vector<RuntimeLayer>& layers);
+
+  /**
+   * \brief Return the objects of the layer at the specified index in the
+   * layers passed to Update, sorted by Z order.
+   */
+  const std::vector<RuntimeObject*>& GetLayerObjects(
+      std::size_t layerIndex) const {
+    return buckets[layerIndex].objects;
+  }
+
+  /**
+   * \brief Return the number of times the objects of a layer were sorted.
+   */
+  std::size_t GetSortsCount() const { return sortsCount; }
+
+ private:
+  struct Entry {
+    int zOrder;         ///< The Z order of the object when sorted.
+    std::size_t order;  ///< The order of the object in the container, used to
+                        ///< sort objects with the same Z order.
+    RuntimeObject* object;
+  };
+
+  struct Bucket {
+    Bucket() : sorted(false){};
+
+    gd::String layerName;
+    std::vector<Entry> entries;
+    std::vector<RuntimeObject*> objects;  ///< The objects, sorted by Z order.
+    bool sorted;
+  };
+
+  bool IsUpToDate(const ObjInstancesHolder& objects,
+                  const std::vector<RuntimeLayer>& layers) const;
+  void Classify(ObjInstancesHolder& objects,
+                const std::vector<RuntimeLayer>& layers);
+  void Sort(Bucket& bucket);
+
+  std::vector<Bucket> buckets;  ///< A bucket for each layer.
+  std::vector<RuntimeObject*>
+      objectsOutsideLayers;  ///< Objects on a layer that does not exist.
+  std::size_t objectsChangesCount;  ///< The changes count of the objects
+                                    ///< container when classified.
+  bool classified;
+  std::size_t sortsCount;
+};
+
+#endif  // OBJECTSRENDERINGBUCKETS_H
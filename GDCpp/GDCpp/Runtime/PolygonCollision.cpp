@@ -9,6 +9,12 @@
 #include <cmath>
 #include "GDCpp/Runtime/Polygon2d.h"
 
+#if defined(__SSE__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define GD_POLYGONCOLLISION_USE_SSE
+#include <xmmintrin.h>
+#endif
+
 namespace {
 
 void normalise(sf::Vector2f& v) {
@@ -59,11 +65,145 @@ float distance(float minA, float maxA, float minB, float maxB) {
     return minA - maxB;
 }
 
+// Operations on 4 floats, used by PolygonCollisionTestBatch to handle 4 axes
+// at once. The scalar versions give the same results as the SSE ones (and as
+// project and distance), including for ties between zeros of different signs.
+#if defined(GD_POLYGONCOLLISION_USE_SSE)
+typedef __m128 Lanes;
+
+inline Lanes load(const float* values) { return _mm_loadu_ps(values); }
+inline void store(float* values, Lanes lanes) { _mm_storeu_ps(values, lanes); }
+inline Lanes splat(float value) { return _mm_set1_ps(value); }
+inline Lanes dotProduct(Lanes ax, Lanes ay, Lanes bx, Lanes by) {
+  return _mm_add_ps(_mm_mul_ps(ax, bx), _mm_mul_ps(ay, by));
+}
+inline Lanes minimum(Lanes value, Lanes min) { return _mm_min_ps(value, min); }
+inline Lanes maximum(Lanes value, Lanes max) { return _mm_max_ps(value, max); }
+inline Lanes distance(Lanes minA, Lanes maxA, Lanes minB, Lanes maxB) {
+  Lanes isMinALower = _mm_cmplt_ps(minA, minB);
+  return _mm_or_ps(_mm_and_ps(isMinALower, _mm_sub_ps(minB, maxA)),
+                   _mm_andnot_ps(isMinALower, _mm_sub_ps(minA, maxB)));
+}
+#else
+struct Lanes {
+  float values[4];
+};
+
+inline Lanes load(const float* values) {
+  Lanes lanes;
+  for (int i = 0; i < 4; ++i) lanes.values[i] = values[i];
+  return lanes;
+}
+inline void store(float* values, Lanes lanes) {
+  for (int i = 0; i < 4; ++i) values[i] = lanes.values[i];
+}
+inline Lanes splat(float value) {
+  Lanes lanes;
+  for (int i = 0; i < 4; ++i) lanes.values[i] = value;
+  return lanes;
+}
+inline Lanes dotProduct(Lanes ax, Lanes ay, Lanes bx, Lanes by) {
+  Lanes lanes;
+  for (int i = 0; i < 4; ++i)
+    lanes.values[i] =
+        ax.values[i] * bx.values[i] + ay.values[i] * by.values[i];
+  return lanes;
+}
+inline Lanes minimum(Lanes value, Lanes min) {
+  for (int i = 0; i < 4; ++i)
+    if (value.values[i] < min.values[i]) min.values[i] = value.values[i];
+  return min;
+}
+inline Lanes maximum(Lanes value, Lanes max) {
+  for (int i = 0; i < 4; ++i)
+    if (value.values[i] > max.values[i]) max.values[i] = value.values[i];
+  return max;
+}
+inline Lanes distance(Lanes minA, Lanes maxA, Lanes minB, Lanes maxB) {
+  Lanes lanes;
+  for (int i = 0; i < 4; ++i)
+    lanes.values[i] = distance(
+        minA.values[i], maxA.values[i], minB.values[i], maxB.values[i]);
+  return lanes;
+}
+#endif
+
+/**
+ * Project the vertices of the polygon on 4 axes (see project).
+ */
+void project(Lanes axesX,
+             Lanes axesY,
+             const Polygon2dSoA& p,
+             Lanes& min,
+             Lanes& max) {
+  Lanes dp = dotProduct(
+      axesX, axesY, splat(p.verticesX[0]), splat(p.verticesY[0]));
+
+  min = dp;
+  max = dp;
+
+  for (std::size_t i = 1; i < p.GetVerticesCount(); i++) {
+    dp = dotProduct(
+        axesX, axesY, splat(p.verticesX[i]), splat(p.verticesY[i]));
+
+    min = minimum(dp, min);
+    max = maximum(dp, max);
+  }
+}
+
+/**
+ * Project the polygons on the axes of axesPolygon, updating the smallest
+ * distance and its axis as done by PolygonCollisionTest.
+ *
+ * \return false if the polygons are separated on one of the axes.
+ */
+bool testAxes(const Polygon2dSoA& axesPolygon,
+              const Polygon2dSoA& p1,
+              const Polygon2dSoA& p2,
+              bool ignoreTouchingEdges,
+              float& min_dist,
+              sf::Vector2f& move_axis) {
+  const std::size_t axesCount = axesPolygon.GetVerticesCount();
+  for (std::size_t i = 0; i < axesCount; i += 4) {
+    Lanes axesX = load(&axesPolygon.axesX[i]);
+    Lanes axesY = load(&axesPolygon.axesY[i]);
+
+    Lanes minA, maxA, minB, maxB;
+    project(axesX, axesY, p1, minA, maxA);
+    project(axesX, axesY, p2, minB, maxB);
+
+    float distances[4];
+    store(distances, distance(minA, maxA, minB, maxB));
+
+    const std::size_t lanesCount = std::min<std::size_t>(4, axesCount - i);
+    for (std::size_t lane = 0; lane < lanesCount; ++lane) {
+      float dist = distances[lane];
+      if (dist > 0.0f || (dist == 0.0 && ignoreTouchingEdges)) return false;
+
+      float absDist = std::abs(dist);
+      if (absDist < min_dist) {
+        min_dist = absDist;
+        move_axis.x = axesPolygon.axesX[i + lane];
+        move_axis.y = axesPolygon.axesY[i + lane];
+      }
+    }
+  }
+
+  return true;
+}
+
 }  // namespace
 
 CollisionResult GD_API PolygonCollisionTest(Polygon2d& p1,
                                             Polygon2d& p2,
                                             bool ignoreTouchingEdges) {
+  p1.ComputeEdges();
+  p2.ComputeEdges();
+  return PolygonCollisionTestWithEdges(p1, p2, ignoreTouchingEdges);
+}
+
+CollisionResult GD_API PolygonCollisionTestWithEdges(
+    const Polygon2d& p1, const Polygon2d& p2, bool ignoreTouchingEdges) {
   if (p1.vertices.size() < 3 || p2.vertices.size() < 3) {
     CollisionResult result;
     result.collision = false;
@@ -72,9 +212,6 @@ CollisionResult GD_API PolygonCollisionTest(Polygon2d& p1,
     return result;
   }
 
-  p1.ComputeEdges();
-  p2.ComputeEdges();
-
   sf::Vector2f edge;
   sf::Vector2f move_axis(0, 0);
   sf::Vector2f mtd(0, 0);
@@ -134,6 +271,12 @@ CollisionResult GD_API PolygonCollisionTest(Polygon2d& p1,
 
 RaycastResult GD_API PolygonRaycastTest(
     Polygon2d& poly, float startX, float startY, float endX, float endY) {
+  poly.ComputeEdges();
+  return PolygonRaycastTestWithEdges(poly, startX, startY, endX, endY);
+}
+
+RaycastResult GD_API PolygonRaycastTestWithEdges(
+    const Polygon2d& poly, float startX, float startY, float endX, float endY) {
   RaycastResult result;
   result.collision = false;
 
@@ -141,7 +284,6 @@ RaycastResult GD_API PolygonRaycastTest(
     return result;
   }
 
-  poly.ComputeEdges();
   sf::Vector2f p, q, r, s;
   float minSqDist = FLT_MAX;
 
@@ -216,7 +358,77 @@ RaycastResult GD_API PolygonRaycastTest(
   return result;
 }
 
-bool GD_API IsPointInsidePolygon(Polygon2d& poly, float x, float y) {
+void Polygon2dSoA::Set(const Polygon2d& polygon) {
+  verticesCount = polygon.vertices.size();
+  const std::size_t axesCount = (verticesCount + 3) / 4 * 4;
+  verticesX.resize(verticesCount);
+  verticesY.resize(verticesCount);
+  axesX.resize(axesCount);
+  axesY.resize(axesCount);
+
+  for (std::size_t i = 0; i < verticesCount; ++i) {
+    verticesX[i] = polygon.vertices[i].x;
+    verticesY[i] = polygon.vertices[i].y;
+
+    // Compute the axis as PolygonCollisionTest does, from the edge computed by
+    // Polygon2d::ComputeEdges.
+    sf::Vector2f edge =
+        polygon.vertices[i + 1 < verticesCount ? i + 1 : 0] -
+        polygon.vertices[i];
+    sf::Vector2f axis(-edge.y, edge.x);
+    normalise(axis);
+    axesX[i] = axis.x;
+    axesY[i] = axis.y;
+  }
+  for (std::size_t i = verticesCount; i < axesCount; ++i) {
+    axesX[i] = axesX[verticesCount - 1];
+    axesY[i] = axesY[verticesCount - 1];
+  }
+
+  center = verticesCount != 0 ? polygon.ComputeCenter() : sf::Vector2f(0, 0);
+}
+
+void GD_API
+PolygonCollisionTestBatch(const Polygon2dSoA& polygon,
+                          const std::vector<Polygon2dSoA>& candidates,
+                          bool ignoreTouchingEdges,
+                          std::vector<CollisionResult>& results) {
+  results.resize(candidates.size());
+  for (std::size_t i = 0; i < candidates.size(); ++i) {
+    const Polygon2dSoA& candidate = candidates[i];
+    CollisionResult& result = results[i];
+    result.collision = false;
+    result.move_axis.x = 0.0f;
+    result.move_axis.y = 0.0f;
+
+    if (polygon.GetVerticesCount() < 3 || candidate.GetVerticesCount() < 3)
+      continue;
+
+    sf::Vector2f move_axis(0, 0);
+    float min_dist = FLT_MAX;
+    if (!testAxes(polygon,
+                  polygon,
+                  candidate,
+                  ignoreTouchingEdges,
+                  min_dist,
+                  move_axis) ||
+        !testAxes(candidate,
+                  polygon,
+                  candidate,
+                  ignoreTouchingEdges,
+                  min_dist,
+                  move_axis))
+      continue;
+
+    result.collision = true;
+
+    sf::Vector2f d = polygon.center - candidate.center;
+    if (dotProduct(d, move_axis) < 0.0f) move_axis = -move_axis;
+    result.move_axis = move_axis * min_dist;
+  }
+}
+
+bool GD_API IsPointInsidePolygon(const Polygon2d& poly, float x, float y) {
   bool inside = false;
   sf::Vector2f vi, vj;
 
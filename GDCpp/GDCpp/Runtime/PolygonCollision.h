@@ -6,6 +6,7 @@
 #ifndef POLYGONCOLLISION_H
 #define POLYGONCOLLISION_H
 #include <SFML/System.hpp>
+#include <vector>
 class Polygon2d;
 
 /**
@@ -48,6 +49,75 @@ CollisionResult GD_API PolygonCollisionTest(Polygon2d& p1,
                                             Polygon2d& p2,
                                             bool ignoreTouchingEdges = false);
 
+/**
+ * Same as PolygonCollisionTest, for polygons with their edges already computed
+ * (see Polygon2d::ComputeEdges), like the hitboxes returned by
+ * RuntimeObject::GetCachedHitBoxes.
+ *
+ * \ingroup GameEngine
+ */
+CollisionResult GD_API PolygonCollisionTestWithEdges(
+    const Polygon2d& p1, const Polygon2d& p2, bool ignoreTouchingEdges = false);
+
+/**
+ * \brief A convex polygon stored as a structure of arrays (coordinates of the
+ * vertices, and the normalized axes on which polygons are projected by the
+ * Separating Axis Theorem), to be tested with PolygonCollisionTestBatch.
+ *
+ * Axes are padded to a multiple of 4 elements, so that they can be loaded
+ * in SIMD registers.
+ *
+ * \see PolygonCollisionTestBatch
+ * \ingroup GameEngine
+ */
+class GD_API Polygon2dSoA {
+ public:
+  Polygon2dSoA() : verticesCount(0){};
+  explicit Polygon2dSoA(const Polygon2d& polygon) { Set(polygon); };
+  virtual ~Polygon2dSoA(){};
+
+  /**
+   * \brief Store the vertices of the polygon and compute its axes and its
+   * center.
+   */
+  void Set(const Polygon2d& polygon);
+
+  /**
+   * \brief Return the number of vertices (and axes) of the polygon.
+   */
+  std::size_t GetVerticesCount() const { return verticesCount; }
+
+  std::vector<float> verticesX;
+  std::vector<float> verticesY;
+  std::vector<float> axesX;  ///< Padded with the last axis.
+  std::vector<float> axesY;  ///< Padded with the last axis.
+  sf::Vector2f center;       ///< See Polygon2d::ComputeCenter.
+
+ private:
+  std::size_t verticesCount;
+};
+
+/**
+ * Do a collision test between a polygon and each of the candidates, with the
+ * same results as PolygonCollisionTest (for polygons with finite coordinates).
+ *
+ * Polygons are projected on 4 axes at once, using SSE instructions when
+ * available.
+ *
+ * \param polygon The polygon to be tested against the candidates
+ * \param candidates The other polygons
+ * \param ignoreTouchingEdges See PolygonCollisionTest
+ * \param results Filled with the result of each test, in the same order as the
+ * candidates.
+ *
+ * \ingroup GameEngine
+ */
+void GD_API
+PolygonCollisionTestBatch(const Polygon2dSoA& polygon,
+                          const std::vector<Polygon2dSoA>& candidates,
+                          bool ignoreTouchingEdges,
+                          std::vector<CollisionResult>& results);
+
 /**
  * Do a raycast test.
  * \warning Polygon must be convex.
@@ -61,6 +131,15 @@ CollisionResult GD_API PolygonCollisionTest(Polygon2d& p1,
 RaycastResult GD_API PolygonRaycastTest(
     Polygon2d& poly, float startX, float startY, float endX, float endY);
 
+/**
+ * Same as PolygonRaycastTest, for a polygon with its edges already computed
+ * (see Polygon2d::ComputeEdges).
+ *
+ * \ingroup GameEngine
+ */
+RaycastResult GD_API PolygonRaycastTestWithEdges(
+    const Polygon2d& poly, float startX, float startY, float endX, float endY);
+
 /**
  * Check if a point is inside a polygon.
  *
@@ -71,6 +150,6 @@ RaycastResult GD_API PolygonRaycastTest(
  *
  * \ingroup GameEngine
  */
-bool GD_API IsPointInsidePolygon(Polygon2d& poly, float x, float y);
+bool GD_API IsPointInsidePolygon(const Polygon2d& poly, float x, float y);
 
 #endif  // POLYGONCOLLISION_H
@@ -0,0 +1,8 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#if !defined(GD_IDE_ONLY)
+#include "GDCore/Project/TextureAtlas.cpp"
+#endif
@@ -36,12 +36,12 @@ bool ResourcesLoader::SetResourceFile(const gd::String& filename) {
 void ResourcesLoader::LoadSFMLImage(const gd::String& filename,
                                     sf::Image& image) {
   if (resFile.ContainsFile(filename)) {
-    char* buffer = resFile.GetFile(filename);
+    // Files are read directly from the resource file mapped in memory.
+    const char* buffer = resFile.GetFile(filename);
     if (buffer == NULL)
       cout << "Failed to get the file of a SFML image from resource file: "
            << filename << endl;
-
-    if (!image.loadFromMemory(buffer, resFile.GetFileSize(filename)))
+    else if (!image.loadFromMemory(buffer, resFile.GetFileSize(filename)))
       cout << "Failed to load a SFML image from resource file: " << filename
            << endl;
   } else {
@@ -62,12 +62,11 @@ sf::Texture ResourcesLoader::LoadSFMLTexture(const gd::String& filename) {
 void ResourcesLoader::LoadSFMLTexture(const gd::String& filename,
                                       sf::Texture& texture) {
   if (resFile.ContainsFile(filename)) {
-    char* buffer = resFile.GetFile(filename);
+    const char* buffer = resFile.GetFile(filename);
     if (buffer == NULL)
       cout << "Failed to get the file of a SFML texture from resource file: "
            << filename << endl;
-
-    if (!texture.loadFromMemory(buffer, resFile.GetFileSize(filename)))
+    else if (!texture.loadFromMemory(buffer, resFile.GetFileSize(filename)))
       cout << "Failed to load a SFML texture from resource file: " << filename
            << endl;
   } else {
@@ -80,7 +79,7 @@ void ResourcesLoader::LoadSFMLTexture(const gd::String& filename,
 std::pair<sf::Font*, StreamHolder*> ResourcesLoader::LoadFont(
     const gd::String& filename) {
   if (resFile.ContainsFile(filename)) {
-    char* buffer = resFile.GetFile(filename);
+    const char* buffer = resFile.GetFile(filename);
     size_t bufferSize = resFile.GetFileSize(filename);
     if (buffer == nullptr) {
       cout << "Failed to get the file of a font from resource file:" << filename
@@ -88,20 +87,16 @@ std::pair<sf::Font*, StreamHolder*> ResourcesLoader::LoadFont(
       return std::make_pair((sf::Font*)nullptr, (StreamHolder*)nullptr);
     }
 
+    // The buffer stays valid as long as the resource file is opened, so no
+    // copy is needed to keep it alive while the font is used.
     sf::Font* font = new sf::Font();
-    char* fontBuffer = new char[bufferSize];
-    memcpy(fontBuffer, buffer, bufferSize);
-
-    if (!font->loadFromMemory(fontBuffer, bufferSize)) {
+    if (!font->loadFromMemory(buffer, bufferSize)) {
       cout << "Failed to load a font from resource file: " << filename << endl;
       delete font;
-      delete fontBuffer;
       return std::make_pair((sf::Font*)nullptr, (StreamHolder*)nullptr);
     }
 
-    StreamHolder* streamHolder = new StreamHolder();
-    streamHolder->buffer = fontBuffer;
-    return std::make_pair(font, streamHolder);
+    return std::make_pair(font, (StreamHolder*)nullptr);
   } else {
     sf::Font* font = new sf::Font();
     StreamHolder* streamHolder = new StreamHolder();
@@ -120,14 +115,19 @@ std::pair<sf::Font*, StreamHolder*> ResourcesLoader::LoadFont(
 
 sf::SoundBuffer ResourcesLoader::LoadSoundBuffer(const gd::String& filename) {
   sf::SoundBuffer sbuffer;
+  LoadSoundBuffer(filename, sbuffer);
+
+  return sbuffer;
+}
 
+void ResourcesLoader::LoadSoundBuffer(const gd::String& filename,
+                                      sf::SoundBuffer& sbuffer) {
   if (resFile.ContainsFile(filename)) {
-    char* buffer = resFile.GetFile(filename);
+    const char* buffer = resFile.GetFile(filename);
     if (buffer == NULL)
       cout << "Failed to get the file of a sound buffer from resource file: "
            << filename << endl;
-
-    if (!sbuffer.loadFromMemory(buffer, resFile.GetFileSize(filename)))
+    else if (!sbuffer.loadFromMemory(buffer, resFile.GetFileSize(filename)))
       cout << "Failed to load a sound buffer from resource file: " << filename
            << endl;
   } else {
@@ -135,22 +135,21 @@ sf::SoundBuffer ResourcesLoader::LoadSoundBuffer(const gd::String& filename) {
     if (!stream.open(filename) || !sbuffer.loadFromStream(stream))
       cout << "Failed to load a sound buffer: " << filename << endl;
   }
-
-  return sbuffer;
 }
 
 gd::String ResourcesLoader::LoadPlainText(const gd::String& filename) {
   gd::String text;
 
   if (resFile.ContainsFile(filename)) {
-    char* buffer = resFile.GetFile(filename);
+    const char* buffer = resFile.GetFile(filename);
     if (!buffer) {
       cout << "Failed to read a file from resource file: " << filename << endl;
     } else {
-      text = gd::String::FromUTF8(std::string(buffer));
+      text = gd::String::FromUTF8(
+          std::string(buffer, resFile.GetFileSize(filename)));
     }
   } else {
-    char* buffer = LoadBinaryFile(filename);
+    const char* buffer = LoadBinaryFile(filename);
     if (!buffer)
       cout << "Failed to read plain text from a file: " << filename << endl;
     else {
@@ -165,9 +164,9 @@ gd::String ResourcesLoader::LoadPlainText(const gd::String& filename) {
 /**
  * Load a binary text file
  */
-char* ResourcesLoader::LoadBinaryFile(const gd::String& filename) {
+const char* ResourcesLoader::LoadBinaryFile(const gd::String& filename) {
   if (resFile.ContainsFile(filename)) {
-    char* buffer = resFile.GetFile(filename);
+    const char* buffer = resFile.GetFile(filename);
     if (buffer == NULL)
       cout << "Failed to read a binary file from resource file: " << filename
            << endl;
@@ -59,10 +59,16 @@ class GD_API ResourcesLoader {
   std::pair<sf::Font *, StreamHolder *> LoadFont(const gd::String &filename);
 
   sf::SoundBuffer LoadSoundBuffer(const gd::String &filename);
+  void LoadSoundBuffer(const gd::String &filename, sf::SoundBuffer &buffer);
 
   gd::String LoadPlainText(const gd::String &filename);
 
-  char *LoadBinaryFile(const gd::String &filename);
+  /**
+   * \brief Return the content of a file. The content of files of the
+   * resource file is not copied, and stays valid as long as the resource file
+   * is opened. Otherwise, the caller owns the returned buffer.
+   */
+  const char *LoadBinaryFile(const gd::String &filename);
 
   long int GetBinaryFileSize(const gd::String &filename);
 
@@ -0,0 +1,192 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCpp/Runtime/ResourcesPreloader.h"
+#include <SFML/Audio/SoundBuffer.hpp>
+#include <algorithm>
+#include <iostream>
+#include "GDCore/Extensions/Builtin/SpriteExtension/Animation.h"
+#include "GDCore/Extensions/Builtin/SpriteExtension/Direction.h"
+#include "GDCore/Extensions/Builtin/SpriteExtension/Sprite.h"
+#include "GDCore/Extensions/Builtin/SpriteExtension/SpriteObject.h"
+#include "GDCpp/Runtime/ImageManager.h"
+#include "GDCpp/Runtime/Project/Layout.h"
+#include "GDCpp/Runtime/Project/Project.h"
+#include "GDCpp/Runtime/Project/ResourcesManager.h"
+#include "GDCpp/Runtime/ResourcesLoader.h"
+#include "GDCpp/Runtime/SoundManager.h"
+#if defined(GD_IDE_ONLY)
+#include "GDCore/IDE/Project/ArbitraryResourceWorker.h"
+#include "GDCore/IDE/Project/ResourcesInUseHelper.h"
+#endif
+
+ResourcesPreloader::ResourcesPreloader(
+    const gd::ResourcesManager& resourcesManager_,
+    gd::ImageManager& imageManager_,
+    SoundManager& soundManager_)
+    : resourcesManager(resourcesManager_),
+      imageManager(imageManager_),
+      soundManager(soundManager_),
+      loadedCount(0),
+      nextResource(0),
+      stopWorkers(false) {}
+
+ResourcesPreloader::~ResourcesPreloader() { StopWorkers(); }
+
+void ResourcesPreloader::Start(const std::set<gd::String>& images,
+                               const std::set<gd::String>& sounds,
+                               std::size_t threadsCount) {
+  if (!workers.empty() || !resources.empty()) {
+    std::cout << "ResourcesPreloader: resources are already being loaded."
+              << std::endl;
+    return;
+  }
+
+  for (const gd::String& name : images) {
+    if (imageManager.HasLoadedSFMLTexture(name)) {
+      alreadyLoadedTextures.push_back(imageManager.GetSFMLTexture(name));
+      continue;
+    }
+    if (!resourcesManager.HasResource(name)) continue;
+    const gd::ImageResource* image = dynamic_cast<const gd::ImageResource*>(
+        &resourcesManager.GetResource(name));
+    if (!image) continue;
+
+    Resource resource;
+    resource.name = name;
+    resource.file = image->GetFile();
+    resource.smooth = image->IsSmooth();
+    resource.texture = std::make_shared<SFMLTextureWrapper>();
+    resources.push_back(resource);
+  }
+
+  for (const gd::String& name : sounds) {
+    if (soundManager.HasLoadedSoundBuffer(name)) {
+      alreadyLoadedSoundBuffers.push_back(soundManager.GetSoundBuffer(name));
+      continue;
+    }
+
+    Resource resource;
+    resource.name = name;
+    resource.file = resourcesManager.HasResource(name)
+                        ? resourcesManager.GetResource(name).GetFile()
+                        : name;
+    resource.smooth = false;
+    // Sound buffers are created on the main thread, so that the audio device
+    // is initialized before the workers start.
+    resource.soundBuffer = std::make_shared<sf::SoundBuffer>();
+    resources.push_back(resource);
+  }
+
+  if (threadsCount == 0) threadsCount = 1;
+  if (threadsCount > resources.size()) threadsCount = resources.size();
+  for (std::size_t i = 0; i < threadsCount; ++i)
+    workers.push_back(std::thread(&ResourcesPreloader::DecodeResources, this));
+}
+
+void ResourcesPreloader::DecodeResources() {
+  while (!stopWorkers) {
+    std::size_t index = nextResource++;
+    if (index >= resources.size()) return;
+
+    Resource& resource = resources[index];
+    if (resource.texture)
+      gd::ResourcesLoader::Get()->LoadSFMLImage(resource.file,
+                                                resource.texture->image);
+    else
+      gd::ResourcesLoader::Get()->LoadSoundBuffer(resource.file,
+                                                  *resource.soundBuffer);
+
+    {
+      std::lock_guard<std::mutex> lock(decodedMutex);
+      decoded.push_back(index);
+    }
+    decodedCondition.notify_one();
+  }
+}
+
+void ResourcesPreloader::UploadResource(Resource& resource) {
+  if (resource.texture) {
+    resource.texture->texture.loadFromImage(resource.texture->image);
+    resource.texture->texture.setSmooth(resource.smooth);
+    imageManager.SetSFMLTextureAsLoaded(resource.name, resource.texture);
+  } else {
+    soundManager.SetSoundBufferAsLoaded(resource.name, resource.soundBuffer);
+  }
+
+  loadedCount++;
+}
+
+bool ResourcesPreloader::Update(std::size_t maxUploads) {
+  std::vector<std::size_t> toUpload;
+  {
+    std::lock_guard<std::mutex> lock(decodedMutex);
+    std::size_t count = std::min(maxUploads, decoded.size());
+    toUpload.assign(decoded.begin(), decoded.begin() + count);
+    decoded.erase(decoded.begin(), decoded.begin() + count);
+  }
+
+  for (std::size_t index : toUpload) UploadResource(resources[index]);
+
+  if (IsFinished()) StopWorkers();
+  return IsFinished();
+}
+
+void ResourcesPreloader::Finish() {
+  while (!IsFinished()) {
+    {
+      std::unique_lock<std::mutex> lock(decodedMutex);
+      decodedCondition.wait(lock, [this]() { return !decoded.empty(); });
+    }
+    Update();
+  }
+  StopWorkers();
+}
+
+void ResourcesPreloader::StopWorkers() {
+  stopWorkers = true;
+  for (std::thread& worker : workers) worker.join();
+  workers.clear();
+}
+
+void ResourcesPreloader::GetLayoutResources(gd::Project& project,
+                                            gd::Layout& layout,
+                                            std::set<gd::String>& images,
+                                            std::set<gd::String>& sounds) {
+#if defined(GD_IDE_ONLY)
+  gd::ResourcesInUseHelper resourcesInUse;
+  for (std::size_t i = 0; i < project.GetObjectsCount(); ++i)
+    project.GetObject(i).ExposeResources(resourcesInUse);
+  for (std::size_t i = 0; i < layout.GetObjectsCount(); ++i)
+    layout.GetObject(i).ExposeResources(resourcesInUse);
+  gd::LaunchResourceWorkerOnEvents(project, layout.GetEvents(), resourcesInUse);
+
+  images.insert(resourcesInUse.GetAllImages().begin(),
+                resourcesInUse.GetAllImages().end());
+  sounds.insert(resourcesInUse.GetAllAudios().begin(),
+                resourcesInUse.GetAllAudios().end());
+#else
+  // Resources can't be exposed by objects and events at runtime: only the
+  // images of sprites, which are usually most of the resources, are listed.
+  auto addSpriteImages = [&images](gd::Object& object) {
+    gd::SpriteObject* spriteObject = dynamic_cast<gd::SpriteObject*>(&object);
+    if (!spriteObject) return;
+
+    for (std::size_t i = 0; i < spriteObject->GetAnimationsCount(); ++i) {
+      const gd::Animation& animation = spriteObject->GetAnimation(i);
+      for (std::size_t j = 0; j < animation.GetDirectionsCount(); ++j) {
+        const gd::Direction& direction = animation.GetDirection(j);
+        for (std::size_t k = 0; k < direction.GetSpritesCount(); ++k)
+          images.insert(direction.GetSprite(k).GetImageName());
+      }
+    }
+  };
+
+  for (std::size_t i = 0; i < project.GetObjectsCount(); ++i)
+    addSpriteImages(project.GetObject(i));
+  for (std::size_t i = 0; i < layout.GetObjectsCount(); ++i)
+    addSpriteImages(layout.GetObject(i));
+#endif
+}
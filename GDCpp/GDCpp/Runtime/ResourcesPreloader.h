@@ -0,0 +1,164 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef RESOURCESPRELOADER_H
+#define RESOURCESPRELOADER_H
+#include <atomic>
+#include <condition_variable>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+#include "GDCpp/Runtime/String.h"
+class SFMLTextureWrapper;
+class SoundManager;
+namespace gd {
+class ImageManager;
+class Layout;
+class Project;
+class ResourcesManager;
+}
+namespace sf {
+class SoundBuffer;
+}
+
+/**
+ * \brief Load images and sounds in the background, so that they are ready
+ * when a scene using them is loaded.
+ *
+ * The files are read and decoded by worker threads. Only the upload of the
+ * images to the graphics card is done by the main thread (which owns the
+ * OpenGL context), when ResourcesPreloader::Update is called.
+ *
+ * Loaded textures and sound buffers are given to the gd::ImageManager and to
+ * the SoundManager (so that they are used by objects and sounds), and stay
+ * loaded as long as the ResourcesPreloader is alive.
+ *
+ * Usage example:
+\code
+std::set<gd::String> images, sounds;
+ResourcesPreloader::GetLayoutResources(game, game.GetLayout("Level2"),
+                                       images, sounds);
+ResourcesPreloader preloader(game.GetResourcesManager(),
+                             *game.GetImageManager(), game.GetSoundManager());
+preloader.Start(images, sounds);
+
+// Then, at each frame:
+preloader.Update(4);
+\endcode
+ *
+ * \see SceneStack::Preload
+ * \ingroup ResourcesManagement
+ */
+class GD_API ResourcesPreloader {
+ public:
+  ResourcesPreloader(const gd::ResourcesManager& resourcesManager,
+                     gd::ImageManager& imageManager,
+                     SoundManager& soundManager);
+
+  /**
+   * \brief Stop the worker threads. Resources not loaded yet are discarded.
+   */
+  ~ResourcesPreloader();
+
+  /**
+   * \brief Start loading the images and the sounds in background threads.
+   *
+   * Resources already loaded are not loaded again, but are still kept in
+   * memory as long as the preloader is alive. This must be called only once.
+   *
+   * \param images The names of the image resources to load.
+   * \param sounds The names of the audio resources (or the files) to load.
+   * \param threadsCount The number of threads decoding the files.
+   */
+  void Start(const std::set<gd::String>& images,
+             const std::set<gd::String>& sounds,
+             std::size_t threadsCount = 2);
+
+  /**
+   * \brief Upload the images decoded by the worker threads to the graphics
+   * card, and make the loaded resources available to the managers.
+   *
+   * Must be called on the main thread, typically once per frame.
+   *
+   * \param maxUploads The maximum number of textures to upload, to avoid
+   * freezing the game for too long.
+   * \return true if all resources are loaded.
+   */
+  bool Update(std::size_t maxUploads = std::numeric_limits<std::size_t>::max());
+
+  /**
+   * \brief Wait for the worker threads and finish loading all the resources.
+   *
+   * Must be called on the main thread.
+   */
+  void Finish();
+
+  /**
+   * \brief Return true if all resources are loaded.
+   */
+  bool IsFinished() const { return loadedCount == resources.size(); }
+
+  /**
+   * \brief Return the number of resources to load.
+   */
+  std::size_t GetResourcesCount() const { return resources.size(); }
+
+  /**
+   * \brief Return the number of resources already loaded.
+   */
+  std::size_t GetLoadedResourcesCount() const { return loadedCount; }
+
+  /**
+   * \brief Add to \a images and \a sounds the resources used by the objects
+   * of \a layout (and the global objects) and by its events.
+   *
+   * \note The events are only available in the IDE. At runtime, only the
+   * images of sprite objects are listed.
+   */
+  static void GetLayoutResources(gd::Project& project,
+                                 gd::Layout& layout,
+                                 std::set<gd::String>& images,
+                                 std::set<gd::String>& sounds);
+
+ private:
+  /**
+   * \brief A resource loaded by the worker threads.
+   */
+  struct Resource {
+    gd::String name;
+    gd::String file;
+    bool smooth;
+    std::shared_ptr<SFMLTextureWrapper> texture;  ///< Null for sounds.
+    std::shared_ptr<sf::SoundBuffer> soundBuffer;  ///< Null for images.
+  };
+
+  void DecodeResources();
+  void UploadResource(Resource& resource);
+  void StopWorkers();
+
+  const gd::ResourcesManager& resourcesManager;
+  gd::ImageManager& imageManager;
+  SoundManager& soundManager;
+
+  std::vector<Resource> resources;  ///< Resources to be loaded, never modified
+                                    ///< while the workers are running.
+  std::size_t loadedCount;          ///< Number of resources uploaded.
+  std::vector<std::shared_ptr<SFMLTextureWrapper> >
+      alreadyLoadedTextures;  ///< Kept alive like the resources loaded.
+  std::vector<std::shared_ptr<sf::SoundBuffer> > alreadyLoadedSoundBuffers;
+
+  std::vector<std::thread> workers;
+  std::atomic<std::size_t> nextResource;  ///< Next resource to be decoded.
+  std::atomic<bool> stopWorkers;
+  std::mutex decodedMutex;
+  std::condition_variable decodedCondition;
+  std::vector<std::size_t> decoded;  ///< Decoded resources not yet uploaded.
+                                     ///< Protected by decodedMutex.
+};
+
+#endif  // RESOURCESPRELOADER_H
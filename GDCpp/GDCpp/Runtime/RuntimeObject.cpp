@@ -19,6 +19,7 @@
 #include "GDCpp/Runtime/Project/Object.h"
 #include "GDCpp/Runtime/RuntimeBehavior.h"
 #include "GDCpp/Runtime/RuntimeScene.h"
+#include "GDCpp/Runtime/SpriteBatch.h"
 
 using namespace std;
 
@@ -46,6 +47,12 @@ RuntimeObject::RuntimeObject(RuntimeScene &scene, const gd::Object &object)
 
 RuntimeObject::~RuntimeObject() {}
 
+bool RuntimeObject::DrawInBatch(sf::RenderTarget &renderTarget,
+                                SpriteBatch &spriteBatch) {
+  spriteBatch.Flush(renderTarget);
+  return Draw(renderTarget);
+}
+
 void RuntimeObject::Init(const RuntimeObject &object) {
   name = object.name;
   type = object.type;
@@ -58,6 +65,8 @@ void RuntimeObject::Init(const RuntimeObject &object) {
   layer = object.layer;
   force5 = object.force5;
   forces = object.forces;
+  hitBoxesCache = object.hitBoxesCache;
+  hitBoxesSoACache = object.hitBoxesSoACache;
 
   // Clone behaviors
   behaviors.clear();
@@ -319,14 +328,16 @@ bool RuntimeObject::SeparateFromObjects(
     const std::vector<RuntimeObject *> &objects, bool ignoreTouchingEdges) {
   bool moved = false;
   sf::Vector2f moveVector;
+  static thread_local vector<CollisionResult> results;
   for (std::size_t j = 0; j < objects.size(); ++j) {
     if (objects[j] != this) {
-      std::vector<Polygon2d> hitBoxes = GetHitBoxes(objects[j]->GetAABB());
-      vector<Polygon2d> otherHitBoxes = objects[j]->GetHitBoxes(GetAABB());
+      const std::vector<Polygon2dSoA> &hitBoxes = GetCachedHitBoxesSoA();
+      const vector<Polygon2dSoA> &otherHitBoxes =
+          objects[j]->GetCachedHitBoxesSoA();
       for (std::size_t k = 0; k < hitBoxes.size(); ++k) {
-        for (std::size_t l = 0; l < otherHitBoxes.size(); ++l) {
-          CollisionResult result = PolygonCollisionTest(
-              hitBoxes[k], otherHitBoxes[l], ignoreTouchingEdges);
+        PolygonCollisionTestBatch(
+            hitBoxes[k], otherHitBoxes, ignoreTouchingEdges, results);
+        for (const CollisionResult &result : results) {
           if (result.collision) {
             moveVector += result.move_axis;
             moved = true;
@@ -403,21 +414,16 @@ bool RuntimeObject::IsCollidingWith(RuntimeObject *obj2,
   if (sqrt(x * x + y * y) > obj1BoundingRadius + obj2BoundingRadius)
     return false;
 
-  // Do a real check if necessary.
-
-  // Get the bounding rect of the two objects to use them
-  // as a hint to get the other's hitboxes
-  sf::FloatRect objRect = obj1->GetAABB();
-  sf::FloatRect obj2Rect = obj2->GetAABB();
-
-  vector<Polygon2d> objHitboxes = obj1->GetHitBoxes(obj2Rect);
-  vector<Polygon2d> obj2Hitboxes = obj2->GetHitBoxes(objRect);
+  // Do a real check if necessary, testing each hitbox of the object with all
+  // the hitboxes of the other one at once.
+  const vector<Polygon2dSoA> &objHitboxes = obj1->GetCachedHitBoxesSoA();
+  const vector<Polygon2dSoA> &obj2Hitboxes = obj2->GetCachedHitBoxesSoA();
+  static thread_local vector<CollisionResult> results;
   for (std::size_t k = 0; k < objHitboxes.size(); ++k) {
-    for (std::size_t l = 0; l < obj2Hitboxes.size(); ++l) {
-      if (PolygonCollisionTest(
-              objHitboxes[k], obj2Hitboxes[l], ignoreTouchingEdges)
-              .collision)
-        return true;
+    PolygonCollisionTestBatch(
+        objHitboxes[k], obj2Hitboxes, ignoreTouchingEdges, results);
+    for (const CollisionResult &result : results) {
+      if (result.collision) return true;
     }
   }
 
@@ -425,7 +431,7 @@ bool RuntimeObject::IsCollidingWith(RuntimeObject *obj2,
 }
 
 bool RuntimeObject::IsCollidingWithPoint(float pointX, float pointY) {
-  vector<Polygon2d> hitBoxes = GetHitBoxes();
+  const vector<Polygon2d> &hitBoxes = GetCachedHitBoxes();
   for (std::size_t i = 0; i < hitBoxes.size(); ++i) {
     if (IsPointInsidePolygon(hitBoxes[i], pointX, pointY)) return true;
   }
@@ -451,9 +457,10 @@ RaycastResult RuntimeObject::RaycastTest(
 
   float testSqDist = closest ? sqDist : 0.0f;
 
-  vector<Polygon2d> hitboxes = GetHitBoxes();
+  const vector<Polygon2d> &hitboxes = GetCachedHitBoxes();
   for (std::size_t i = 0; i < hitboxes.size(); ++i) {
-    RaycastResult res = PolygonRaycastTest(hitboxes[i], x, y, endX, endY);
+    RaycastResult res =
+        PolygonRaycastTestWithEdges(hitboxes[i], x, y, endX, endY);
 
     if (res.collision) {
       if (closest && (res.closeSqDist < testSqDist)) {
@@ -640,6 +647,23 @@ std::vector<Polygon2d> RuntimeObject::GetHitBoxes(sf::FloatRect hint) const {
   return GetHitBoxes();
 }
 
+const std::vector<Polygon2d> &RuntimeObject::GetCachedHitBoxes() const {
+  hitBoxesCache = GetHitBoxes();
+  for (std::size_t i = 0; i < hitBoxesCache.size(); ++i)
+    hitBoxesCache[i].ComputeEdges();
+
+  return hitBoxesCache;
+}
+
+const std::vector<Polygon2dSoA> &RuntimeObject::GetCachedHitBoxesSoA() const {
+  const std::vector<Polygon2d> &hitBoxes = GetCachedHitBoxes();
+  hitBoxesSoACache.resize(hitBoxes.size());
+  for (std::size_t i = 0; i < hitBoxes.size(); ++i)
+    hitBoxesSoACache[i].Set(hitBoxes[i]);
+
+  return hitBoxesSoACache;
+}
+
 bool RuntimeObject::CursorOnObject(RuntimeScene &scene, bool) {
   RuntimeLayer &theLayer = scene.GetRuntimeLayer(layer);
   auto insideObject = [this](const sf::Vector2f &pos) {
@@ -13,6 +13,8 @@
 #include <vector>
 #include "GDCore/Tools/MakeUnique.h"
 #include "GDCpp/Runtime/Force.h"
+#include "GDCpp/Runtime/Polygon2d.h"
+#include "GDCpp/Runtime/PolygonCollision.h"
 #include "GDCpp/Runtime/RuntimeBehavior.h"
 #include "GDCpp/Runtime/RuntimeVariablesContainer.h"
 #include "GDCpp/Runtime/String.h"
@@ -23,8 +25,8 @@ class Object;
 namespace sf {
 class RenderTarget;
 }
-class Polygon2d;
 class RaycastResult;
+class SpriteBatch;
 class RuntimeScene;
 
 /**
@@ -136,6 +138,25 @@ class GD_API RuntimeObject {
    */
   virtual bool Draw(sf::RenderTarget& renderTarget) { return true; };
 
+  /**
+   * \brief Draw the object, using \a spriteBatch if possible.
+   *
+   * The default implementation draws the sprites of the batch, then calls
+   * Draw. Objects drawn with a single sf::Sprite can redefine it to add their
+   * sprite to the batch instead.
+   */
+  virtual bool DrawInBatch(sf::RenderTarget& renderTarget,
+                           SpriteBatch& spriteBatch);
+
+  /**
+   * \brief Return true if everything drawn by the object is inside its AABB,
+   * so that the object is not drawn when its AABB is outside of the camera.
+   *
+   * \note Return false by default, as some objects (like particles emitters)
+   * draw outside of their AABB.
+   */
+  virtual bool IsDrawnInsideAABB() const { return false; };
+
   /** \name Object's variables
    * Members functions providing access to the object's variables.
    */
@@ -248,7 +269,7 @@ class GD_API RuntimeObject {
   /**
    * \brief Get the object AABB
    */
-  sf::FloatRect GetAABB() const;
+  virtual sf::FloatRect GetAABB() const;
 
   /**
    * \brief Get the object hitbox(es)
@@ -264,6 +285,32 @@ class GD_API RuntimeObject {
    */
   virtual std::vector<Polygon2d> GetHitBoxes(sf::FloatRect hint) const;
 
+  /**
+   * \brief Get the object hitbox(es), with their edges computed (see
+   * Polygon2d::ComputeEdges), without copying them.
+   *
+   * Used by collision tests and raycasts. The returned reference is valid until
+   * the next call or until the object is changed.
+   *
+   * \note The default implementation stores the result of GetHitBoxes(), so
+   * hitboxes are computed at each call. Objects knowing when their hitboxes are
+   * changed should redefine it to return hitboxes computed once.
+   */
+  virtual const std::vector<Polygon2d>& GetCachedHitBoxes() const;
+
+  /**
+   * \brief Get the object hitbox(es) stored as Polygon2dSoA, to be tested with
+   * PolygonCollisionTestBatch, without copying them.
+   *
+   * Used by collision tests. The returned reference is valid until the next
+   * call or until the object is changed.
+   *
+   * \note The default implementation converts the result of
+   * GetCachedHitBoxes() at each call. Objects knowing when their hitboxes are
+   * changed should redefine it to convert them once.
+   */
+  virtual const std::vector<Polygon2dSoA>& GetCachedHitBoxesSoA() const;
+
   /**
    * \brief Check collision between two objects using their hitboxes.
    *
@@ -619,6 +666,10 @@ class GD_API RuntimeObject {
   RuntimeVariablesContainer
       objectVariables;        ///< List of the variables of the object
   std::vector<Force> forces;  ///< Forces applied to the object
+  mutable std::vector<Polygon2d>
+      hitBoxesCache;  ///< Hitboxes returned by GetCachedHitBoxes.
+  mutable std::vector<Polygon2dSoA>
+      hitBoxesSoACache;  ///< Hitboxes returned by GetCachedHitBoxesSoA.
 
   /**
    * \brief Initialize object using another object. Used by copy-ctor and
@@ -0,0 +1,164 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCpp/Runtime/RuntimeObjectsBroadPhase.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace {
+const std::int64_t maxCellsPerArea = 16;
+
+bool IsFinite(const sf::FloatRect &area) {
+  return std::isfinite(area.left) && std::isfinite(area.top) &&
+         std::isfinite(area.width) && std::isfinite(area.height);
+}
+
+sf::FloatRect Normalize(const sf::FloatRect &area) {
+  sf::FloatRect normalizedArea(area);
+  if (normalizedArea.width < 0) {
+    normalizedArea.left += normalizedArea.width;
+    normalizedArea.width = -normalizedArea.width;
+  }
+  if (normalizedArea.height < 0) {
+    normalizedArea.top += normalizedArea.height;
+    normalizedArea.height = -normalizedArea.height;
+  }
+
+  return normalizedArea;
+}
+
+bool Overlaps(const sf::FloatRect &a, const sf::FloatRect &b) {
+  return a.left <= b.left + b.width && b.left <= a.left + a.width &&
+         a.top <= b.top + b.height && b.top <= a.top + a.height;
+}
+
+bool GetCellCoordinate(float position, float cellSize, std::int32_t &cell) {
+  double coordinate = std::floor(static_cast<double>(position) / cellSize);
+  if (coordinate < std::numeric_limits<std::int32_t>::min() ||
+      coordinate > std::numeric_limits<std::int32_t>::max())
+    return false;
+
+  cell = static_cast<std::int32_t>(coordinate);
+  return true;
+}
+}  // namespace
+
+RuntimeObjectsBroadPhase::RuntimeObjectsBroadPhase()
+    : queriesCount(0), cellSize(1) {}
+
+void RuntimeObjectsBroadPhase::Clear() {
+  areas.clear();
+  cells.clear();
+  largeAreas.clear();
+  lastQueries.clear();
+}
+
+void RuntimeObjectsBroadPhase::Insert(const sf::FloatRect &area) {
+  areas.push_back(Normalize(area));
+}
+
+void RuntimeObjectsBroadPhase::Build() {
+  cells.clear();
+  largeAreas.clear();
+  lastQueries.assign(areas.size(), 0);
+  queriesCount = 0;
+
+  double totalSize = 0;
+  std::size_t finiteAreasCount = 0;
+  for (std::size_t i = 0; i < areas.size(); ++i) {
+    if (!IsFinite(areas[i])) continue;
+
+    totalSize += std::max(areas[i].width, areas[i].height);
+    finiteAreasCount++;
+  }
+  cellSize = finiteAreasCount != 0
+                 ? static_cast<float>(totalSize / finiteAreasCount)
+                 : 1.0f;
+  cellSize = std::max(1.0f, cellSize);
+
+  for (std::size_t i = 0; i < areas.size(); ++i) {
+    std::int32_t minX, minY, maxX, maxY;
+    if (!GetCellsRange(areas[i], minX, minY, maxX, maxY) ||
+        (static_cast<std::int64_t>(maxX) - minX + 1) *
+                (static_cast<std::int64_t>(maxY) - minY + 1) >
+            maxCellsPerArea) {
+      largeAreas.push_back(i);
+      continue;
+    }
+
+    for (std::int32_t y = minY; y <= maxY; ++y) {
+      for (std::int32_t x = minX; x <= maxX; ++x)
+        cells.push_back(std::make_pair(GetCellKey(x, y), i));
+    }
+  }
+
+  std::sort(cells.begin(), cells.end());
+}
+
+void RuntimeObjectsBroadPhase::Query(const sf::FloatRect &queriedArea,
+                                     std::vector<std::size_t> &result) {
+  sf::FloatRect area = Normalize(queriedArea);
+  result.clear();
+  queriesCount++;
+
+  std::int32_t minX, minY, maxX, maxY;
+  if (!GetCellsRange(area, minX, minY, maxX, maxY)) {
+    for (std::size_t i = 0; i < areas.size(); ++i) result.push_back(i);
+    return;
+  }
+
+  // If the area covers more cells than there are entries in the grid, it's
+  // faster to check all the areas.
+  if ((static_cast<std::int64_t>(maxX) - minX + 1) *
+          (static_cast<std::int64_t>(maxY) - minY + 1) >
+      static_cast<std::int64_t>(cells.size())) {
+    for (std::size_t i = 0; i < areas.size(); ++i) {
+      if (!IsFinite(areas[i]) || Overlaps(area, areas[i])) result.push_back(i);
+    }
+    return;
+  }
+
+  for (std::int32_t y = minY; y <= maxY; ++y) {
+    for (std::int32_t x = minX; x <= maxX; ++x) {
+      std::uint64_t key = GetCellKey(x, y);
+      auto it = std::lower_bound(cells.begin(),
+                                 cells.end(),
+                                 std::make_pair(key, std::size_t(0)));
+      for (; it != cells.end() && it->first == key; ++it) {
+        std::size_t i = it->second;
+        if (lastQueries[i] == queriesCount) continue;
+
+        lastQueries[i] = queriesCount;
+        if (Overlaps(area, areas[i])) result.push_back(i);
+      }
+    }
+  }
+
+  for (std::size_t i : largeAreas) {
+    if (!IsFinite(areas[i]) || Overlaps(area, areas[i])) result.push_back(i);
+  }
+
+  std::sort(result.begin(), result.end());
+}
+
+bool RuntimeObjectsBroadPhase::GetCellsRange(const sf::FloatRect &area,
+                                             std::int32_t &minX,
+                                             std::int32_t &minY,
+                                             std::int32_t &maxX,
+                                             std::int32_t &maxY) const {
+  if (!IsFinite(area)) return false;
+
+  return GetCellCoordinate(area.left, cellSize, minX) &&
+         GetCellCoordinate(area.top, cellSize, minY) &&
+         GetCellCoordinate(area.left + area.width, cellSize, maxX) &&
+         GetCellCoordinate(area.top + area.height, cellSize, maxY);
+}
+
+std::uint64_t RuntimeObjectsBroadPhase::GetCellKey(std::int32_t x,
+                                                   std::int32_t y) {
+  return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(x)) << 32) |
+         static_cast<std::uint32_t>(y);
+}
@@ -0,0 +1,79 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef RUNTIMEOBJECTSBROADPHASE_H
+#define RUNTIMEOBJECTSBROADPHASE_H
+#include <cstdint>
+#include <vector>
+#include <SFML/Graphics/Rect.hpp>
+
+/**
+ * \brief A uniform grid storing areas (usually around objects), used to
+ * quickly find the areas overlapping another one.
+ *
+ * Areas are inserted with Insert, then Build must be called before calling
+ * Query. The size of the cells is the average size of the areas, so that each
+ * area is stored in a few cells only. Areas covering a lot of cells, or with
+ * a non finite position, are returned by all queries.
+ *
+ * This is used as a broad phase by TwoObjectListsTestWithBroadPhase, to only
+ * test pairs of objects that are close to each other.
+ *
+ * \see TwoObjectListsTestWithBroadPhase
+ * \ingroup GameEngine
+ */
+class GD_API RuntimeObjectsBroadPhase {
+ public:
+  RuntimeObjectsBroadPhase();
+  virtual ~RuntimeObjectsBroadPhase(){};
+
+  /**
+   * \brief Remove all the areas.
+   */
+  void Clear();
+
+  /**
+   * \brief Add an area, identified by its index (the number of areas that
+   * were inserted before it).
+   */
+  void Insert(const sf::FloatRect &area);
+
+  /**
+   * \brief Store the inserted areas in the grid. Must be called after the
+   * areas are inserted and before the grid is queried.
+   */
+  void Build();
+
+  /**
+   * \brief Fill \a result with the indices of the areas overlapping (or
+   * touching) \a area, in increasing order.
+   */
+  void Query(const sf::FloatRect &area, std::vector<std::size_t> &result);
+
+  /**
+   * \brief Return the number of inserted areas.
+   */
+  std::size_t GetAreasCount() const { return areas.size(); }
+
+ private:
+  bool GetCellsRange(const sf::FloatRect &area,
+                     std::int32_t &minX,
+                     std::int32_t &minY,
+                     std::int32_t &maxX,
+                     std::int32_t &maxY) const;
+  static std::uint64_t GetCellKey(std::int32_t x, std::int32_t y);
+
+  std::vector<sf::FloatRect> areas;
+  std::vector<std::pair<std::uint64_t, std::size_t> >
+      cells;  ///< Areas indices, sorted by the key of the cells they overlap.
+  std::vector<std::size_t>
+      largeAreas;  ///< Areas not stored in cells, returned by all queries.
+  std::vector<std::size_t>
+      lastQueries;  ///< For each area, the last query that returned it.
+  std::size_t queriesCount;
+  float cellSize;
+};
+
+#endif  // RUNTIMEOBJECTSBROADPHASE_H
@@ -20,3 +20,32 @@ void GD_API PickOnly(RuntimeObjectsLists& pickedObjectsLists,
   if (pickedObjectsLists[thisOne->GetName()] != NULL)
     pickedObjectsLists[thisOne->GetName()]->push_back(thisOne);
 }
+
+void GD_API TrimNotPickedObjects(
+    const RuntimeObjectsLists& objectsLists,
+    const std::vector<std::vector<bool> >& pickedLists) {
+  std::size_t i = 0;
+  for (RuntimeObjectsLists::const_iterator it = objectsLists.begin();
+       it != objectsLists.end();
+       ++it, ++i) {
+    size_t finalSize = 0;
+    if (!it->second) continue;
+    std::vector<RuntimeObject*>& arr = *it->second;
+
+    //*This is important*! We can have a list that has already been trimmed
+    // just before
+    if (arr.size() !=
+        pickedLists[i].size())  // If the size of the objects list != size of
+                                // the boolean "picked" list...
+      continue;  //... then the object list was already trimmed, skip it.
+
+    for (std::size_t k = 0; k < arr.size(); ++k) {
+      RuntimeObject* obj = arr[k];
+      if (pickedLists[i][k]) {
+        arr[finalSize] = obj;
+        finalSize++;
+      }
+    }
+    arr.resize(finalSize);
+  }
+}
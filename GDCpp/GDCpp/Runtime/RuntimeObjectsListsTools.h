@@ -10,6 +10,7 @@
 #include <string>
 #include <vector>
 #include "RuntimeObject.h"
+#include "RuntimeObjectsBroadPhase.h"
 #include "RuntimeScene.h"
 
 typedef std::map<gd::String, std::vector<RuntimeObject *> *>
@@ -24,6 +25,20 @@ typedef std::map<gd::String, std::vector<RuntimeObject *> *>
 void GD_API PickOnly(RuntimeObjectsLists &pickedObjectsLists,
                      RuntimeObject *thisOne);
 
+/**
+ * \brief Remove from the lists the objects that are not marked as picked.
+ *
+ * \param objectsLists The lists of objects to trim
+ * \param pickedLists For each list, a boolean for each object telling if it's
+ * picked. Lists that have not the same size as their booleans are considered as
+ * already trimmed (they can be in objectsLists more than once) and are skipped.
+ *
+ * \ingroup GameEngine
+ */
+void GD_API TrimNotPickedObjects(
+    const RuntimeObjectsLists &objectsLists,
+    const std::vector<std::vector<bool> > &pickedLists);
+
 /**
  * \brief Filter objects to keep only the one that fullfil the predicate
  *
@@ -192,51 +207,123 @@ bool TwoObjectListsTest(RuntimeObjectsLists objectsLists1,
   }
 
   // Trim not picked objects from lists.
-  i = 0;
+  TrimNotPickedObjects(objectsLists1, pickedList1);
+  if (!negatePredicate) TrimNotPickedObjects(objectsLists2, pickedList2);
+
+  return isTrue;
+}
+
+/**
+ * \brief Same as TwoObjectListsTest, but the predicate is only called for
+ * pairs of objects whose areas (returned by \a getArea) are overlapping or
+ * touching: the predicate must be false for the other pairs.
+ *
+ * The areas of the objects of objectsLists2 are stored in a
+ * RuntimeObjectsBroadPhase, so that the predicate is called only for the
+ * objects close to each other instead of NbObjList1*NbObjList2 times. Pairs are
+ * still considered in the same order as TwoObjectListsTest.
+ *
+ * \param getArea The function returning the area (a sf::FloatRect) of an
+ * object.
+ *
+ * \see TwoObjectListsTest
+ * \ingroup GameEngine
+ */
+template <typename GetArea, typename Pred>
+bool TwoObjectListsTestWithBroadPhase(RuntimeObjectsLists objectsLists1,
+                                      RuntimeObjectsLists objectsLists2,
+                                      bool negatePredicate,
+                                      GetArea getArea,
+                                      Pred predicate) {
+  bool isTrue = false;
+
+  // Create a boolean for each object
+  std::vector<std::vector<bool> > pickedList1;
+  std::vector<std::vector<bool> > pickedList2;
+
   for (RuntimeObjectsLists::const_iterator it = objectsLists1.begin();
        it != objectsLists1.end();
-       ++it, ++i) {
-    size_t finalSize = 0;
-    if (!it->second) continue;
-    std::vector<RuntimeObject *> &arr = *it->second;
+       ++it) {
+    std::vector<bool> arr;
+    arr.assign(it->second->size(), false);
+    pickedList1.push_back(arr);
+  }
+  for (RuntimeObjectsLists::const_iterator it = objectsLists2.begin();
+       it != objectsLists2.end();
+       ++it) {
+    std::vector<bool> arr;
+    arr.assign(it->second->size(), false);
+    pickedList2.push_back(arr);
+  }
 
-    for (std::size_t k = 0; k < arr.size(); ++k) {
-      RuntimeObject *obj = arr[k];
-      if (pickedList1[i][k]) {
-        arr[finalSize] = obj;
-        finalSize++;
-      }
+  // Store the areas of the objects of the second list, remembering
+  // the list and the position of each object.
+  RuntimeObjectsBroadPhase broadPhase;
+  std::vector<const std::vector<RuntimeObject *> *> arrays2;
+  std::vector<std::pair<std::size_t, std::size_t> > objects2;
+  std::size_t j = 0;
+  for (RuntimeObjectsLists::const_iterator it2 = objectsLists2.begin();
+       it2 != objectsLists2.end();
+       ++it2, ++j) {
+    arrays2.push_back(it2->second);
+    if (!it2->second) continue;
+    const std::vector<RuntimeObject *> &arr2 = *it2->second;
+
+    for (std::size_t l = 0; l < arr2.size(); ++l) {
+      broadPhase.Insert(getArea(arr2[l]));
+      objects2.push_back(std::make_pair(j, l));
     }
-    arr.resize(finalSize);
   }
+  broadPhase.Build();
 
-  if (!negatePredicate) {
-    std::size_t i = 0;
-    for (RuntimeObjectsLists::const_iterator it = objectsLists2.begin();
-         it != objectsLists2.end();
-         ++it, ++i) {
-      size_t finalSize = 0;
-      if (!it->second) continue;
-      std::vector<RuntimeObject *> &arr = *it->second;
-
-      //*This is important*! We can have a list that has already been trimmed
-      // just before
-      if (arr.size() !=
-          pickedList2[i].size())  // If the size of the objects list != size of
-                                  // the boolean "picked" list...
-        continue;  //... then the object list was already trimmed, skip it.
-
-      for (std::size_t k = 0; k < arr.size(); ++k) {
-        RuntimeObject *obj = arr[k];
-        if (pickedList2[i][k]) {
-          arr[finalSize] = obj;
-          finalSize++;
+  // Launch the function for each object of the first list with the objects
+  // of the second list that are close to it.
+  std::vector<std::size_t> candidates;
+  std::size_t i = 0;
+  for (RuntimeObjectsLists::const_iterator it = objectsLists1.begin();
+       it != objectsLists1.end();
+       ++it, ++i) {
+    if (!it->second) continue;
+    const std::vector<RuntimeObject *> &arr1 = *it->second;
+
+    for (std::size_t k = 0; k < arr1.size(); ++k) {
+      bool atLeastOneObject = false;
+
+      broadPhase.Query(getArea(arr1[k]), candidates);
+      for (std::size_t candidate : candidates) {
+        std::size_t j = objects2[candidate].first;
+        std::size_t l = objects2[candidate].second;
+        const std::vector<RuntimeObject *> &arr2 = *arrays2[j];
+
+        if (pickedList1[i][k] && pickedList2[j][l])
+          continue;  // Avoid unnecessary costly call to functor.
+
+        if (std::addressof(arr1[k]) != std::addressof(arr2[l]) &&
+            predicate(arr1[k], arr2[l])) {
+          if (!negatePredicate) {
+            isTrue = true;
+
+            // Pick the objects
+            pickedList1[i][k] = true;
+            pickedList2[j][l] = true;
+          }
+
+          atLeastOneObject = true;
         }
       }
-      arr.resize(finalSize);
+
+      if (!atLeastOneObject &&
+          negatePredicate) {  // The object is not overlapping any other object.
+        isTrue = true;
+        pickedList1[i][k] = true;
+      }
     }
   }
 
+  // Trim not picked objects from lists.
+  TrimNotPickedObjects(objectsLists1, pickedList1);
+  if (!negatePredicate) TrimNotPickedObjects(objectsLists2, pickedList2);
+
   return isTrue;
 }
 #endif
@@ -118,6 +118,11 @@ void RuntimeScene::RequestChange(SceneChange::Change change,
 }
 
 bool RuntimeScene::RenderAndStep() {
+#if defined(GD_IDE_ONLY)
+  std::size_t listsAllocationsCount =
+      objectsInstances.GetListsAllocationsCount();
+#endif
+
   requestedChange.change = SceneChange::CONTINUE;
   ManageRenderTargetEvents();
   timeManager.Update(clock.restart().asMicroseconds(), game->GetMinimumFPS());
@@ -157,6 +162,8 @@ bool RuntimeScene::RenderAndStep() {
     GetProfiler()->totalSceneTime +=
         GetProfiler()->lastRenderingTime + GetProfiler()->lastEventsTime;
     GetProfiler()->totalEventsTime += GetProfiler()->lastEventsTime;
+    GetProfiler()->lastObjectsListsAllocations =
+        objectsInstances.GetListsAllocationsCount() - listsAllocationsCount;
     GetProfiler()->Update();
   }
 #endif
@@ -194,6 +201,24 @@ void RuntimeScene::RenderWithoutStep() {
 #endif
 }
 
+namespace {
+/**
+ * \brief Return the area of the scene displayed by a view (the bounding box
+ * of the view if it's rotated).
+ */
+sf::FloatRect GetViewArea(const sf::View& view) {
+  sf::Transform rotation;
+  rotation.rotate(view.getRotation());
+
+  sf::FloatRect area = rotation.transformRect(sf::FloatRect(
+      -view.getSize().x / 2, -view.getSize().y / 2, view.getSize().x,
+      view.getSize().y));
+  area.left += view.getCenter().x;
+  area.top += view.getCenter().y;
+  return area;
+}
+}  // namespace
+
 void RuntimeScene::Render() {
   if (!renderWindow) return;
 
@@ -201,9 +226,8 @@ void RuntimeScene::Render() {
                                 GetBackgroundColorGreen(),
                                 GetBackgroundColorBlue()));
 
-  // Sort object by order to render them
-  RuntimeObjNonOwningPtrList allObjects = objectsInstances.GetAllObjects();
-  OrderObjectsByZOrder(allObjects);
+  // Sort objects of each layer by Z order to render them
+  renderingBuckets.Update(objectsInstances, layers);
 
 #if !defined(ANDROID)  // TODO: OpenGL
   // To allow using OpenGL to draw:
@@ -248,11 +272,17 @@ void RuntimeScene::Render() {
         // Prepare SFML rendering
         renderWindow->setView(camera.GetSFMLView());
 
-        // Rendering all objects
-        for (std::size_t id = 0; id < allObjects.size(); ++id) {
-          if (allObjects[id]->GetLayer() == layers[layerIndex].GetName())
-            allObjects[id]->Draw(*renderWindow);
+        // Rendering all objects of the layer visible by the camera
+        sf::FloatRect viewArea = GetViewArea(camera.GetSFMLView());
+        for (RuntimeObject* object :
+             renderingBuckets.GetLayerObjects(layerIndex)) {
+          if (object->IsDrawnInsideAABB() &&
+              !object->GetAABB().intersects(viewArea))
+            continue;
+
+          object->DrawInBatch(*renderWindow, spriteBatch);
         }
+        spriteBatch.Flush(*renderWindow);
       }
     }
   }
@@ -265,23 +295,6 @@ void RuntimeScene::Render() {
   renderWindow->display();
 }
 
-bool RuntimeScene::OrderObjectsByZOrder(RuntimeObjNonOwningPtrList& objList) {
-  if (StandardSortMethod())
-    std::sort(objList.begin(),
-              objList.end(),
-              [](const RuntimeObject* o1, const RuntimeObject* o2) {
-                return o1->GetZOrder() < o2->GetZOrder();
-              });
-  else
-    std::stable_sort(objList.begin(),
-                     objList.end(),
-                     [](const RuntimeObject* o1, const RuntimeObject* o2) {
-                       return o1->GetZOrder() < o2->GetZOrder();
-                     });
-
-  return true;
-}
-
 RuntimeLayer& RuntimeScene::GetRuntimeLayer(const gd::String& name) {
   for (RuntimeLayer& layer : layers) {
     if (layer.GetName() == name) return layer;
@@ -301,23 +314,20 @@ const RuntimeLayer& RuntimeScene::GetRuntimeLayer(
 
 void RuntimeScene::ManageObjectsAfterEvents() {
   // Delete objects that were removed.
-  RuntimeObjNonOwningPtrList allObjects = objectsInstances.GetAllObjects();
-  for (std::size_t id = 0; id < allObjects.size(); ++id) {
-    if (allObjects[id]->GetName().empty()) {
+  objectsInstances.ForEachObject([this](RuntimeObject* object) {
+    if (object->GetName().empty()) {
       for (std::size_t i = 0; i < extensionsToBeNotifiedOnObjectDeletion.size();
            ++i)
         extensionsToBeNotifiedOnObjectDeletion[i]->ObjectDeletedFromScene(
-            *this, allObjects[id]);
+            *this, object);
 
-      objectsInstances.RemoveObject(
-          allObjects[id]);  // Remove from objects instances, not from the
-                            // temporary list!
+      objectsInstances.RemoveObject(object);
     }
-  }
+  });
+  objectsInstances.Compact();
 
   // Update objects positions, forces and behaviors
-  allObjects = objectsInstances.GetAllObjects();
-  for (RuntimeObject* object : allObjects) {
+  objectsInstances.ForEachObject([this](RuntimeObject* object) {
     double elapsedTimeInSeconds =
         static_cast<double>(object->GetElapsedTime(*this)) / 1000000.0;
     object->SetX(object->GetX() +
@@ -327,13 +337,12 @@ void RuntimeScene::ManageObjectsAfterEvents() {
     object->Update(*this);
     object->UpdateForce(elapsedTimeInSeconds);
     object->DoBehaviorsPostEvents(*this);
-  }
+  });
 }
 
 void RuntimeScene::ManageObjectsBeforeEvents() {
-  RuntimeObjNonOwningPtrList allObjects = objectsInstances.GetAllObjects();
-  for (std::size_t id = 0; id < allObjects.size(); ++id)
-    allObjects[id]->DoBehaviorsPreEvents(*this);
+  objectsInstances.ForEachObject(
+      [this](RuntimeObject* object) { object->DoBehaviorsPreEvents(*this); });
 }
 
 /**
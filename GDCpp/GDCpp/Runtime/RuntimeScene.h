@@ -14,9 +14,11 @@
 #include "GDCpp/Runtime/BehaviorsRuntimeSharedDataHolder.h"
 #include "GDCpp/Runtime/InputManager.h"
 #include "GDCpp/Runtime/ObjInstancesHolder.h"
+#include "GDCpp/Runtime/ObjectsRenderingBuckets.h"
 #include "GDCpp/Runtime/Project/Layout.h"
 #include "GDCpp/Runtime/RuntimeLayer.h"
 #include "GDCpp/Runtime/RuntimeVariablesContainer.h"
+#include "GDCpp/Runtime/SpriteBatch.h"
 #include "GDCpp/Runtime/TimeManager.h"
 namespace sf {
 class RenderWindow;
@@ -222,11 +224,6 @@ class GD_API RuntimeScene : public Scene {
    */
   void ManageRenderTargetEvents();
 
-  /**
-   * \brief Order an object list according to object's Z coordinate.
-   */
-  bool OrderObjectsByZOrder(RuntimeObjNonOwningPtrList& objList);
-
   /**
    * \brief Render a frame in the window
    */
@@ -265,6 +262,9 @@ class GD_API RuntimeScene : public Scene {
       behaviorsSharedDatas;  ///< Contains all behaviors shared datas.
   std::vector<RuntimeLayer>
       layers;  ///< The layers used at runtime to display the scene.
+  ObjectsRenderingBuckets
+      renderingBuckets;  ///< The objects of each layer, sorted by Z order.
+  SpriteBatch spriteBatch;  ///< Used to render the sprites of the objects.
   std::shared_ptr<CodeExecutionEngine> codeExecutionEngine;
   SceneChange
       requestedChange;  ///< What should be done at the end of the frame.
@@ -17,6 +17,7 @@
 #include "GDCpp/Runtime/Project/Project.h"
 #include "GDCpp/Runtime/RuntimeLayer.h"
 #include "GDCpp/Runtime/RuntimeScene.h"
+#include "GDCpp/Runtime/SpriteBatch.h"
 #include "GDCpp/Runtime/TinyXml/tinyxml.h"
 #if defined(GD_IDE_ONLY)
 #include "GDCore/IDE/Project/ArbitraryResourceWorker.h"
@@ -31,6 +32,16 @@
 gd::Animation RuntimeSpriteObject::badAnimation;
 gd::Sprite* RuntimeSpriteObject::badSpriteDatas = NULL;
 
+namespace {
+sf::BlendMode GetSFMLBlendMode(unsigned int blendMode) {
+  return blendMode == 0
+             ? sf::BlendAlpha
+             : (blendMode == 1
+                    ? sf::BlendAdd
+                    : (blendMode == 2 ? sf::BlendMultiply : sf::BlendNone));
+}
+}  // namespace
+
 RuntimeSpriteObject::RuntimeSpriteObject(RuntimeScene& scene,
                                          const gd::SpriteObject& spriteObject)
     : RuntimeObject(scene, spriteObject),
@@ -43,6 +54,10 @@ RuntimeSpriteObject::RuntimeSpriteObject(RuntimeScene& scene,
       animationSpeedScale(1.f),
       ptrToCurrentSprite(NULL),
       needUpdateCurrentSprite(true),
+      transformVersion(1),
+      hitBoxesVersion(0),
+      hitBoxesSoAVersion(0),
+      aabbVersion(0),
       opacity(255),
       blendMode(0),
       isFlippedX(false),
@@ -86,14 +101,19 @@ bool RuntimeSpriteObject::Draw(sf::RenderTarget& renderTarget) {
   // Don't draw anything if hidden
   if (hidden) return true;
 
-  renderTarget.draw(
-      GetCurrentSFMLSprite(),
-      sf::RenderStates(
-          blendMode == 0
-              ? sf::BlendAlpha
-              : (blendMode == 1
-                     ? sf::BlendAdd
-                     : (blendMode == 2 ? sf::BlendMultiply : sf::BlendNone))));
+  renderTarget.draw(GetCurrentSFMLSprite(),
+                    sf::RenderStates(GetSFMLBlendMode(blendMode)));
+
+  return true;
+}
+
+bool RuntimeSpriteObject::DrawInBatch(sf::RenderTarget& renderTarget,
+                                      SpriteBatch& spriteBatch) {
+  // Don't draw anything if hidden
+  if (hidden) return true;
+
+  spriteBatch.Draw(
+      renderTarget, GetCurrentSFMLSprite(), GetSFMLBlendMode(blendMode));
 
   return true;
 }
@@ -305,6 +325,7 @@ void RuntimeSpriteObject::UpdateCurrentSprite() const {
       sf::Color(colorR, colorV, colorB, opacity));
 
   needUpdateCurrentSprite = false;
+  transformVersion++;
 }
 
 void RuntimeSpriteObject::Update(const RuntimeScene& scene) {
@@ -351,14 +372,32 @@ const gd::Sprite& RuntimeSpriteObject::GetCurrentSprite() const {
   return *ptrToCurrentSprite;
 }
 
+sf::FloatRect RuntimeSpriteObject::GetAABB() const {
+  if (needUpdateCurrentSprite) UpdateCurrentSprite();
+  if (aabbVersion != transformVersion) {
+    aabbCache = RuntimeObject::GetAABB();
+    aabbVersion = transformVersion;
+  }
+
+  return aabbCache;
+}
+
 std::vector<Polygon2d> RuntimeSpriteObject::GetHitBoxes() const {
+  return GetCachedHitBoxes();
+}
+
+const std::vector<Polygon2d>& RuntimeSpriteObject::GetCachedHitBoxes() const {
+  const sf::Sprite& currentSFMLSprite = GetCurrentSFMLSprite();
+  if (hitBoxesVersion == transformVersion) return hitBoxesCache;
+
+  hitBoxesVersion = transformVersion;
+  std::vector<Polygon2d>& polygons = hitBoxesCache;
   if (currentAnimation >= animations.size()) {
-    std::vector<Polygon2d> hitboxes;  // Invalid animation, bail out.
-    return hitboxes;
+    polygons.clear();  // Invalid animation, bail out.
+    return polygons;
   }
-  const sf::Sprite& currentSFMLSprite = GetCurrentSFMLSprite();
 
-  std::vector<Polygon2d> polygons = GetCurrentSprite().GetCollisionMask();
+  polygons = GetCurrentSprite().GetCollisionMask();
   for (std::size_t i = 0; i < polygons.size(); ++i) {
     for (std::size_t j = 0; j < polygons[i].vertices.size(); ++j) {
       sf::Vector2f newVertice = currentSFMLSprite.getTransform().transformPoint(
@@ -372,11 +411,21 @@ std::vector<Polygon2d> RuntimeSpriteObject::GetHitBoxes() const {
                     polygons[i].vertices[j].y);
       polygons[i].vertices[j] = newVertice;
     }
+    polygons[i].ComputeEdges();
   }
 
   return polygons;
 }
 
+const std::vector<Polygon2dSoA>& RuntimeSpriteObject::GetCachedHitBoxesSoA()
+    const {
+  GetCachedHitBoxes();  // Update hitBoxesVersion.
+  if (hitBoxesSoAVersion == hitBoxesVersion) return hitBoxesSoACache;
+
+  hitBoxesSoAVersion = hitBoxesVersion;
+  return RuntimeObject::GetCachedHitBoxesSoA();
+}
+
 bool RuntimeSpriteObject::SetSprite(std::size_t nb) {
   if (currentAnimation >= GetAnimationsCount() ||
       currentDirection >=
@@ -59,6 +59,9 @@ class GD_API RuntimeSpriteObject : public RuntimeObject {
       const gd::InitialInstance& position);
 
   virtual bool Draw(sf::RenderTarget& renderTarget);
+  virtual bool DrawInBatch(sf::RenderTarget& renderTarget,
+                           SpriteBatch& spriteBatch);
+  virtual bool IsDrawnInsideAABB() const { return true; };
 
 #if defined(GD_IDE_ONLY)
   virtual void GetPropertyForDebugger(std::size_t propertyNb,
@@ -86,7 +89,10 @@ class GD_API RuntimeSpriteObject : public RuntimeObject {
   virtual bool SetAngle(float newAngle);
   virtual float GetAngle() const;
 
+  virtual sf::FloatRect GetAABB() const;
   virtual std::vector<Polygon2d> GetHitBoxes() const;
+  virtual const std::vector<Polygon2d>& GetCachedHitBoxes() const;
+  virtual const std::vector<Polygon2dSoA>& GetCachedHitBoxesSoA() const;
   virtual bool CursorOnObject(RuntimeScene& scene, bool accurate);
 
   /**
@@ -335,6 +341,15 @@ class GD_API RuntimeSpriteObject : public RuntimeObject {
 
   mutable gd::Sprite* ptrToCurrentSprite;  // Pointer to the current sprite
   mutable bool needUpdateCurrentSprite;
+  mutable std::size_t
+      transformVersion;  ///< Incremented each time the current sprite is
+                         ///< updated, to know if cached hitboxes and AABB
+                         ///< are still valid.
+  mutable std::size_t hitBoxesVersion;  ///< transformVersion of hitBoxesCache.
+  mutable std::size_t
+      hitBoxesSoAVersion;  ///< transformVersion of hitBoxesSoACache.
+  mutable std::size_t aabbVersion;      ///< transformVersion of aabbCache.
+  mutable sf::FloatRect aabbCache;
 
   std::vector<AnimationProxy> animations;
 
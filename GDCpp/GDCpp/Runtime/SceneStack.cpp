@@ -9,9 +9,17 @@
 #include "RuntimeScene.h"
 #include "SceneNameMangler.h"
 
+namespace {
+/// The number of preloaded textures uploaded at each step, to avoid freezing
+/// the game.
+const std::size_t preloadUploadsPerStep = 4;
+}
+
 bool SceneStack::Step() {
   if (stack.empty()) return false;
 
+  if (preloader) preloader->Update(preloadUploadsPerStep);
+
   auto& scene = stack.back();
   if (scene->RenderAndStep()) {
     auto request = scene->GetRequestedChange();
@@ -39,6 +47,7 @@ std::unique_ptr<RuntimeScene> SceneStack::Pop() {
 
   std::unique_ptr<RuntimeScene> scene = std::move(stack.back());
   stack.pop_back();
+  stackResources.pop_back();
   return scene;
 }
 
@@ -49,6 +58,12 @@ RuntimeScene* SceneStack::Push(gd::String newSceneName) {
     return nullptr;
   }
 
+  std::unique_ptr<ResourcesPreloader> resources;
+  if (preloader && preloadedSceneName == newSceneName) {
+    preloader->Finish();
+    resources = std::move(preloader);
+  }
+
   std::unique_ptr<RuntimeScene> newScene(new RuntimeScene(window, &game));
   if (!newScene->LoadFromScene(game.GetLayout(newSceneName))) {
     if (errorCallback)
@@ -65,14 +80,42 @@ RuntimeScene* SceneStack::Push(gd::String newSceneName) {
 
   newScene->ChangeRenderWindow(window);
   stack.push_back(std::move(newScene));
+  stackResources.push_back(std::move(resources));
   return stack.back().get();
 }
 
 RuntimeScene* SceneStack::Replace(gd::String newSceneName, bool clear) {
-  if (clear) {
-    while (!stack.empty()) stack.pop_back();
-  } else {
-    if (!stack.empty()) stack.pop_back();
+  while (!stack.empty()) {
+    stack.pop_back();
+    stackResources.pop_back();
+    if (!clear) break;
   }
   return Push(newSceneName);
 }
+
+void SceneStack::Preload(gd::String sceneName) {
+  if (preloader && preloadedSceneName == sceneName) return;
+
+  preloader.reset();
+  if (!game.HasLayoutNamed(sceneName)) {
+    if (errorCallback)
+      errorCallback("Scene \"" + sceneName + "\" does not exist.");
+    return;
+  }
+
+  std::set<gd::String> images;
+  std::set<gd::String> sounds;
+  ResourcesPreloader::GetLayoutResources(
+      game, game.GetLayout(sceneName), images, sounds);
+
+  preloadedSceneName = sceneName;
+  preloader.reset(new ResourcesPreloader(game.GetResourcesManager(),
+                                         *game.GetImageManager(),
+                                         game.GetSoundManager()));
+  preloader->Start(images, sounds);
+}
+
+bool SceneStack::IsPreloaded(const gd::String& sceneName) const {
+  return preloader && preloadedSceneName == sceneName &&
+         preloader->IsFinished();
+}
@@ -7,6 +7,7 @@
 #include <functional>
 #include <memory>
 #include <vector>
+#include "GDCpp/Runtime/ResourcesPreloader.h"
 class RuntimeGame;
 class RuntimeScene;
 namespace sf {
@@ -64,6 +65,26 @@ class GD_API SceneStack {
    */
   RuntimeScene *Replace(gd::String newSceneName, bool clear = false);
 
+  /**
+   * \brief Start loading in the background the images and sounds used by a
+   * scene, so that the game is not frozen for long when the scene is pushed
+   * on the stack.
+   *
+   * The loaded resources are made available a few at a time during the next
+   * calls to Step. If another scene was being preloaded, its resources are
+   * released.
+   *
+   * \param sceneName The name of the scene to preload, as found in the
+   * RuntimeGame.
+   */
+  void Preload(gd::String sceneName);
+
+  /**
+   * \brief Return true if the resources of the scene called \a sceneName are
+   * loaded (after a call to Preload).
+   */
+  bool IsPreloaded(const gd::String &sceneName) const;
+
   /**
    * \brief Set the callback called when an error occurs (loading failed...)
    */
@@ -80,6 +101,12 @@ class GD_API SceneStack {
   RuntimeGame &game;
   sf::RenderWindow *window;
   std::vector<std::unique_ptr<RuntimeScene>> stack;
+  std::vector<std::unique_ptr<ResourcesPreloader>>
+      stackResources;  ///< The resources preloaded for each scene of the
+                       ///< stack (or nullptr), kept as long as the scene
+                       ///< is alive.
+  std::unique_ptr<ResourcesPreloader> preloader;
+  gd::String preloadedSceneName;
   std::function<void(gd::String)> errorCallback;
   std::function<bool(RuntimeScene &)> loadCallback;
 };
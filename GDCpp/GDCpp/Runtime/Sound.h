@@ -6,6 +6,7 @@
 #ifndef SOUND_H
 #define SOUND_H
 #include <SFML/Audio.hpp>
+#include <memory>
 #include "GDCpp/Runtime/String.h"
 
 /**
@@ -18,6 +19,13 @@ class GD_API Sound : sf::NonCopyable {
  public:
   Sound();
   Sound(gd::String file);
+
+  /**
+   * \brief Create a sound playing \a buffer, which was loaded from \a file.
+   *
+   * The buffer is shared with the other sounds playing the same file.
+   */
+  Sound(gd::String file, std::shared_ptr<sf::SoundBuffer> buffer);
   Sound(const Sound& copy);
   virtual ~Sound(){};
 
@@ -64,7 +72,7 @@ class GD_API Sound : sf::NonCopyable {
   };
 
   // Order is important :
-  sf::SoundBuffer buffer;
+  std::shared_ptr<sf::SoundBuffer> buffer;
   sf::Sound sound;
 
   gd::String file;
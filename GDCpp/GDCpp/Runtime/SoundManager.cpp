@@ -27,8 +27,9 @@ void SoundManager::PlaySoundOnChannel(const gd::String& name,
                                       bool repeat,
                                       float volume,
                                       float pitch) {
+  const gd::String& file = GetFileFromSoundName(name);
   std::shared_ptr<Sound> sound =
-      std::make_shared<Sound>(GetFileFromSoundName(name));
+      std::make_shared<Sound>(file, GetSoundBuffer(name));
   sound->sound.play();
   sound->sound.setRelativeToListener(true);
 
@@ -42,8 +43,8 @@ void SoundManager::PlaySound(const gd::String& name,
                              bool repeat,
                              float volume,
                              float pitch) {
-  sounds.push_back(
-      std::shared_ptr<Sound>(new Sound(GetFileFromSoundName(name))));
+  const gd::String& file = GetFileFromSoundName(name);
+  sounds.push_back(std::make_shared<Sound>(file, GetSoundBuffer(name)));
   sounds.back()->sound.play();
   sounds.back()->sound.setRelativeToListener(true);
 
@@ -119,6 +120,29 @@ void SoundManager::ManageGarbage() {
   }
 }
 
+std::shared_ptr<sf::SoundBuffer> SoundManager::GetSoundBuffer(
+    const gd::String& name) {
+  const gd::String& file = GetFileFromSoundName(name);
+  auto it = soundBuffers.find(file);
+  if (it != soundBuffers.end() && !it->second.expired())
+    return it->second.lock();
+
+  auto buffer = std::make_shared<sf::SoundBuffer>();
+  gd::ResourcesLoader::Get()->LoadSoundBuffer(file, *buffer);
+  soundBuffers[file] = buffer;
+  return buffer;
+}
+
+bool SoundManager::HasLoadedSoundBuffer(const gd::String& name) const {
+  auto it = soundBuffers.find(GetFileFromSoundName(name));
+  return it != soundBuffers.end() && !it->second.expired();
+}
+
+void SoundManager::SetSoundBufferAsLoaded(
+    const gd::String& name, std::shared_ptr<sf::SoundBuffer> buffer) {
+  soundBuffers[GetFileFromSoundName(name)] = buffer;
+}
+
 std::shared_ptr<Music>& SoundManager::GetMusicOnChannel(int channel) {
   return musicsChannel[channel];
 }
@@ -142,11 +142,35 @@ class GD_API SoundManager {
    */
   void ManageGarbage();
 
+  /**
+   * \brief Return the sound buffer of the sound called \a name (resource name
+   * or filename), loading it if it's not already used by another sound.
+   */
+  std::shared_ptr<sf::SoundBuffer> GetSoundBuffer(const gd::String& name);
+
+  /**
+   * \brief Check if the sound buffer of the sound called \a name is loaded in
+   * memory.
+   */
+  bool HasLoadedSoundBuffer(const gd::String& name) const;
+
+  /**
+   * \brief Add a sound buffer loaded elsewhere (for example in the background
+   * by ResourcesPreloader) so that it's used by the sounds called \a name.
+   *
+   * Like the other sound buffers, it is unloaded when no shared pointer
+   * points to it anymore.
+   */
+  void SetSoundBufferAsLoaded(const gd::String& name,
+                              std::shared_ptr<sf::SoundBuffer> buffer);
+
  private:
   const gd::String& GetFileFromSoundName(const gd::String& name) const;
 
   std::map<std::size_t, std::shared_ptr<Sound> > soundsChannel;
   std::map<std::size_t, std::shared_ptr<Music> > musicsChannel;
+  std::map<gd::String, std::weak_ptr<sf::SoundBuffer> >
+      soundBuffers;  ///< Reference the sound buffers loaded, by filename.
 
   float globalVolume;
   gd::ResourcesManager* resourcesManager;
@@ -0,0 +1,71 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCpp/Runtime/SpriteBatch.h"
+#include <cmath>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+
+SpriteBatch::SpriteBatch()
+    : vertices(sf::Quads),
+      texture(nullptr),
+      drawCallsCount(0),
+      drawnVerticesCount(0) {}
+
+void SpriteBatch::Draw(sf::RenderTarget& renderTarget,
+                       const sf::Sprite& sprite,
+                       const sf::BlendMode& spriteBlendMode) {
+  if (vertices.getVertexCount() != 0 &&
+      (sprite.getTexture() != texture || !(spriteBlendMode == blendMode)))
+    Flush(renderTarget);
+
+  texture = sprite.getTexture();
+  blendMode = spriteBlendMode;
+
+  // Compute the vertices like sf::Sprite does.
+  const sf::IntRect& textureRect = sprite.getTextureRect();
+  float width = static_cast<float>(std::abs(textureRect.width));
+  float height = static_cast<float>(std::abs(textureRect.height));
+  float left = static_cast<float>(textureRect.left);
+  float right = left + textureRect.width;
+  float top = static_cast<float>(textureRect.top);
+  float bottom = top + textureRect.height;
+
+  const sf::Transform& transform = sprite.getTransform();
+  const sf::Color& color = sprite.getColor();
+  vertices.append(sf::Vertex(
+      transform.transformPoint(0, 0), color, sf::Vector2f(left, top)));
+  vertices.append(sf::Vertex(
+      transform.transformPoint(0, height), color, sf::Vector2f(left, bottom)));
+  vertices.append(sf::Vertex(transform.transformPoint(width, height),
+                             color,
+                             sf::Vector2f(right, bottom)));
+  vertices.append(sf::Vertex(
+      transform.transformPoint(width, 0), color, sf::Vector2f(right, top)));
+}
+
+void SpriteBatch::Flush(sf::RenderTarget& renderTarget) {
+  if (vertices.getVertexCount() == 0) return;
+
+  sf::RenderStates states(blendMode);
+  states.texture = texture;
+  DrawVertices(renderTarget, vertices, states);
+
+  drawCallsCount++;
+  drawnVerticesCount += vertices.getVertexCount();
+  vertices.clear();
+}
+
+void SpriteBatch::ResetStatistics() {
+  drawCallsCount = 0;
+  drawnVerticesCount = 0;
+}
+
+void SpriteBatch::DrawVertices(sf::RenderTarget& renderTarget,
+                               const sf::VertexArray& vertices,
+                               const sf::RenderStates& states) {
+  renderTarget.draw(vertices, states);
+}
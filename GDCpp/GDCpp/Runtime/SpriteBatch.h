@@ -0,0 +1,82 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef SPRITEBATCH_H
+#define SPRITEBATCH_H
+#include <cstddef>
+#include <SFML/Graphics/BlendMode.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
+namespace sf {
+class RenderStates;
+class RenderTarget;
+class Sprite;
+class Texture;
+}
+
+/**
+ * \brief Group the sprites drawn consecutively with the same texture and
+ * blend mode, so that they are drawn with a single draw call.
+ *
+ * Sprites are added with Draw, and the batch is drawn when a sprite with
+ * another texture or blend mode is added, or when Flush is called. Flush
+ * must be called before drawing anything else on the render target, so that
+ * the drawing order is kept.
+ *
+ * \see RuntimeObject::Draw
+ * \ingroup GameEngine
+ */
+class GD_API SpriteBatch {
+ public:
+  SpriteBatch();
+  virtual ~SpriteBatch(){};
+
+  /**
+   * \brief Add a sprite to the batch, drawing the sprites already in the batch
+   * if they use another texture or blend mode.
+   */
+  void Draw(sf::RenderTarget& renderTarget,
+            const sf::Sprite& sprite,
+            const sf::BlendMode& blendMode);
+
+  /**
+   * \brief Draw the sprites of the batch.
+   */
+  void Flush(sf::RenderTarget& renderTarget);
+
+  /**
+   * \brief Return the number of draw calls made since the creation of the
+   * batch (or the last call to ResetStatistics).
+   */
+  std::size_t GetDrawCallsCount() const { return drawCallsCount; }
+
+  /**
+   * \brief Return the number of vertices drawn since the creation of the
+   * batch (or the last call to ResetStatistics).
+   */
+  std::size_t GetDrawnVerticesCount() const { return drawnVerticesCount; }
+
+  /**
+   * \brief Reset the number of draw calls and vertices drawn.
+   */
+  void ResetStatistics();
+
+ protected:
+  /**
+   * \brief Draw the vertices on the render target. Can be redefined to draw
+   * somewhere else (for example in benchmarks).
+   */
+  virtual void DrawVertices(sf::RenderTarget& renderTarget,
+                            const sf::VertexArray& vertices,
+                            const sf::RenderStates& states);
+
+ private:
+  sf::VertexArray vertices;  ///< The vertices of the sprites of the batch.
+  const sf::Texture* texture;  ///< The texture of the sprites of the batch.
+  sf::BlendMode blendMode;     ///< The blend mode of the sprites of the batch.
+  std::size_t drawCallsCount;
+  std::size_t drawnVerticesCount;
+};
+
+#endif  // SPRITEBATCH_H
@@ -0,0 +1,197 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCpp/Runtime/Tools/LZ4Block.h"
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace {
+
+const std::size_t minMatch = 4;
+const std::size_t lastLiterals = 5;  ///< The last bytes are always literals.
+const std::size_t matchFindLimit =
+    12;  ///< The last match must start at least this number of bytes before
+         ///< the end of the block.
+const std::size_t maxOffset = 65535;
+const unsigned int hashLog = 12;
+
+std::uint32_t Read32(const unsigned char* p) {
+  std::uint32_t value;
+  std::memcpy(&value, p, sizeof(value));
+  return value;
+}
+
+std::uint32_t Hash(std::uint32_t sequence) {
+  return (sequence * 2654435761u) >> (32 - hashLog);
+}
+
+/**
+ * \brief Write a length in the format used by LZ4 after the token (a series
+ * of bytes, ended by a byte which is not 255).
+ */
+void WriteLength(unsigned char*& out, std::size_t length) {
+  while (length >= 255) {
+    *out++ = 255;
+    length -= 255;
+  }
+  *out++ = static_cast<unsigned char>(length);
+}
+
+/**
+ * \brief Write a sequence (literals, and then a match if \a matchLength is
+ * not 0).
+ * \return false if there is not enough space in the output.
+ */
+bool WriteSequence(unsigned char*& out,
+                   unsigned char* outEnd,
+                   const unsigned char* literals,
+                   std::size_t literalsLength,
+                   std::size_t offset,
+                   std::size_t matchLength) {
+  std::size_t maxSize = 1 + literalsLength / 255 + 1 + literalsLength + 2 +
+                        matchLength / 255 + 1;
+  if (static_cast<std::size_t>(outEnd - out) < maxSize) return false;
+
+  unsigned char* token = out++;
+  if (literalsLength >= 15) {
+    *token = 15 << 4;
+    WriteLength(out, literalsLength - 15);
+  } else {
+    *token = static_cast<unsigned char>(literalsLength << 4);
+  }
+  std::memcpy(out, literals, literalsLength);
+  out += literalsLength;
+
+  if (matchLength == 0) return true;  // Last sequence.
+
+  *out++ = static_cast<unsigned char>(offset & 0xFF);
+  *out++ = static_cast<unsigned char>(offset >> 8);
+  std::size_t length = matchLength - minMatch;
+  if (length >= 15) {
+    *token |= 15;
+    WriteLength(out, length - 15);
+  } else {
+    *token |= static_cast<unsigned char>(length);
+  }
+
+  return true;
+}
+
+/**
+ * \brief Read a length written after the token.
+ * \return false if the input ends before the length.
+ */
+bool ReadLength(const unsigned char*& in,
+                const unsigned char* inEnd,
+                std::size_t& length) {
+  unsigned char byte;
+  do {
+    if (in >= inEnd) return false;
+    byte = *in++;
+    length += byte;
+  } while (byte == 255);
+
+  return true;
+}
+
+}  // namespace
+
+namespace gd {
+
+std::size_t LZ4Block::Compress(const char* source,
+                               std::size_t sourceSize,
+                               char* destination,
+                               std::size_t destinationCapacity) {
+  const unsigned char* in = reinterpret_cast<const unsigned char*>(source);
+  unsigned char* out = reinterpret_cast<unsigned char*>(destination);
+  unsigned char* outEnd = out + destinationCapacity;
+
+  std::size_t anchor = 0;  // Start of the literals not written yet.
+  if (sourceSize > matchFindLimit) {
+    std::vector<std::uint32_t> positions(1 << hashLog, 0);
+    const std::size_t matchEndLimit = sourceSize - lastLiterals;
+    std::size_t pos = 0;
+    while (pos <= sourceSize - matchFindLimit) {
+      std::uint32_t sequence = Read32(in + pos);
+      std::uint32_t& lastPosition = positions[Hash(sequence)];
+      std::size_t candidate = lastPosition;
+      lastPosition = static_cast<std::uint32_t>(pos);
+
+      if (candidate < pos && pos - candidate <= maxOffset &&
+          Read32(in + candidate) == sequence) {
+        std::size_t matchLength = minMatch;
+        while (pos + matchLength < matchEndLimit &&
+               in[candidate + matchLength] == in[pos + matchLength])
+          ++matchLength;
+
+        if (!WriteSequence(out,
+                           outEnd,
+                           in + anchor,
+                           pos - anchor,
+                           pos - candidate,
+                           matchLength))
+          return 0;
+
+        pos += matchLength;
+        anchor = pos;
+      } else {
+        ++pos;
+      }
+    }
+  }
+
+  if (!WriteSequence(out, outEnd, in + anchor, sourceSize - anchor, 0, 0))
+    return 0;
+
+  return out - reinterpret_cast<unsigned char*>(destination);
+}
+
+bool LZ4Block::Uncompress(const char* source,
+                          std::size_t sourceSize,
+                          char* destination,
+                          std::size_t destinationSize) {
+  const unsigned char* in = reinterpret_cast<const unsigned char*>(source);
+  const unsigned char* inEnd = in + sourceSize;
+  unsigned char* outStart = reinterpret_cast<unsigned char*>(destination);
+  unsigned char* out = outStart;
+  unsigned char* outEnd = out + destinationSize;
+
+  while (in < inEnd) {
+    unsigned char token = *in++;
+
+    std::size_t literalsLength = token >> 4;
+    if (literalsLength == 15 && !ReadLength(in, inEnd, literalsLength))
+      return false;
+    if (literalsLength > static_cast<std::size_t>(inEnd - in) ||
+        literalsLength > static_cast<std::size_t>(outEnd - out))
+      return false;
+    std::memcpy(out, in, literalsLength);
+    in += literalsLength;
+    out += literalsLength;
+
+    if (in == inEnd) break;  // The last sequence has no match.
+
+    if (inEnd - in < 2) return false;
+    std::size_t offset = in[0] | (in[1] << 8);
+    in += 2;
+    if (offset == 0 || offset > static_cast<std::size_t>(out - outStart))
+      return false;
+
+    std::size_t matchLength = token & 15;
+    if (matchLength == 15 && !ReadLength(in, inEnd, matchLength)) return false;
+    matchLength += minMatch;
+    if (matchLength > static_cast<std::size_t>(outEnd - out)) return false;
+
+    // The match can overlap the output, so it is copied byte per byte.
+    const unsigned char* match = out - offset;
+    for (std::size_t i = 0; i < matchLength; ++i) out[i] = match[i];
+    out += matchLength;
+  }
+
+  return out == outEnd;
+}
+
+}  // namespace gd
@@ -0,0 +1,68 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef LZ4BLOCK_H
+#define LZ4BLOCK_H
+#include <cstddef>
+
+namespace gd {
+
+/**
+ * \brief Compress and uncompress data using the LZ4 block format.
+ *
+ * LZ4 is very fast to uncompress, which makes it suitable for resources
+ * loaded while the game is running. The compressor is a simple greedy
+ * implementation (using a hash table of the last positions of 4 bytes
+ * sequences): it produces valid LZ4 blocks, which are a bit larger than
+ * the ones of the reference implementation.
+ *
+ * \see DatFile
+ * \ingroup ResourcesManagement
+ */
+class GD_API LZ4Block {
+ public:
+  /**
+   * \brief Return the maximum size of the compressed data, for data of size
+   * \a size.
+   */
+  static std::size_t CompressBound(std::size_t size) {
+    return size + size / 255 + 16;
+  }
+
+  /**
+   * \brief Return the maximum size of the data obtained by uncompressing
+   * compressed data of size \a size.
+   *
+   * Each byte of a LZ4 block never produces more than 255 bytes.
+   */
+  static std::size_t UncompressBound(std::size_t size) { return size * 255; }
+
+  /**
+   * \brief Compress \a sourceSize bytes of \a source into \a destination.
+   *
+   * \return The size of the compressed data, or 0 if \a destinationCapacity
+   * is too small.
+   */
+  static std::size_t Compress(const char* source,
+                              std::size_t sourceSize,
+                              char* destination,
+                              std::size_t destinationCapacity);
+
+  /**
+   * \brief Uncompress the compressed data \a source into \a destination.
+   *
+   * \param destinationSize The size of the uncompressed data.
+   * \return true if the data was uncompressed, false if it is invalid or
+   * does not have the expected size.
+   */
+  static bool Uncompress(const char* source,
+                         std::size_t sourceSize,
+                         char* destination,
+                         std::size_t destinationSize);
+};
+
+}  // namespace gd
+
+#endif  // LZ4BLOCK_H
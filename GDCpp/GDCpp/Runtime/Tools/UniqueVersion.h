@@ -0,0 +1 @@
+#include "GDCore/Tools/UniqueVersion.h"
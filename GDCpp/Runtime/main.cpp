@@ -110,7 +110,7 @@ int main( int argc, char *p_argv[] )
         int size = (fsize+15)&(~15);
 
         cout << "Getting src raw data..." << endl;
-        char * ibuffer = resLoader->LoadBinaryFile( "src" );
+        const char * ibuffer = resLoader->LoadBinaryFile( "src" );
         char * obuffer = new char[size];
 
         unsigned char key[] = "-P:j$4t&OHIUVM/Z+u4DeDP.";
@@ -125,16 +125,29 @@ int main( int argc, char *p_argv[] )
         delete [] obuffer;
 
         cout << "Loading game data..." << endl;
-        TiXmlDocument doc;
-        if ( !doc.Parse(uncryptedSrc.c_str()) )
+        if ( gd::Serializer::IsBinary(uncryptedSrc.data(), uncryptedSrc.size()) )
         {
-            return DisplayMessage("Unable to parse game data. Aborting.");
-        }
+            //Game data exported in the binary format, much faster to load.
+            bool parsed = false;
+            gd::SerializerElement rootElement = gd::Serializer::FromBinary(uncryptedSrc, true, &parsed);
+            if ( !parsed )
+                return DisplayMessage("Unable to parse game data. Aborting.");
 
-        TiXmlHandle hdl(&doc);
-        gd::SerializerElement rootElement;
-        gd::Serializer::FromXML(rootElement, hdl.FirstChildElement().Element());
-        game.UnserializeFrom(rootElement);
+            game.UnserializeFrom(rootElement);
+        }
+        else
+        {
+            TiXmlDocument doc;
+            if ( !doc.Parse(uncryptedSrc.c_str()) )
+            {
+                return DisplayMessage("Unable to parse game data. Aborting.");
+            }
+
+            TiXmlHandle hdl(&doc);
+            gd::SerializerElement rootElement;
+            gd::Serializer::FromXML(rootElement, hdl.FirstChildElement().Element());
+            game.UnserializeFrom(rootElement);
+        }
 	}
 
     if ( game.GetLayoutsCount() == 0 )
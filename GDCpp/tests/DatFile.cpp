@@ -0,0 +1,205 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering DatFile class and LZ4 compression.
+ */
+#include "GDCpp/Runtime/DatFile.h"
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+#include "GDCpp/Runtime/Tools/LZ4Block.h"
+#include "catch.hpp"
+
+namespace {
+
+void WriteFile(const std::string& filename, const std::string& content) {
+  std::ofstream file(filename, std::ios_base::out | std::ios_base::binary);
+  file << content;
+}
+
+std::string CompressAndUncompress(const std::string& data) {
+  std::string compressed(gd::LZ4Block::CompressBound(data.size()), 0);
+  std::size_t compressedSize = gd::LZ4Block::Compress(
+      data.data(), data.size(), &compressed[0], compressed.size());
+  REQUIRE(compressedSize != 0);
+
+  std::string uncompressed(data.size(), 0);
+  REQUIRE(gd::LZ4Block::Uncompress(
+      compressed.data(), compressedSize, &uncompressed[0], data.size()));
+  return uncompressed;
+}
+
+}  // namespace
+
+TEST_CASE("LZ4Block", "[game-engine]") {
+  SECTION("Data is the same after compression") {
+    REQUIRE(CompressAndUncompress("") == "");
+    REQUIRE(CompressAndUncompress("Hello") == "Hello");
+
+    std::string repeated;
+    for (std::size_t i = 0; i < 1000; ++i)
+      repeated += "Hello world " + std::to_string(i % 7);
+    REQUIRE(CompressAndUncompress(repeated) == repeated);
+
+    std::string random;
+    unsigned int seed = 42;
+    for (std::size_t i = 0; i < 70000; ++i) {
+      seed = seed * 1103515245 + 12345;
+      random += static_cast<char>(i % 3 == 0 ? (seed >> 16) : 'a');
+    }
+    REQUIRE(CompressAndUncompress(random) == random);
+  }
+
+  SECTION("Repetitive data is compressed") {
+    std::string data(10000, 'a');
+    std::string compressed(gd::LZ4Block::CompressBound(data.size()), 0);
+    REQUIRE(gd::LZ4Block::Compress(
+                data.data(), data.size(), &compressed[0], compressed.size()) <
+            100);
+  }
+
+  SECTION("Invalid data is refused") {
+    std::string data(100, 'a');
+    std::string compressed(gd::LZ4Block::CompressBound(data.size()), 0);
+    std::size_t compressedSize = gd::LZ4Block::Compress(
+        data.data(), data.size(), &compressed[0], compressed.size());
+
+    std::string uncompressed(200, 0);
+    REQUIRE(gd::LZ4Block::Uncompress(
+                compressed.data(), compressedSize, &uncompressed[0], 99) ==
+            false);
+    REQUIRE(gd::LZ4Block::Uncompress(
+                compressed.data(), compressedSize - 1, &uncompressed[0], 100) ==
+            false);
+  }
+}
+
+TEST_CASE("DatFile", "[game-engine]") {
+  std::vector<gd::String> files;
+  std::vector<std::string> contents;
+  for (std::size_t i = 0; i < 20; ++i) {
+    files.push_back("DatFileTest" + gd::String::From(i) + ".test");
+    contents.push_back(std::string(i * 100, 'a' + i) + "end");
+    WriteFile(files.back().ToLocale(), contents.back());
+  }
+  files.push_back("DatFileTestEmpty.test");
+  contents.push_back("");
+  WriteFile(files.back().ToLocale(), contents.back());
+
+  SECTION("Files are read from the DAT file") {
+    for (bool compress : {false, true}) {
+      DatFile datFile;
+      REQUIRE(datFile.Create(files, ".", "DatFileTest.egd", compress));
+      REQUIRE(datFile.Read("DatFileTest.egd"));
+
+      REQUIRE(datFile.ContainsFile("Unknown.test") == false);
+      REQUIRE((datFile.GetFile("Unknown.test") == NULL));
+      REQUIRE(datFile.GetFileSize("Unknown.test") == 0);
+
+      std::vector<const char*> buffers;
+      for (std::size_t i = 0; i < files.size(); ++i) {
+        REQUIRE(datFile.ContainsFile(files[i]));
+        REQUIRE(datFile.GetFileSize(files[i]) == contents[i].size());
+        const char* buffer = datFile.GetFile(files[i]);
+        REQUIRE((buffer != NULL));
+        buffers.push_back(buffer);
+      }
+
+      // Buffers stay valid when other files are read.
+      for (std::size_t i = 0; i < files.size(); ++i) {
+        REQUIRE(std::string(buffers[i], contents[i].size()) == contents[i]);
+      }
+    }
+  }
+
+  SECTION("DAT files of the version 0.1 can be read") {
+    {
+      std::ofstream datfile("DatFileTestLegacy.egd",
+                            std::ios_base::out | std::ios_base::binary);
+      sDATHeader header;
+      memset(&header, 0, sizeof(header));
+      memcpy(header.uniqueID, "EXEGD", 5);
+      memcpy(header.version, "0.1", 3);
+      header.nb_files = 2;
+      datfile.write((char*)&header, sizeof(header));
+
+      long offset = sizeof(header) + 2 * sizeof(sFileEntry);
+      for (std::size_t i = 0; i < 2; ++i) {
+        sFileEntry entry;
+        memset(&entry, 0, sizeof(entry));
+        strcpy(entry.name, files[i + 1].c_str());
+        entry.size = contents[i + 1].size();
+        entry.offset = offset;
+        offset += entry.size;
+        datfile.write((char*)&entry, sizeof(entry));
+      }
+      datfile << contents[1] << contents[2];
+    }
+
+    DatFile datFile;
+    REQUIRE(datFile.Read("DatFileTestLegacy.egd"));
+    REQUIRE(datFile.ContainsFile(files[0]) == false);
+    REQUIRE(datFile.GetFileSize(files[2]) == contents[2].size());
+    REQUIRE(std::string(datFile.GetFile(files[2]), contents[2].size()) ==
+            contents[2]);
+    REQUIRE(std::string(datFile.GetFile(files[1]), contents[1].size()) ==
+            contents[1]);
+  }
+
+  SECTION("Invalid DAT files are refused") {
+    WriteFile("DatFileTestInvalid.egd", "EXEGD0.2");
+    DatFile datFile;
+    REQUIRE(datFile.Read("DatFileTestInvalid.egd") == false);
+    REQUIRE(datFile.Read("DatFileTestUnknown.egd") == false);
+  }
+
+  SECTION("DAT files with an unknown version or invalid sizes are refused") {
+    DatFile datFile;
+    REQUIRE(datFile.Create(files, ".", "DatFileTest.egd", true));
+    std::string content;
+    {
+      std::ifstream file("DatFileTest.egd",
+                         std::ios_base::in | std::ios_base::binary);
+      content.assign(std::istreambuf_iterator<char>(file),
+                     std::istreambuf_iterator<char>());
+    }
+    REQUIRE(datFile.Read("DatFileTest.egd"));
+
+    std::string unknownVersion = content;
+    memcpy(&unknownVersion[offsetof(sDATHeader, version)], "0.3", 3);
+    WriteFile("DatFileTestInvalid.egd", unknownVersion);
+    REQUIRE(datFile.Read("DatFileTestInvalid.egd") == false);
+
+    std::string unknownID = content;
+    memcpy(&unknownID[offsetof(sDATHeader, uniqueID)], "EXEXX", 5);
+    memcpy(&unknownID[offsetof(sDATHeader, version)], "0.1", 3);
+    WriteFile("DatFileTestInvalid.egd", unknownID);
+    REQUIRE(datFile.Read("DatFileTestInvalid.egd") == false);
+
+    // The last file is the biggest one, and is compressed.
+    std::size_t entryOffset = sizeof(sDATHeader) + sizeof(std::uint32_t) +
+                              (files.size() - 2) * sizeof(sFileEntryV2);
+    sFileEntryV2 entry;
+    memcpy(&entry, &content[entryOffset], sizeof(entry));
+    REQUIRE((entry.flags & DatFile::CompressedFile) != 0);
+
+    std::string hugeFile = content;
+    entry.originalSize = std::uint64_t(1) << 60;
+    memcpy(&hugeFile[entryOffset], &entry, sizeof(entry));
+    WriteFile("DatFileTestInvalid.egd", hugeFile);
+    REQUIRE(datFile.Read("DatFileTestInvalid.egd") == false);
+
+    std::string wrongSize = content;
+    entry.flags = 0;
+    entry.originalSize = entry.size + 1;
+    memcpy(&wrongSize[entryOffset], &entry, sizeof(entry));
+    WriteFile("DatFileTestInvalid.egd", wrongSize);
+    REQUIRE(datFile.Read("DatFileTestInvalid.egd") == false);
+  }
+}
@@ -7,6 +7,8 @@
  * @file Tests covering ObjInstancesHolder class.
  */
 #include "GDCpp/Runtime/ObjInstancesHolder.h"
+#include <chrono>
+#include <iostream>
 #include "GDCore/CommonTools.h"
 #include "GDCore/Project/ObjectsContainer.h"
 #include "GDCore/Project/Layout.h"
@@ -16,6 +18,26 @@
 #include "GDCpp/Runtime/RuntimeScene.h"
 #include "catch.hpp"
 
+namespace {
+
+/**
+ * \brief A RuntimeObject that can be renamed, like objects deleted from a
+ * scene (see RuntimeObject::DeleteFromScene).
+ */
+class RenamableRuntimeObject : public RuntimeObject {
+ public:
+  RenamableRuntimeObject(RuntimeScene& scene, const gd::Object& object)
+      : RuntimeObject(scene, object){};
+
+  void SetName(const gd::String& newName) { name = newName; }
+};
+
+void RenameObject(RuntimeObject* object, const gd::String& newName) {
+  dynamic_cast<RenamableRuntimeObject&>(*object).SetName(newName);
+}
+
+}  // namespace
+
 TEST_CASE("ObjInstancesHolder", "[common]") {
   SECTION("Basics") {
     gd::Object obj1("1");
@@ -62,4 +84,141 @@ TEST_CASE("ObjInstancesHolder", "[common]") {
     REQUIRE(container.GetObjects("2").size() == 3);
     REQUIRE(container.GetObjectsRawPointers("2").size() == 3);
   }
+
+  SECTION("Removing and renaming objects keep the order of the objects") {
+    gd::Object obj1("1");
+
+    RuntimeGame game;
+    RuntimeScene scene(NULL, &game);
+
+    ObjInstancesHolder container;
+    std::vector<RuntimeObject*> objects;
+    for (std::size_t i = 0; i < 5; ++i) {
+      objects.push_back(container.AddObject(std::unique_ptr<RuntimeObject>(
+          new RenamableRuntimeObject(scene, obj1))));
+    }
+
+    container.RemoveObject(objects[1]);
+    RenameObject(objects[3], "2");
+    container.ObjectNameHasChanged(objects[3]);
+
+    // Removed objects are not returned, even before the container is
+    // compacted.
+    REQUIRE(container.GetAllObjects().size() == 4);
+    REQUIRE(container.GetObjectsRawPointers("1") ==
+            std::vector<RuntimeObject*>({objects[0], objects[2], objects[4]}));
+    REQUIRE(container.GetObjectsRawPointers("2") ==
+            std::vector<RuntimeObject*>({objects[3]}));
+
+    container.Compact();
+    REQUIRE(container.GetObjects("1").size() == 3);
+    REQUIRE(container.GetObjects("1")[1].get() == objects[2]);
+
+    // Objects can still be removed after the container is compacted.
+    container.RemoveObject(objects[2]);
+    container.RemoveObject(objects[3]);
+    REQUIRE(container.GetObjectsRawPointers("1") ==
+            std::vector<RuntimeObject*>({objects[0], objects[4]}));
+    REQUIRE(container.GetObjects("2").size() == 0);
+
+    ObjInstancesHolder copy = container;
+    REQUIRE(copy.GetAllObjects().size() == 2);
+  }
+
+  SECTION("ForEachObject") {
+    gd::Object obj1("1");
+    gd::Object obj2("2");
+
+    RuntimeGame game;
+    RuntimeScene scene(NULL, &game);
+
+    ObjInstancesHolder container;
+    std::vector<RuntimeObject*> objects;
+    for (std::size_t i = 0; i < 6; ++i) {
+      objects.push_back(container.AddObject(std::unique_ptr<RuntimeObject>(
+          new RenamableRuntimeObject(scene, i % 2 == 0 ? obj1 : obj2))));
+    }
+
+    // Objects are grouped by name.
+    std::vector<RuntimeObject*> visitedObjects;
+    container.ForEachObject([&visitedObjects](RuntimeObject* object) {
+      visitedObjects.push_back(object);
+    });
+    REQUIRE(visitedObjects == std::vector<RuntimeObject*>({objects[0],
+                                                           objects[2],
+                                                           objects[4],
+                                                           objects[1],
+                                                           objects[3],
+                                                           objects[5]}));
+    REQUIRE(container.GetAllObjects() == visitedObjects);
+
+    // Objects added or renamed during the iteration are not visited, and
+    // removed objects are skipped.
+    visitedObjects.clear();
+    container.ForEachObject([&](RuntimeObject* object) {
+      visitedObjects.push_back(object);
+      if (object == objects[0]) {
+        container.AddObject(
+            std::unique_ptr<RuntimeObject>(new RuntimeObject(scene, obj2)));
+        container.RemoveObject(objects[3]);
+        RenameObject(object, "2");
+        container.ObjectNameHasChanged(object);
+      }
+    });
+    REQUIRE(visitedObjects == std::vector<RuntimeObject*>({objects[0],
+                                                           objects[2],
+                                                           objects[4],
+                                                           objects[1],
+                                                           objects[5]}));
+    REQUIRE(container.GetAllObjects().size() == 6);
+
+    // Only GetAllObjects and GetObjectsRawPointers allocate lists.
+    std::size_t listsAllocationsCount = container.GetListsAllocationsCount();
+    container.ForEachObject([](RuntimeObject* object) {});
+    REQUIRE(container.GetListsAllocationsCount() == listsAllocationsCount);
+    container.GetObjectsRawPointers("1");
+    REQUIRE(container.GetListsAllocationsCount() == listsAllocationsCount + 1);
+  }
+
+  SECTION("Stress test") {
+    const std::size_t objectsCountPerFrame = 10000;
+    gd::Object obj1("1");
+    gd::Object obj2("2");
+
+    RuntimeGame game;
+    RuntimeScene scene(NULL, &game);
+
+    ObjInstancesHolder container;
+    std::vector<RuntimeObject*> objects;
+    auto start = std::chrono::steady_clock::now();
+    for (std::size_t frame = 0; frame < 10; ++frame) {
+      // Delete the objects created during the previous frame, the way the
+      // scene does it, then compact the lists at the end of the frame.
+      for (RuntimeObject* object : objects) {
+        RenameObject(object, "");
+        container.ObjectNameHasChanged(object);
+      }
+      for (RuntimeObject* object : objects) container.RemoveObject(object);
+      container.Compact();
+      REQUIRE(container.GetAllObjects().size() == 0);
+
+      objects.clear();
+      for (std::size_t i = 0; i < objectsCountPerFrame; ++i) {
+        objects.push_back(container.AddObject(std::unique_ptr<RuntimeObject>(
+            new RenamableRuntimeObject(scene, i % 2 == 0 ? obj1 : obj2))));
+      }
+      REQUIRE(container.GetObjects("1").size() == objectsCountPerFrame / 2);
+      REQUIRE(container.GetObjectsRawPointers("2").size() ==
+              objectsCountPerFrame / 2);
+      REQUIRE(container.GetObjectsRawPointers("2")[0] == objects[1]);
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    std::cout << "ObjInstancesHolder: 10 frames creating and destroying "
+              << objectsCountPerFrame << " objects: "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(end -
+                                                                       start)
+                     .count()
+              << "ms" << std::endl;
+  }
 }
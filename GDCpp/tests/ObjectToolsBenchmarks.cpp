@@ -0,0 +1,157 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Benchmarks of the conditions testing two lists of objects.
+ */
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <tuple>
+#include "GDCore/Project/Object.h"
+#include "GDCpp/Extensions/Builtin/ObjectTools.h"
+#include "GDCpp/Runtime/RuntimeGame.h"
+#include "GDCpp/Runtime/RuntimeObject.h"
+#include "GDCpp/Runtime/RuntimeObjectsListsTools.h"
+#include "GDCpp/Runtime/RuntimeScene.h"
+#include "catch.hpp"
+
+namespace {
+/**
+ * \brief An object with a size, so that it has a hitbox.
+ */
+class SizedRuntimeObject : public RuntimeObject {
+ public:
+  SizedRuntimeObject(RuntimeScene &scene, const gd::Object &object)
+      : RuntimeObject(scene, object){};
+  virtual ~SizedRuntimeObject(){};
+
+  virtual float GetWidth() const { return 32; };
+  virtual float GetHeight() const { return 32; };
+};
+
+template <typename F>
+long long MeasureMilliseconds(F function) {
+  auto start = std::chrono::steady_clock::now();
+  function();
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration_cast<std::chrono::milliseconds>(end - start)
+      .count();
+}
+}  // namespace
+
+TEST_CASE("ObjectTools - Benchmarks", "[benchmarks][game-engine]") {
+  const std::size_t objectsCount = 5000;
+
+  RuntimeGame game;
+  RuntimeScene scene(NULL, &game);
+  gd::Object object1("1");
+  gd::Object object2("2");
+
+  // Spread the objects in a 4000x4000 area, so that each object is colliding
+  // with a few others.
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<float> position(0, 4000);
+  std::vector<std::unique_ptr<RuntimeObject> > objects;
+  std::vector<RuntimeObject *> allObjects1, allObjects2;
+  for (std::size_t i = 0; i < objectsCount * 2; ++i) {
+    objects.push_back(std::unique_ptr<RuntimeObject>(
+        new SizedRuntimeObject(scene, i < objectsCount ? object1 : object2)));
+    objects.back()->SetX(position(generator));
+    objects.back()->SetY(position(generator));
+    (i < objectsCount ? allObjects1 : allObjects2)
+        .push_back(objects.back().get());
+  }
+
+  auto runBenchmark = [&](const gd::String &benchmarkName,
+                          bool conditionInverted,
+                          std::function<bool(RuntimeObjectsLists,
+                                             RuntimeObjectsLists,
+                                             bool)> condition) {
+    std::vector<RuntimeObject *> list1 = allObjects1, list2 = allObjects2;
+    RuntimeObjectsLists objectsLists1, objectsLists2;
+    objectsLists1["1"] = &list1;
+    objectsLists2["2"] = &list2;
+
+    bool result = false;
+    long long duration = MeasureMilliseconds([&]() {
+      result = condition(objectsLists1, objectsLists2, conditionInverted);
+    });
+    std::cout << benchmarkName << " (" << objectsCount << " vs "
+              << objectsCount << " objects): " << duration << "ms, "
+              << list1.size() << " and " << list2.size() << " objects picked"
+              << std::endl;
+
+    return std::make_tuple(result, list1, list2);
+  };
+
+  SECTION("Collision") {
+    for (bool conditionInverted : {false, true}) {
+      auto withBroadPhase = runBenchmark(
+          conditionInverted ? "Collision (inverted)" : "Collision",
+          conditionInverted,
+          [&scene](RuntimeObjectsLists objectsLists1,
+                   RuntimeObjectsLists objectsLists2,
+                   bool conditionInverted) {
+            return HitBoxesCollision(
+                objectsLists1, objectsLists2, conditionInverted, scene);
+          });
+      auto withoutBroadPhase = runBenchmark(
+          "  Without broad phase",
+          conditionInverted,
+          [](RuntimeObjectsLists objectsLists1,
+             RuntimeObjectsLists objectsLists2,
+             bool conditionInverted) {
+            return TwoObjectListsTest(
+                objectsLists1,
+                objectsLists2,
+                conditionInverted,
+                [](RuntimeObject *obj1, RuntimeObject *obj2) {
+                  return obj1->IsCollidingWith(obj2, false);
+                });
+          });
+
+      REQUIRE(std::get<0>(withBroadPhase) == true);
+      REQUIRE(withBroadPhase == withoutBroadPhase);
+    }
+  }
+
+  SECTION("Distance") {
+    for (bool conditionInverted : {false, true}) {
+      auto withBroadPhase = runBenchmark(
+          conditionInverted ? "Distance (inverted)" : "Distance",
+          conditionInverted,
+          [](RuntimeObjectsLists objectsLists1,
+             RuntimeObjectsLists objectsLists2,
+             bool conditionInverted) {
+            return DistanceBetweenObjects(
+                objectsLists1, objectsLists2, 50, conditionInverted);
+          });
+      auto withoutBroadPhase = runBenchmark(
+          "  Without broad phase",
+          conditionInverted,
+          [](RuntimeObjectsLists objectsLists1,
+             RuntimeObjectsLists objectsLists2,
+             bool conditionInverted) {
+            return TwoObjectListsTest(
+                objectsLists1,
+                objectsLists2,
+                conditionInverted,
+                [](RuntimeObject *obj1, RuntimeObject *obj2) {
+                  float x = obj1->GetDrawableX() + obj1->GetCenterX() -
+                            (obj2->GetDrawableX() + obj2->GetCenterX());
+                  float y = obj1->GetDrawableY() + obj1->GetCenterY() -
+                            (obj2->GetDrawableY() + obj2->GetCenterY());
+                  return x * x + y * y <= 50 * 50;
+                });
+          });
+
+      REQUIRE(std::get<0>(withBroadPhase) == true);
+      REQUIRE(withBroadPhase == withoutBroadPhase);
+    }
+  }
+}
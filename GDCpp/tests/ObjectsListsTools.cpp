@@ -6,6 +6,7 @@
 /**
  * @file Tests covering common features of GDevelop C++ Platform.
  */
+#include <cmath>
 #include "GDCore/CommonTools.h"
 #include "GDCore/Project/ObjectsContainer.h"
 #include "GDCore/Project/Layout.h"
@@ -101,6 +102,60 @@ TEST_CASE("ObjectsListsTools", "[game-engine]") {
     REQUIRE(list1[0] == &obj1A);
     REQUIRE(list2[0] == &obj2C);
   }
+  SECTION("TwoObjectListsTestWithBroadPhase") {
+    std::map<gd::String, std::vector<RuntimeObject*>*> map1;
+    std::map<gd::String, std::vector<RuntimeObject*>*> map2;
+    std::vector<RuntimeObject*> list1 = {&obj1A, &obj1B, &obj1C};
+    std::vector<RuntimeObject*> list2 = {&obj2A, &obj2B, &obj2C};
+    map1["1"] = &list1;
+    map2["2"] = &list2;
+    obj1A.SetX(0);
+    obj1B.SetX(100);
+    obj1C.SetX(200);
+    obj2A.SetX(5);
+    obj2B.SetX(1000);
+    obj2C.SetX(195);
+
+    auto getArea = [](RuntimeObject* obj) {
+      return sf::FloatRect(obj->GetX() - 10, obj->GetY() - 10, 20, 20);
+    };
+    std::size_t predicateCallsCount = 0;
+    auto isNear = [&predicateCallsCount](RuntimeObject* obj1,
+                                         RuntimeObject* obj2) {
+      predicateCallsCount++;
+      return std::abs(obj1->GetX() - obj2->GetX()) <= 20;
+    };
+
+    REQUIRE(TwoObjectListsTestWithBroadPhase(
+                map1, map2, true, getArea, isNear) == true);
+    REQUIRE(predicateCallsCount == 2);  // Only close objects are tested.
+    REQUIRE(list1.size() == 1);  // Only obj1B is far from all objects.
+    REQUIRE(list1[0] == &obj1B);
+    REQUIRE(list2.size() == 3);
+
+    list1 = {&obj1A, &obj1B, &obj1C};
+    REQUIRE(TwoObjectListsTestWithBroadPhase(
+                map1, map2, false, getArea, isNear) == true);
+    REQUIRE(list1.size() == 2);
+    REQUIRE(list1[0] == &obj1A);
+    REQUIRE(list1[1] == &obj1C);
+    REQUIRE(list2.size() == 2);
+    REQUIRE(list2[0] == &obj2A);
+    REQUIRE(list2[1] == &obj2C);
+
+    SECTION("Same list in both lists") {
+      std::map<gd::String, std::vector<RuntimeObject*>*> map;
+      std::vector<RuntimeObject*> list = {&obj1A, &obj1B, &obj1C, &obj2A};
+      map["1"] = &list;
+
+      // An object is never tested with itself.
+      REQUIRE(TwoObjectListsTestWithBroadPhase(
+                  map, map, false, getArea, isNear) == true);
+      REQUIRE(list.size() == 2);
+      REQUIRE(list[0] == &obj1A);
+      REQUIRE(list[1] == &obj2A);
+    }
+  }
   SECTION("PickNearestObject") {
     std::map<gd::String, std::vector<RuntimeObject*>*> map;
     std::vector<RuntimeObject*> list1 = {&obj1A, &obj1B, &obj1C};
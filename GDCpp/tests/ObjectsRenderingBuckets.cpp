@@ -0,0 +1,81 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering ObjectsRenderingBuckets class.
+ */
+#include "GDCpp/Runtime/ObjectsRenderingBuckets.h"
+#include "GDCore/Project/Object.h"
+#include "GDCpp/Runtime/ObjInstancesHolder.h"
+#include "GDCpp/Runtime/RuntimeGame.h"
+#include "GDCpp/Runtime/RuntimeLayer.h"
+#include "GDCpp/Runtime/RuntimeObject.h"
+#include "GDCpp/Runtime/RuntimeScene.h"
+#include "catch.hpp"
+
+TEST_CASE("ObjectsRenderingBuckets", "[game-engine]") {
+  gd::Object obj1("1");
+  gd::Object obj2("2");
+
+  RuntimeGame game;
+  RuntimeScene scene(NULL, &game);
+
+  std::vector<RuntimeLayer> layers(2);
+  layers[1].SetName("Foreground");
+
+  ObjInstancesHolder container;
+  std::vector<RuntimeObject *> objects;
+  for (std::size_t i = 0; i < 6; ++i) {
+    objects.push_back(container.AddObject(std::unique_ptr<RuntimeObject>(
+        new RuntimeObject(scene, i < 3 ? obj1 : obj2))));
+  }
+  objects[0]->SetZOrder(2);
+  objects[1]->SetZOrder(1);
+  objects[3]->SetZOrder(1);
+  objects[4]->SetLayer("Foreground");
+  objects[5]->SetLayer("Unknown layer");
+
+  ObjectsRenderingBuckets buckets;
+  buckets.Update(container, layers);
+  REQUIRE(buckets.GetLayerObjects(0) ==
+          std::vector<RuntimeObject *>(
+              {objects[2], objects[1], objects[3], objects[0]}));
+  REQUIRE(buckets.GetLayerObjects(1) ==
+          std::vector<RuntimeObject *>({objects[4]}));
+
+  SECTION("Layers are sorted only when needed") {
+    std::size_t sortsCount = buckets.GetSortsCount();
+    buckets.Update(container, layers);
+    REQUIRE(buckets.GetSortsCount() == sortsCount);
+
+    objects[2]->SetZOrder(3);
+    buckets.Update(container, layers);
+    REQUIRE(buckets.GetSortsCount() == sortsCount + 1);
+    REQUIRE(buckets.GetLayerObjects(0) ==
+            std::vector<RuntimeObject *>(
+                {objects[1], objects[3], objects[0], objects[2]}));
+  }
+
+  SECTION("Objects changing of layer") {
+    objects[0]->SetLayer("Foreground");
+    objects[5]->SetLayer("");
+    buckets.Update(container, layers);
+    REQUIRE(buckets.GetLayerObjects(0) ==
+            std::vector<RuntimeObject *>(
+                {objects[2], objects[5], objects[1], objects[3]}));
+    REQUIRE(buckets.GetLayerObjects(1) ==
+            std::vector<RuntimeObject *>({objects[4], objects[0]}));
+  }
+
+  SECTION("Objects added or removed") {
+    container.RemoveObject(objects[1]);
+    RuntimeObject *newObject = container.AddObject(
+        std::unique_ptr<RuntimeObject>(new RuntimeObject(scene, obj1)));
+    buckets.Update(container, layers);
+    REQUIRE(buckets.GetLayerObjects(0) ==
+            std::vector<RuntimeObject *>(
+                {objects[2], newObject, objects[3], objects[0]}));
+  }
+}
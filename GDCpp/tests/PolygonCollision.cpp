@@ -0,0 +1,183 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the collision tests between polygons.
+ */
+#include "GDCpp/Runtime/PolygonCollision.h"
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <random>
+#include "GDCpp/Runtime/Polygon2d.h"
+#include "catch.hpp"
+
+namespace {
+/**
+ * \brief Create a convex polygon with vertices on a circle.
+ */
+Polygon2d CreateConvexPolygon(std::size_t verticesCount,
+                              float radius,
+                              float x,
+                              float y,
+                              float angle) {
+  Polygon2d polygon;
+  for (std::size_t i = 0; i < verticesCount; ++i) {
+    float vertexAngle = angle + 2 * 3.14159f * i / verticesCount;
+    polygon.vertices.push_back(
+        sf::Vector2f(x + radius * std::cos(vertexAngle),
+                     y + radius * std::sin(vertexAngle)));
+  }
+
+  return polygon;
+}
+
+/**
+ * \brief Create polygons overlapping, touching or far from each other.
+ */
+std::vector<Polygon2d> CreatePolygons(std::size_t polygonsCount) {
+  std::mt19937 generator(42);
+  std::uniform_int_distribution<int> verticesCount(3, 8);
+  std::uniform_int_distribution<int> gridPosition(0, 10);
+  std::uniform_real_distribution<float> position(0, 200);
+  std::uniform_real_distribution<float> radius(5, 40);
+  std::uniform_real_distribution<float> angle(0, 6.28f);
+
+  std::vector<Polygon2d> polygons;
+  for (std::size_t i = 0; i < polygonsCount; ++i) {
+    if (i % 4 == 0) {
+      // Squares aligned on a grid, to have touching edges.
+      Polygon2d square = Polygon2d::CreateRectangle(10, 10);
+      square.Move(gridPosition(generator) * 10, gridPosition(generator) * 10);
+      polygons.push_back(square);
+    } else {
+      polygons.push_back(CreateConvexPolygon(verticesCount(generator),
+                                             radius(generator),
+                                             position(generator),
+                                             position(generator),
+                                             angle(generator)));
+    }
+  }
+
+  return polygons;
+}
+}  // namespace
+
+TEST_CASE("PolygonCollision", "[game-engine]") {
+  SECTION("PolygonCollisionTest") {
+    Polygon2d square = Polygon2d::CreateRectangle(10, 10);
+    Polygon2d otherSquare = Polygon2d::CreateRectangle(10, 10);
+    otherSquare.Move(8, 0);
+    CollisionResult result = PolygonCollisionTest(square, otherSquare);
+    REQUIRE(result.collision == true);
+    REQUIRE(result.move_axis.x == Approx(-2));
+    REQUIRE(result.move_axis.y == Approx(0));
+
+    otherSquare.Move(2, 0);
+    REQUIRE(PolygonCollisionTest(square, otherSquare, false).collision == true);
+    REQUIRE(PolygonCollisionTest(square, otherSquare, true).collision == false);
+
+    otherSquare.Move(1, 0);
+    REQUIRE(PolygonCollisionTest(square, otherSquare).collision == false);
+  }
+
+  SECTION("PolygonCollisionTestBatch gives the same results") {
+    std::vector<Polygon2d> polygons = CreatePolygons(300);
+    std::vector<Polygon2dSoA> candidates;
+    for (const auto& polygon : polygons)
+      candidates.push_back(Polygon2dSoA(polygon));
+
+    std::size_t collisionsCount = 0;
+    std::vector<CollisionResult> results;
+    for (bool ignoreTouchingEdges : {false, true}) {
+      for (std::size_t i = 0; i < polygons.size(); ++i) {
+        PolygonCollisionTestBatch(
+            candidates[i], candidates, ignoreTouchingEdges, results);
+        REQUIRE(results.size() == polygons.size());
+
+        for (std::size_t j = 0; j < polygons.size(); ++j) {
+          CollisionResult expectedResult = PolygonCollisionTest(
+              polygons[i], polygons[j], ignoreTouchingEdges);
+          REQUIRE(results[j].collision == expectedResult.collision);
+          REQUIRE(results[j].move_axis.x == expectedResult.move_axis.x);
+          REQUIRE(results[j].move_axis.y == expectedResult.move_axis.y);
+          if (expectedResult.collision) collisionsCount++;
+        }
+      }
+    }
+
+    // Check that the polygons are not all colliding or all separated.
+    REQUIRE(collisionsCount > polygons.size() * 2);
+    REQUIRE(collisionsCount < polygons.size() * polygons.size());
+  }
+
+  SECTION("Polygons with less than 3 vertices are never colliding") {
+    Polygon2d segment;
+    segment.vertices.push_back(sf::Vector2f(0, 0));
+    segment.vertices.push_back(sf::Vector2f(10, 10));
+
+    std::vector<CollisionResult> results;
+    PolygonCollisionTestBatch(
+        Polygon2dSoA(Polygon2d::CreateRectangle(10, 10)),
+        {Polygon2dSoA(segment), Polygon2dSoA(Polygon2d())},
+        false,
+        results);
+    REQUIRE(results.size() == 2);
+    REQUIRE(results[0].collision == false);
+    REQUIRE(results[1].collision == false);
+  }
+}
+
+TEST_CASE("PolygonCollision - Benchmarks", "[benchmarks][game-engine]") {
+  std::vector<Polygon2d> polygons = CreatePolygons(2000);
+  std::vector<Polygon2dSoA> candidates;
+  for (auto& polygon : polygons) {
+    polygon.ComputeEdges();
+    candidates.push_back(Polygon2dSoA(polygon));
+  }
+
+  auto measure = [&polygons](const char* benchmarkName,
+                             std::function<std::size_t()> benchmark) {
+    auto start = std::chrono::steady_clock::now();
+    std::size_t collisionsCount = benchmark();
+    auto end = std::chrono::steady_clock::now();
+    double seconds = std::chrono::duration<double>(end - start).count();
+
+    std::cout << benchmarkName << ": "
+              << static_cast<std::size_t>(polygons.size() * polygons.size() /
+                                          seconds)
+              << " polygons tested per second (" << collisionsCount
+              << " collisions)" << std::endl;
+    return collisionsCount;
+  };
+
+  std::size_t collisionsCount =
+      measure("PolygonCollisionTestWithEdges", [&polygons]() {
+        std::size_t collisionsCount = 0;
+        for (std::size_t i = 0; i < polygons.size(); ++i) {
+          for (std::size_t j = 0; j < polygons.size(); ++j) {
+            if (PolygonCollisionTestWithEdges(polygons[i], polygons[j])
+                    .collision)
+              collisionsCount++;
+          }
+        }
+        return collisionsCount;
+      });
+  std::size_t batchCollisionsCount =
+      measure("PolygonCollisionTestBatch", [&candidates]() {
+        std::size_t collisionsCount = 0;
+        std::vector<CollisionResult> results;
+        for (std::size_t i = 0; i < candidates.size(); ++i) {
+          PolygonCollisionTestBatch(candidates[i], candidates, false, results);
+          for (std::size_t j = 0; j < results.size(); ++j) {
+            if (results[j].collision) collisionsCount++;
+          }
+        }
+        return collisionsCount;
+      });
+
+  REQUIRE(batchCollisionsCount == collisionsCount);
+}
@@ -13,6 +13,7 @@
 #include "GDCore/Project/ObjectsContainer.h"
 #include "GDCore/Project/Layout.h"
 #include "GDCore/Project/Object.h"
+#include "GDCpp/Runtime/Polygon2d.h"
 #include "GDCpp/Runtime/RuntimeGame.h"
 #include "GDCpp/Runtime/RuntimeObject.h"
 #include "GDCpp/Runtime/RuntimeObjectsListsTools.h"
@@ -29,6 +30,17 @@ TEST_CASE("RuntimeSpriteObject", "[game-engine]") {
     anim.SetName("First animation");
     gd::Sprite sprite;
     sprite.SetImageName("Image.png");
+    sprite.SetDefaultCenterPoint(false);
+    sprite.GetCenter().SetXY(0, 0);
+
+    Polygon2d rectangle;
+    rectangle.vertices.push_back(sf::Vector2f(0, 0));
+    rectangle.vertices.push_back(sf::Vector2f(10, 0));
+    rectangle.vertices.push_back(sf::Vector2f(10, 10));
+    rectangle.vertices.push_back(sf::Vector2f(0, 10));
+    sprite.SetCustomCollisionMask({rectangle});
+    sprite.SetCollisionMaskAutomatic(false);
+
     anim.SetDirectionsCount(1);
     anim.GetDirection(0).AddSprite(sprite);
     obj1.AddAnimation(anim);
@@ -60,6 +72,88 @@ TEST_CASE("RuntimeSpriteObject", "[game-engine]") {
     object.SetAngle(42);
     REQUIRE(object.GetAngle() == 42);
   }
+  SECTION("Hitboxes") {
+    REQUIRE(object.GetHitBoxes().size() == 1);
+    REQUIRE(object.GetHitBoxes()[0].vertices[2] == sf::Vector2f(10, 10));
+    REQUIRE(object.GetCachedHitBoxes()[0].edges.size() == 4);
+    REQUIRE(object.GetCachedHitBoxes()[0].edges[0] == sf::Vector2f(10, 0));
+
+    // Hitboxes are updated when the object is moved, scaled...
+    object.SetX(100);
+    REQUIRE(object.GetCachedHitBoxes()[0].vertices[0] ==
+            sf::Vector2f(100, 0));
+    object.SetScaleY(2);
+    REQUIRE(object.GetCachedHitBoxes()[0].vertices[2] ==
+            sf::Vector2f(110, 20));
+    REQUIRE(object.GetCachedHitBoxes()[0].edges[1] == sf::Vector2f(0, 20));
+    REQUIRE(object.GetAABB().top == 0);
+    REQUIRE(object.GetAABB().left == 100);
+    REQUIRE(object.IsCollidingWithPoint(105, 15) == true);
+
+    // ...or when the animation is changed.
+    object.SetCurrentAnimation(1);
+    REQUIRE(object.IsCollidingWithPoint(105, 15) == false);
+  }
+  SECTION("Hitboxes used by collision tests") {
+    // An object with a hitbox on the right of the hitbox of the first one.
+    // Images are not loaded, so objects have a size of 0 and bounding circles
+    // don't prevent the hitboxes to be tested.
+    gd::SpriteObject obj2("OtherSpriteObject");
+    {
+      gd::Animation anim;
+      gd::Sprite sprite;
+      sprite.SetImageName("Image.png");
+      sprite.SetDefaultCenterPoint(false);
+      sprite.GetCenter().SetXY(0, 0);
+
+      Polygon2d rectangle;
+      rectangle.vertices.push_back(sf::Vector2f(10, 0));
+      rectangle.vertices.push_back(sf::Vector2f(20, 0));
+      rectangle.vertices.push_back(sf::Vector2f(20, 10));
+      rectangle.vertices.push_back(sf::Vector2f(10, 10));
+      sprite.SetCustomCollisionMask({rectangle});
+      sprite.SetCollisionMaskAutomatic(false);
+
+      anim.SetDirectionsCount(1);
+      anim.GetDirection(0).AddSprite(sprite);
+      obj2.AddAnimation(anim);
+    }
+    RuntimeSpriteObject other(scene, obj2);
+
+    REQUIRE(other.GetCachedHitBoxesSoA().size() == 1);
+    REQUIRE(other.GetCachedHitBoxesSoA()[0].verticesX[1] == 20);
+    REQUIRE(object.IsCollidingWith(&other) == true);
+    REQUIRE(object.IsCollidingWith(&other, true) == false);
+
+    // Hitboxes are updated when the object is moved.
+    other.SetX(1);
+    REQUIRE(other.GetCachedHitBoxesSoA()[0].verticesX[1] == 21);
+    REQUIRE(object.IsCollidingWith(&other) == false);
+    REQUIRE(other.IsCollidingWith(&object) == false);
+
+    // Overlapping objects are separated.
+    other.SetX(-4);
+    std::vector<RuntimeObject*> others = {&other};
+    REQUIRE(object.SeparateFromObjects(others, false) == true);
+    REQUIRE(object.GetX() == -4);
+    REQUIRE(object.SeparateFromObjects(others, true) == false);
+  }
+  SECTION("Hitboxes of a copy") {
+    // The hitboxes are cached by the object before being copied.
+    REQUIRE(object.IsCollidingWithPoint(5, 5) == true);
+
+    std::unique_ptr<RuntimeObject> copy = object.Clone();
+    REQUIRE(copy->IsCollidingWithPoint(5, 5) == true);
+    REQUIRE(copy->GetCachedHitBoxes().size() == 1);
+    REQUIRE(copy->IsCollidingWith(&object) == true);
+
+    RuntimeSpriteObject assigned(scene, obj1);
+    assigned.SetX(100);
+    REQUIRE(assigned.IsCollidingWithPoint(105, 5) == true);
+    assigned = object;
+    REQUIRE(assigned.IsCollidingWithPoint(5, 5) == true);
+    REQUIRE(assigned.IsCollidingWithPoint(105, 5) == false);
+  }
   SECTION("Animations") {
     REQUIRE(object.GetCurrentAnimation() == 0);
     REQUIRE(object.GetCurrentAnimationName() == "First animation");
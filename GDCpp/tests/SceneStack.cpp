@@ -46,6 +46,24 @@ TEST_CASE("SceneStack", "[game-engine]") {
     REQUIRE(stack.Step() == true);
   }
 
+  SECTION("Preload") {
+    REQUIRE(stack.IsPreloaded("Scene 2") == false);
+    stack.Preload("test");
+    REQUIRE(stack.IsPreloaded("test") == false);
+
+    stack.Push("Scene 1");
+    stack.Preload("Scene 2");
+    REQUIRE(stack.Step() == true);
+    REQUIRE(stack.IsPreloaded("Scene 2") == true);
+    REQUIRE(stack.IsPreloaded("Scene 1") == false);
+
+    auto scene = stack.Push("Scene 2");
+    REQUIRE(scene != nullptr);
+    REQUIRE(scene->GetName() == "Scene 2");
+    REQUIRE(stack.IsPreloaded("Scene 2") == false);
+    REQUIRE(stack.Pop().get() == scene);
+  }
+
   SECTION("OnLoadScene") {
     stack.OnLoadScene([](RuntimeScene& scene) {
       REQUIRE(scene.GetName() == "Scene 2");
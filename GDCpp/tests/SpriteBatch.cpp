@@ -0,0 +1,172 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering SpriteBatch class.
+ */
+#include "GDCpp/Runtime/SpriteBatch.h"
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+#include <SFML/Graphics.hpp>
+#include "catch.hpp"
+
+namespace {
+/**
+ * \brief A SpriteBatch keeping the vertices and states instead of drawing
+ * them, so that it can be used without an OpenGL context.
+ */
+class MockSpriteBatch : public SpriteBatch {
+ public:
+  struct DrawCall {
+    std::vector<sf::Vertex> vertices;
+    const sf::Texture *texture;
+    sf::BlendMode blendMode;
+  };
+
+  std::vector<DrawCall> drawCalls;
+
+ protected:
+  virtual void DrawVertices(sf::RenderTarget &renderTarget,
+                            const sf::VertexArray &vertices,
+                            const sf::RenderStates &states) {
+    DrawCall drawCall;
+    for (std::size_t i = 0; i < vertices.getVertexCount(); ++i)
+      drawCall.vertices.push_back(vertices[i]);
+    drawCall.texture = states.texture;
+    drawCall.blendMode = states.blendMode;
+    drawCalls.push_back(drawCall);
+  }
+};
+
+sf::Sprite CreateSprite(const sf::Texture &texture, float x, float y) {
+  sf::Sprite sprite(texture);
+  sprite.setTextureRect(sf::IntRect(0, 0, 32, 32));
+  sprite.setPosition(x, y);
+  return sprite;
+}
+}  // namespace
+
+TEST_CASE("SpriteBatch", "[game-engine]") {
+  sf::RenderTexture renderTarget;  // Not created, as nothing is drawn on it.
+  sf::Texture texture1, texture2;
+
+  SECTION("Vertices of a sprite") {
+    sf::Sprite sprite = CreateSprite(texture1, 100, 50);
+    sprite.setTextureRect(sf::IntRect(10, 20, 30, 40));
+    sprite.setOrigin(15, 20);
+    sprite.setRotation(30);
+    sprite.setScale(2, -1);
+    sprite.setColor(sf::Color(255, 0, 0, 128));
+
+    MockSpriteBatch spriteBatch;
+    spriteBatch.Draw(renderTarget, sprite, sf::BlendAdd);
+    REQUIRE(spriteBatch.drawCalls.size() == 0);
+    spriteBatch.Flush(renderTarget);
+    REQUIRE(spriteBatch.drawCalls.size() == 1);
+    REQUIRE(spriteBatch.drawCalls[0].texture == &texture1);
+    REQUIRE(spriteBatch.drawCalls[0].blendMode == sf::BlendAdd);
+
+    const std::vector<sf::Vertex> &vertices = spriteBatch.drawCalls[0].vertices;
+    REQUIRE(vertices.size() == 4);
+    sf::FloatRect bounds(vertices[0].position, sf::Vector2f(0, 0));
+    for (const sf::Vertex &vertex : vertices) {
+      bounds.width = std::max(bounds.width, vertex.position.x - bounds.left);
+      bounds.height = std::max(bounds.height, vertex.position.y - bounds.top);
+      if (vertex.position.x < bounds.left) {
+        bounds.width += bounds.left - vertex.position.x;
+        bounds.left = vertex.position.x;
+      }
+      if (vertex.position.y < bounds.top) {
+        bounds.height += bounds.top - vertex.position.y;
+        bounds.top = vertex.position.y;
+      }
+      REQUIRE(vertex.color == sf::Color(255, 0, 0, 128));
+    }
+    REQUIRE(bounds.left == Approx(sprite.getGlobalBounds().left));
+    REQUIRE(bounds.top == Approx(sprite.getGlobalBounds().top));
+    REQUIRE(bounds.width == Approx(sprite.getGlobalBounds().width));
+    REQUIRE(bounds.height == Approx(sprite.getGlobalBounds().height));
+
+    REQUIRE(vertices[0].texCoords == sf::Vector2f(10, 20));
+    REQUIRE(vertices[2].texCoords == sf::Vector2f(40, 60));
+  }
+
+  SECTION("Sprites are grouped by texture and blend mode") {
+    MockSpriteBatch spriteBatch;
+    spriteBatch.Draw(
+        renderTarget, CreateSprite(texture1, 0, 0), sf::BlendAlpha);
+    spriteBatch.Draw(
+        renderTarget, CreateSprite(texture1, 10, 0), sf::BlendAlpha);
+    spriteBatch.Draw(
+        renderTarget, CreateSprite(texture2, 20, 0), sf::BlendAlpha);
+    spriteBatch.Draw(
+        renderTarget, CreateSprite(texture2, 30, 0), sf::BlendAdd);
+    spriteBatch.Draw(
+        renderTarget, CreateSprite(texture2, 40, 0), sf::BlendAdd);
+    spriteBatch.Flush(renderTarget);
+    spriteBatch.Flush(renderTarget);
+
+    REQUIRE(spriteBatch.drawCalls.size() == 3);
+    REQUIRE(spriteBatch.drawCalls[0].vertices.size() == 8);
+    REQUIRE(spriteBatch.drawCalls[1].vertices.size() == 4);
+    REQUIRE(spriteBatch.drawCalls[2].vertices.size() == 8);
+    REQUIRE(spriteBatch.drawCalls[2].texture == &texture2);
+    REQUIRE(spriteBatch.drawCalls[2].blendMode == sf::BlendAdd);
+    REQUIRE(spriteBatch.GetDrawCallsCount() == 3);
+    REQUIRE(spriteBatch.GetDrawnVerticesCount() == 20);
+
+    spriteBatch.ResetStatistics();
+    REQUIRE(spriteBatch.GetDrawCallsCount() == 0);
+  }
+}
+
+TEST_CASE("SpriteBatch - Benchmarks", "[benchmarks][game-engine]") {
+  const std::size_t spritesCount = 20000;
+  sf::RenderTexture renderTarget;  // Not created, as nothing is drawn on it.
+  std::vector<sf::Texture> textures(4);
+
+  // Sprites using a few textures, like in a scene where objects are sorted by
+  // Z order: consecutive sprites often share their texture.
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<float> position(0, 4000);
+  std::uniform_int_distribution<int> textureIndex(0, textures.size() - 1);
+  std::vector<sf::Sprite> sprites;
+  std::size_t currentTexture = 0;
+  for (std::size_t i = 0; i < spritesCount; ++i) {
+    if (i % 50 == 0) currentTexture = textureIndex(generator);
+    sprites.push_back(CreateSprite(
+        textures[currentTexture], position(generator), position(generator)));
+  }
+
+  class CountingSpriteBatch : public SpriteBatch {
+   protected:
+    virtual void DrawVertices(sf::RenderTarget &renderTarget,
+                              const sf::VertexArray &vertices,
+                              const sf::RenderStates &states) {}
+  };
+
+  CountingSpriteBatch spriteBatch;
+  auto start = std::chrono::steady_clock::now();
+  for (const sf::Sprite &sprite : sprites)
+    spriteBatch.Draw(renderTarget, sprite, sf::BlendAlpha);
+  spriteBatch.Flush(renderTarget);
+  auto end = std::chrono::steady_clock::now();
+
+  std::cout << "SpriteBatch (" << spritesCount << " sprites): "
+            << spriteBatch.GetDrawCallsCount() << " draw calls and "
+            << spriteBatch.GetDrawnVerticesCount() << " vertices, instead of "
+            << spritesCount << " draw calls and " << spritesCount * 4
+            << " vertices without batching ("
+            << std::chrono::duration_cast<std::chrono::microseconds>(end -
+                                                                     start)
+                   .count()
+            << "us to build the batches)" << std::endl;
+
+  REQUIRE(spriteBatch.GetDrawCallsCount() <= spritesCount / 50);
+  REQUIRE(spriteBatch.GetDrawnVerticesCount() == spritesCount * 4);
+}
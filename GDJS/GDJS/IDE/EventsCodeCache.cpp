@@ -0,0 +1,188 @@
+/*
+ * GDevelop JS Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDJS/IDE/EventsCodeCache.h"
+
+#include <functional>
+#include <memory>
+#include <set>
+
+#include "GDCore/Events/Builtin/LinkEvent.h"
+#include "GDCore/Events/Event.h"
+#include "GDCore/Events/EventsList.h"
+#include "GDCore/Events/Serialization.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Project/BehaviorContent.h"
+#include "GDCore/Project/EventsFunctionsExtension.h"
+#include "GDCore/Project/ExternalEvents.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/ObjectGroupsContainer.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "GDCore/Serialization/SerializerElementArena.h"
+#include "GDCore/Serialization/SerializerValue.h"
+
+namespace gdjs {
+
+namespace {
+void CombineHash(std::size_t &seed, std::size_t hash) {
+  seed ^= hash + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+std::size_t ComputeValueHash(const gd::SerializerValue &value) {
+  if (value.IsBoolean()) return std::hash<bool>()(value.GetBool());
+  if (value.IsInt()) return std::hash<int>()(value.GetInt());
+  if (value.IsDouble()) return std::hash<double>()(value.GetDouble());
+  return std::hash<gd::String>()(value.GetString());
+}
+
+/**
+ * \brief Hash the element and its children, without converting them to JSON
+ * (which would be as long as generating the code).
+ */
+std::size_t ComputeElementHash(const gd::SerializerElement &element) {
+  std::size_t hash = element.IsValueUndefined()
+                         ? 0
+                         : ComputeValueHash(element.GetValue());
+  for (const auto &attribute : element.GetAllAttributes()) {
+    CombineHash(hash, std::hash<gd::String>()(attribute.first));
+    CombineHash(hash, ComputeValueHash(attribute.second));
+  }
+  for (const auto &child : element.GetAllChildren()) {
+    CombineHash(hash, std::hash<gd::String>()(child.first));
+    CombineHash(hash, ComputeElementHash(*child.second));
+  }
+
+  return hash;
+}
+
+/**
+ * \brief Add to \a targets the names of the layouts and external events
+ * linked by the events, and by the events they link to.
+ */
+void FindLinkedEvents(const gd::Project &project,
+                      const gd::EventsList &events,
+                      std::set<gd::String> &targets) {
+  for (std::size_t i = 0; i < events.GetEventsCount(); ++i) {
+    const gd::BaseEvent &event = events.GetEvent(i);
+    const gd::LinkEvent *linkEvent =
+        dynamic_cast<const gd::LinkEvent *>(&event);
+    if (linkEvent && targets.insert(linkEvent->GetTarget()).second) {
+      const gd::String &target = linkEvent->GetTarget();
+      if (project.HasExternalEventsNamed(target))
+        FindLinkedEvents(
+            project, project.GetExternalEvents(target).GetEvents(), targets);
+      else if (project.HasLayoutNamed(target))
+        FindLinkedEvents(
+            project, project.GetLayout(target).GetEvents(), targets);
+    }
+
+    if (event.CanHaveSubEvents())
+      FindLinkedEvents(project, event.GetSubEvents(), targets);
+  }
+}
+}  // namespace
+
+std::size_t EventsCodeCache::ComputeProjectHash(const gd::Project &project) {
+  std::size_t hash = project.GetCurrentPlatform().GetExtensionsVersion();
+
+  // The elements are only needed to compute the hashes, so allocate them
+  // from an arena.
+  auto arena = std::make_shared<gd::SerializerElementArena>();
+  {
+    gd::SerializerElement element(arena);
+    project.SerializeObjectsTo(element.AddChild("objects"));
+    project.GetObjectGroups().SerializeTo(element.AddChild("objectsGroups"));
+    project.GetVariables().SerializeTo(element.AddChild("variables"));
+    CombineHash(hash, ComputeElementHash(element));
+  }
+
+  for (std::size_t i = 0; i < project.GetExternalEventsCount(); ++i) {
+    gd::SerializerElement element(arena);
+    project.GetExternalEvents(i).SerializeTo(element);
+    CombineHash(hash, ComputeElementHash(element));
+  }
+
+  // Each external events and events functions extension is serialized alone,
+  // so that a copy of all of them is never held at once.
+  for (std::size_t i = 0; i < project.GetEventsFunctionsExtensionsCount();
+       ++i) {
+    gd::SerializerElement element(arena);
+    project.GetEventsFunctionsExtension(i).SerializeTo(element);
+    CombineHash(hash, ComputeElementHash(element));
+  }
+
+  return hash;
+}
+
+std::size_t EventsCodeCache::ComputeLayoutHash(const gd::Project &project,
+                                               std::size_t projectHash,
+                                               const gd::Layout &layout,
+                                               bool compilationForRuntime) {
+  gd::SerializerElement element(
+      std::make_shared<gd::SerializerElementArena>());
+  element.SetAttribute("name", layout.GetName());
+  element.SetAttribute("compilationForRuntime", compilationForRuntime);
+  layout.GetObjectGroups().SerializeTo(element.AddChild("objectsGroups"));
+  layout.GetVariables().SerializeTo(element.AddChild("variables"));
+  layout.SerializeObjectsTo(element.AddChild("objects"));
+  gd::EventsListSerialization::SerializeEventsTo(layout.GetEvents(),
+                                                 element.AddChild("events"));
+
+  gd::SerializerElement &behaviorsSharedDataElement =
+      element.AddChild("behaviorsSharedData");
+  for (const auto &it : layout.GetAllBehaviorSharedData()) {
+    gd::SerializerElement &dataElement =
+        behaviorsSharedDataElement.AddChild(it.first);
+    dataElement.SetAttribute("type", it.second->GetTypeName());
+    it.second->SerializeTo(dataElement.AddChild("content"));
+  }
+
+  // The events included by links are part of the code of the layout.
+  std::set<gd::String> linkedEventsTargets;
+  FindLinkedEvents(project, layout.GetEvents(), linkedEventsTargets);
+  gd::SerializerElement &linkedEventsElement = element.AddChild("linkedEvents");
+  for (const gd::String &target : linkedEventsTargets) {
+    gd::SerializerElement &eventsElement =
+        linkedEventsElement.AddChild("events");
+    eventsElement.SetAttribute("target", target);
+    if (project.HasExternalEventsNamed(target))
+      gd::EventsListSerialization::SerializeEventsTo(
+          project.GetExternalEvents(target).GetEvents(), eventsElement);
+    else if (project.HasLayoutNamed(target))
+      gd::EventsListSerialization::SerializeEventsTo(
+          project.GetLayout(target).GetEvents(), eventsElement);
+  }
+
+  std::size_t hash = projectHash;
+  CombineHash(hash, ComputeElementHash(element));
+  return hash;
+}
+
+std::size_t EventsCodeCache::ComputeCodeHash(const gd::String &code) {
+  return std::hash<gd::String>()(code);
+}
+
+const EventsCodeCache::Code *EventsCodeCache::GetCode(
+    const gd::String &filename) const {
+  auto it = codes.find(filename);
+  return it != codes.end() ? &it->second : nullptr;
+}
+
+void EventsCodeCache::SetCode(const gd::String &filename, const Code &code) {
+  codes[filename] = code;
+}
+
+void EventsCodeCache::Clear() {
+  codes.clear();
+  ClearReport();
+}
+
+void EventsCodeCache::ClearReport() {
+  regeneratedLayouts.clear();
+  reusedLayouts.clear();
+}
+
+}  // namespace gdjs
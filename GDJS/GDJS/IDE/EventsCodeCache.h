@@ -0,0 +1,150 @@
+/*
+ * GDevelop JS Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDJS_EVENTSCODECACHE_H
+#define GDJS_EVENTSCODECACHE_H
+#include <map>
+#include <set>
+#include <vector>
+#include "GDCore/String.h"
+namespace gd {
+class Project;
+class Layout;
+}  // namespace gd
+
+namespace gdjs {
+
+/**
+ * \brief Remember the events code generated for the layouts of a project, so
+ * that the code of the layouts that did not change is not generated and
+ * written again by the next previews.
+ *
+ * The code of a layout is identified by a hash of everything it is generated
+ * from: the events, objects, groups, variables and behaviors shared data of
+ * the layout, the events of the layouts and external events it links to,
+ * and the global objects, groups and variables, the external
+ * events and the events functions extensions of the project (see
+ * EventsCodeCache::ComputeProjectHash and EventsCodeCache::ComputeLayoutHash).
+ *
+ * The cache must be kept alive between the previews, and the code output
+ * directory of the exporter must stay the same.
+ *
+ * Usage example:
+\code
+gdjs::EventsCodeCache eventsCodeCache; // Kept between the previews.
+
+gdjs::PreviewExportOptions options(project, exportPath);
+options.SetEventsCodeCache(eventsCodeCache);
+exporter.ExportProjectForPixiPreview(options);
+
+for (auto& layoutName : eventsCodeCache.GetRegeneratedLayouts())
+  std::cout << "Code generated for " << layoutName << std::endl;
+\endcode
+ *
+ * \see ExporterHelper::ExportEventsCode
+ */
+class EventsCodeCache {
+ public:
+  /**
+   * \brief The code generated for a layout and written in a file.
+   */
+  struct Code {
+    std::size_t hash;      ///< The hash of what the code was generated from.
+    std::size_t codeHash;  ///< The hash of the code itself, to check that the
+                           ///< file was not overwritten since.
+    std::set<gd::String> includeFiles;  ///< The files needed by the code.
+  };
+
+  EventsCodeCache(){};
+  virtual ~EventsCodeCache(){};
+
+  /**
+   * \brief Return a hash of the parts of the project used by the code of all
+   * the layouts: the global objects, groups and variables, the external
+   * events, the events functions extensions and the extensions of the
+   * platform.
+   */
+  static std::size_t ComputeProjectHash(const gd::Project& project);
+
+  /**
+   * \brief Return a hash of everything the code of the layout is generated
+   * from, combined with the hash returned by ComputeProjectHash.
+   *
+   * The events of the layouts and external events linked by the events of
+   * the layout (directly or through other links) are part of the hash.
+   *
+   * The initial instances and the layers of the layout are not used by the
+   * events code, so changing them does not require to generate it again.
+   */
+  static std::size_t ComputeLayoutHash(const gd::Project& project,
+                                       std::size_t projectHash,
+                                       const gd::Layout& layout,
+                                       bool compilationForRuntime);
+
+  /**
+   * \brief Return the hash of a generated code.
+   */
+  static std::size_t ComputeCodeHash(const gd::String& code);
+
+  /**
+   * \brief Return the code stored for the given file, or nullptr if no code
+   * was generated in this file.
+   */
+  const Code* GetCode(const gd::String& filename) const;
+
+  /**
+   * \brief Store the code written in the given file.
+   */
+  void SetCode(const gd::String& filename, const Code& code);
+
+  /**
+   * \brief Forget all the generated code, so that the code of all layouts is
+   * generated by the next export.
+   */
+  void Clear();
+
+  /**
+   * \brief Clear the list of regenerated and reused layouts, before an export.
+   */
+  void ClearReport();
+
+  /**
+   * \brief Add a layout to the list of layouts which code was generated.
+   */
+  void AddRegeneratedLayout(const gd::String& layoutName) {
+    regeneratedLayouts.push_back(layoutName);
+  }
+
+  /**
+   * \brief Add a layout to the list of layouts which code was not changed.
+   */
+  void AddReusedLayout(const gd::String& layoutName) {
+    reusedLayouts.push_back(layoutName);
+  }
+
+  /**
+   * \brief Return the names of the layouts which code was generated during
+   * the last export.
+   */
+  const std::vector<gd::String>& GetRegeneratedLayouts() const {
+    return regeneratedLayouts;
+  }
+
+  /**
+   * \brief Return the names of the layouts which code was unchanged, and so
+   * not generated, during the last export.
+   */
+  const std::vector<gd::String>& GetReusedLayouts() const {
+    return reusedLayouts;
+  }
+
+ private:
+  std::map<gd::String, Code> codes;  ///< The code stored for each file.
+  std::vector<gd::String> regeneratedLayouts;
+  std::vector<gd::String> reusedLayouts;
+};
+
+}  // namespace gdjs
+#endif  // GDJS_EVENTSCODECACHE_H
@@ -31,7 +31,7 @@
 namespace gdjs {
 
 Exporter::Exporter(gd::AbstractFileSystem& fileSystem, gd::String gdjsRoot_)
-    : fs(fileSystem), gdjsRoot(gdjsRoot_) {
+    : fs(fileSystem), gdjsRoot(gdjsRoot_), codeGenerationThreadsCount(0) {
   SetCodeOutputDirectory(fs.GetTempDir() + "/GDTemporaries/JSCodeTemp");
 }
 
@@ -40,6 +40,7 @@ Exporter::~Exporter() {}
 bool Exporter::ExportProjectForPixiPreview(
     const PreviewExportOptions& options) {
   ExporterHelper helper(fs, gdjsRoot, codeOutputDir);
+  helper.SetCodeGenerationThreadsCount(codeGenerationThreadsCount);
   return helper.ExportProjectForPixiPreview(options);
 }
 
@@ -48,7 +49,9 @@ bool Exporter::ExportWholePixiProject(
     gd::String exportDir,
     std::map<gd::String, bool>& exportOptions) {
   ExporterHelper helper(fs, gdjsRoot, codeOutputDir);
-  gd::Project exportedProject = project;
+  helper.SetCodeGenerationThreadsCount(codeGenerationThreadsCount);
+  gd::Project exportedProject;
+  exportedProject.InitAsSnapshotOf(project);
 
   auto exportProject = [this, &exportedProject, &exportOptions, &helper](
                            gd::String exportDir) {
@@ -164,6 +167,7 @@ bool Exporter::ExportWholeCocos2dProject(gd::Project& project,
                                          bool debugMode,
                                          gd::String exportDir) {
   ExporterHelper helper(fs, gdjsRoot, codeOutputDir);
+  helper.SetCodeGenerationThreadsCount(codeGenerationThreadsCount);
 
   wxProgressDialog* progressDialogPtr = NULL;
 
@@ -171,7 +175,8 @@ bool Exporter::ExportWholeCocos2dProject(gd::Project& project,
   fs.MkDir(exportDir);
   std::vector<gd::String> includesFiles;
 
-  gd::Project exportedProject = project;
+  gd::Project exportedProject;
+  exportedProject.InitAsSnapshotOf(project);
 
   // Export the resources (before generating events as some resources filenames
   // may be updated)
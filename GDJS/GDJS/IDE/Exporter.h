@@ -72,6 +72,16 @@ class Exporter {
     codeOutputDir = codeOutputDir_;
   }
 
+  /**
+   * \brief Change the number of threads generating the events code of the
+   * layouts, or 0 to use the number of hardware threads (the default).
+   *
+   * \see ExporterHelper::SetCodeGenerationThreadsCount
+   */
+  void SetCodeGenerationThreadsCount(std::size_t threadsCount) {
+    codeGenerationThreadsCount = threadsCount;
+  }
+
  private:
   gd::AbstractFileSystem&
       fs;  ///< The abstract file system to be used for exportation.
@@ -80,6 +90,8 @@ class Exporter {
       gdjsRoot;  ///< The root directory of GDJS, used to copy runtime files.
   gd::String codeOutputDir;  ///< The directory where JS code is outputted. Will
                              ///< be then copied to the final output directory.
+  std::size_t codeGenerationThreadsCount;  ///< The number of threads
+                                           ///< generating the events code.
 };
 
 }  // namespace gdjs
@@ -6,13 +6,16 @@
 #include "GDJS/IDE/ExporterHelper.h"
 
 #include <algorithm>
+#include <atomic>
 #include <fstream>
 #include <sstream>
 #include <streambuf>
 #include <string>
+#include <thread>
 
 #include "GDCore/CommonTools.h"
 #include "GDCore/Events/CodeGeneration/EffectsCodeGenerator.h"
+#include "GDCore/Events/Tools/EventsCodeNameMangler.h"
 #include "GDCore/Extensions/Metadata/DependencyMetadata.h"
 #include "GDCore/Extensions/Metadata/MetadataProvider.h"
 #include "GDCore/Extensions/Platform.h"
@@ -28,11 +31,13 @@
 #include "GDCore/Project/PropertyDescriptor.h"
 #include "GDCore/Project/SourceFile.h"
 #include "GDCore/Serialization/Serializer.h"
+#include "GDCore/Serialization/SerializerElementArena.h"
 #include "GDCore/TinyXml/tinyxml.h"
 #include "GDCore/Tools/Localization.h"
 #include "GDCore/Tools/Log.h"
 #include "GDJS/Events/CodeGeneration/LayoutCodeGenerator.h"
 #include "GDJS/Extensions/JsPlatform.h"
+#include "GDJS/IDE/EventsCodeCache.h"
 #undef CopyFile  // Disable an annoying macro
 
 namespace {
@@ -70,6 +75,32 @@ bool AreMapKeysMissingElementOfSet(const std::map<gd::String, gd::String> &map,
   return missingKey;
 }
 
+std::size_t GetDefaultCodeGenerationThreadsCount() {
+#if defined(EMSCRIPTEN)
+  return 1;
+#else
+  return std::max(1u, std::thread::hardware_concurrency());
+#endif
+}
+
+/**
+ * \brief Build or load everything that the events code generation would
+ * otherwise build or load the first time it's needed, so that threads
+ * generating the code of different layouts only read the project and the
+ * platform.
+ */
+void PrepareConcurrentCodeGeneration(const gd::Project &project) {
+  gd::MetadataProvider::BuildIndex(project.GetCurrentPlatform());
+  gd::SceneNameMangler::Get();
+  EventsCodeNameMangler::Get();
+
+  // Load the events of the lazily loaded layouts and external events.
+  for (std::size_t i = 0; i < project.GetLayoutsCount(); ++i)
+    project.GetLayout(i).GetEvents();
+  for (std::size_t i = 0; i < project.GetExternalEventsCount(); ++i)
+    project.GetExternalEvents(i).GetEvents();
+}
+
 }  // namespace
 
 namespace gdjs {
@@ -82,7 +113,19 @@ static void InsertUnique(std::vector<gd::String> &container, gd::String str) {
 ExporterHelper::ExporterHelper(gd::AbstractFileSystem &fileSystem,
                                gd::String gdjsRoot_,
                                gd::String codeOutputDir_)
-    : fs(fileSystem), gdjsRoot(gdjsRoot_), codeOutputDir(codeOutputDir_){};
+    : fs(fileSystem),
+      gdjsRoot(gdjsRoot_),
+      codeOutputDir(codeOutputDir_),
+      codeGenerationThreadsCount(GetDefaultCodeGenerationThreadsCount()){};
+
+void ExporterHelper::SetCodeGenerationThreadsCount(std::size_t threadsCount) {
+#if defined(EMSCRIPTEN)
+  codeGenerationThreadsCount = 1;
+#else
+  codeGenerationThreadsCount =
+      threadsCount ? threadsCount : GetDefaultCodeGenerationThreadsCount();
+#endif
+}
 
 bool ExporterHelper::ExportProjectForPixiPreview(
     const PreviewExportOptions &options) {
@@ -90,7 +133,8 @@ bool ExporterHelper::ExportProjectForPixiPreview(
   fs.ClearDir(options.exportPath);
   std::vector<gd::String> includesFiles;
 
-  gd::Project exportedProject = options.project;
+  gd::Project exportedProject;
+  exportedProject.InitAsSnapshotOf(options.project);
 
   // Always disable the splash for preview
   exportedProject.GetLoadingScreen().ShowGDevelopSplash(false);
@@ -116,9 +160,14 @@ bool ExporterHelper::ExportProjectForPixiPreview(
   // the engine)
   ExportEffectIncludes(exportedProject, includesFiles);
 
+  if (options.eventsCodeCache) options.eventsCodeCache->ClearReport();
   if (!options.projectDataOnlyExport) {
     // Generate events code
-    if (!ExportEventsCode(exportedProject, codeOutputDir, includesFiles, true))
+    if (!ExportEventsCode(exportedProject,
+                          codeOutputDir,
+                          includesFiles,
+                          true,
+                          options.eventsCodeCache))
       return false;
 
     // Export source files
@@ -196,13 +245,17 @@ gd::String ExporterHelper::ExportProjectData(
     const gd::SerializerElement &runtimeGameOptions) {
   fs.MkDir(fs.DirNameFrom(filename));
 
-  // Save the project to JSON
-  gd::SerializerElement rootElement;
+  // Save the project to JSON. The elements are only needed for the
+  // serialization, so allocate them from an arena.
+  gd::SerializerElement rootElement(
+      std::make_shared<gd::SerializerElementArena>());
   project.SerializeTo(rootElement);
+  // The exported data is not meant to be read by humans, so write it
+  // without whitespace.
   gd::String output =
-      "gdjs.projectData = " + gd::Serializer::ToJSON(rootElement) + ";\n" +
-      "gdjs.runtimeGameOptions = " +
-      gd::Serializer::ToJSON(runtimeGameOptions) + ";\n";
+      "gdjs.projectData = " + gd::Serializer::ToJSON(rootElement, true) +
+      ";\n" + "gdjs.runtimeGameOptions = " +
+      gd::Serializer::ToJSON(runtimeGameOptions, true) + ";\n";
 
   if (!fs.WriteToFile(filename, output)) return "Unable to write " + filename;
 
@@ -735,27 +788,117 @@ bool ExporterHelper::ExportEffectIncludes(
 bool ExporterHelper::ExportEventsCode(gd::Project &project,
                                       gd::String outputDir,
                                       std::vector<gd::String> &includesFiles,
-                                      bool exportForPreview) {
+                                      bool exportForPreview,
+                                      EventsCodeCache *eventsCodeCache) {
   fs.MkDir(outputDir);
 
-  for (std::size_t i = 0; i < project.GetLayoutsCount(); ++i) {
-    std::set<gd::String> eventsIncludes;
-    gd::Layout &layout = project.GetLayout(i);
+  std::size_t projectHash = 0;
+  if (eventsCodeCache) {
+    eventsCodeCache->ClearReport();
+    projectHash = EventsCodeCache::ComputeProjectHash(project);
+  }
+
+  // The code of a layout, generated by one of the threads.
+  struct LayoutCode {
+    std::size_t hash = 0;
+    bool generated = false;
+    gd::String output;
+    std::set<gd::String> includes;
+  };
+  const std::size_t layoutsCount = project.GetLayoutsCount();
+  std::vector<LayoutCode> layoutCodes(layoutsCount);
+  auto getFilename = [&outputDir](std::size_t i) {
+    return outputDir + "/" + "code" + gd::String::From(i) + ".js";
+  };
+  auto generateCode = [&](std::size_t i) {
+    LayoutCode &layoutCode = layoutCodes[i];
     LayoutCodeGenerator layoutCodeGenerator(project);
-    gd::String eventsOutput = layoutCodeGenerator.GenerateLayoutCompleteCode(
-        layout, eventsIncludes, !exportForPreview);
-    gd::String filename =
-        outputDir + "/" + "code" + gd::String::From(i) + ".js";
+    layoutCode.output = layoutCodeGenerator.GenerateLayoutCompleteCode(
+        project.GetLayout(i), layoutCode.includes, !exportForPreview);
+    layoutCode.generated = true;
+  };
+
+  // Hash the layouts and generate the code of those which changed. This only
+  // reads the project and the cache, so it's done by several threads.
+  auto hashAndGenerateCode = [&](std::size_t i) {
+    if (eventsCodeCache) {
+      layoutCodes[i].hash = EventsCodeCache::ComputeLayoutHash(
+          project, projectHash, project.GetLayout(i), !exportForPreview);
+
+      // The file is checked afterwards, as the file system must only be used
+      // by the thread calling the exporter.
+      const EventsCodeCache::Code *code =
+          eventsCodeCache->GetCode(getFilename(i));
+      if (code && code->hash == layoutCodes[i].hash) return;
+    }
+
+    generateCode(i);
+  };
+
+  const std::size_t threadsCount =
+      std::min(codeGenerationThreadsCount, layoutsCount);
+  if (threadsCount <= 1) {
+    for (std::size_t i = 0; i < layoutsCount; ++i) hashAndGenerateCode(i);
+  } else {
+    PrepareConcurrentCodeGeneration(project);
+
+    std::atomic<std::size_t> nextLayout(0);
+    auto generateLayoutsCode = [&]() {
+      for (std::size_t i = nextLayout++; i < layoutsCount; i = nextLayout++)
+        hashAndGenerateCode(i);
+    };
+
+    // This thread generates code too, while waiting for the others.
+    std::vector<std::thread> workers;
+    for (std::size_t i = 1; i < threadsCount; ++i)
+      workers.push_back(std::thread(generateLayoutsCode));
+    generateLayoutsCode();
+    for (std::thread &worker : workers) worker.join();
+  }
+
+  // Write the files and add the includes in the order of the layouts, so that
+  // the export is the same whatever the number of threads.
+  for (std::size_t i = 0; i < layoutsCount; ++i) {
+    gd::Layout &layout = project.GetLayout(i);
+    gd::String filename = getFilename(i);
+    LayoutCode &layoutCode = layoutCodes[i];
+
+    // Reuse the code already written if the layout did not change (and the
+    // file was not overwritten since).
+    if (!layoutCode.generated) {
+      const EventsCodeCache::Code *code = eventsCodeCache->GetCode(filename);
+      if (code->codeHash ==
+          EventsCodeCache::ComputeCodeHash(fs.ReadFile(filename))) {
+        for (auto &include : code->includeFiles)
+          InsertUnique(includesFiles, include);
+
+        InsertUnique(includesFiles, filename);
+        eventsCodeCache->AddReusedLayout(layout.GetName());
+        continue;
+      }
+
+      generateCode(i);
+    }
 
     // Export the code
-    if (fs.WriteToFile(filename, eventsOutput)) {
-      for (auto &include : eventsIncludes) InsertUnique(includesFiles, include);
+    if (fs.WriteToFile(filename, layoutCode.output)) {
+      for (auto &include : layoutCode.includes)
+        InsertUnique(includesFiles, include);
 
       InsertUnique(includesFiles, filename);
     } else {
       lastError = _("Unable to write ") + filename;
       return false;
     }
+
+    if (eventsCodeCache) {
+      EventsCodeCache::Code code;
+      code.hash = layoutCode.hash;
+      code.codeHash = EventsCodeCache::ComputeCodeHash(layoutCode.output);
+      code.includeFiles = layoutCode.includes;
+      eventsCodeCache->SetCode(filename, code);
+      eventsCodeCache->AddRegeneratedLayout(layout.GetName());
+    }
   }
 
   return true;
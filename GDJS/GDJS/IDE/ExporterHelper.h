@@ -22,6 +22,7 @@ class ResourcesManager;
 class wxProgressDialog;
 
 namespace gdjs {
+class EventsCodeCache;
 
 /**
  * \brief The options used to export a project for a preview.
@@ -35,7 +36,8 @@ struct PreviewExportOptions {
       : project(project_),
         exportPath(exportPath_),
         projectDataOnlyExport(false),
-        nonRuntimeScriptsCacheBurst(0) {};
+        nonRuntimeScriptsCacheBurst(0),
+        eventsCodeCache(nullptr) {};
 
   /**
    * \brief Set the address of the debugger server that the game should reach
@@ -95,6 +97,17 @@ struct PreviewExportOptions {
     return *this;
   }
 
+  /**
+   * \brief Set the cache used to avoid generating again the events code of
+   * the layouts that did not change since the last preview.
+   *
+   * The cache must be kept alive by the caller between the previews.
+   */
+  PreviewExportOptions &SetEventsCodeCache(EventsCodeCache &cache) {
+    eventsCodeCache = &cache;
+    return *this;
+  }
+
   gd::Project &project;
   gd::String exportPath;
   gd::String debuggerServerAddress;
@@ -104,6 +117,7 @@ struct PreviewExportOptions {
   std::map<gd::String, int> includeFileHashes;
   bool projectDataOnlyExport;
   unsigned int nonRuntimeScriptsCacheBurst;
+  EventsCodeCache *eventsCodeCache;  ///< Optional, can be nullptr.
 };
 
 /**
@@ -186,11 +200,19 @@ class ExporterHelper {
    * outputDir The directory where the events code must be generated. \param
    * includesFiles A reference to a vector that will be filled with JS files to
    * be exported along with the project. ( including "codeX.js" files ).
+   * \param eventsCodeCache If not null, the code of layouts that did not
+   * change since the last export with this cache is not generated again.
+   *
+   * The code of the layouts is generated by several threads (see
+   * SetCodeGenerationThreadsCount), but the files are written and the
+   * includes are added in the order of the layouts, so that the export does
+   * not depend on the number of threads.
    */
   bool ExportEventsCode(gd::Project &project,
                         gd::String outputDir,
                         std::vector<gd::String> &includesFiles,
-                        bool exportForPreview);
+                        bool exportForPreview,
+                        EventsCodeCache *eventsCodeCache = nullptr);
 
   /**
    * \brief Add the project effects include files.
@@ -327,6 +349,24 @@ class ExporterHelper {
     codeOutputDir = codeOutputDir_;
   }
 
+  /**
+   * \brief Change the number of threads generating the events code of the
+   * layouts.
+   *
+   * \param threadsCount The number of threads, or 0 to use the number of
+   * hardware threads (the default). It is always 1 when compiled with
+   * Emscripten, which is built without threads support.
+   */
+  void SetCodeGenerationThreadsCount(std::size_t threadsCount);
+
+  /**
+   * \brief Return the number of threads generating the events code of the
+   * layouts.
+   */
+  std::size_t GetCodeGenerationThreadsCount() const {
+    return codeGenerationThreadsCount;
+  }
+
   static void AddDeprecatedFontFilesToFontResources(
       gd::AbstractFileSystem &fs,
       gd::ResourcesManager &resourcesManager,
@@ -340,6 +380,8 @@ class ExporterHelper {
       gdjsRoot;  ///< The root directory of GDJS, used to copy runtime files.
   gd::String codeOutputDir;  ///< The directory where JS code is outputted. Will
                              ///< be then copied to the final output directory.
+  std::size_t codeGenerationThreadsCount;  ///< The number of threads
+                                           ///< generating the events code.
 };
 
 }  // namespace gdjs
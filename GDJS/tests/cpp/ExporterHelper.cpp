@@ -0,0 +1,156 @@
+/*
+ * GDevelop JS Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the generation of the events code by ExporterHelper.
+ */
+#include "GDJS/IDE/ExporterHelper.h"
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <vector>
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/IDE/AbstractFileSystem.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Project.h"
+#include "GDJS/Extensions/JsPlatform.h"
+#include "catch.hpp"
+
+namespace {
+
+/**
+ * \brief A file system keeping the written files in memory.
+ */
+class MemoryFileSystem : public gd::AbstractFileSystem {
+ public:
+  virtual void MkDir(const gd::String& path){};
+  virtual bool DirExists(const gd::String& path) { return true; };
+  virtual bool FileExists(const gd::String& path) {
+    return files.find(path) != files.end();
+  };
+  virtual gd::String FileNameFrom(const gd::String& file) {
+    std::size_t position = file.rfind("/");
+    return position == gd::String::npos ? file : file.substr(position + 1);
+  };
+  virtual gd::String DirNameFrom(const gd::String& file) {
+    std::size_t position = file.rfind("/");
+    return position == gd::String::npos ? "" : file.substr(0, position);
+  };
+  virtual bool MakeAbsolute(gd::String& filename,
+                            const gd::String& baseDirectory) {
+    return true;
+  };
+  virtual bool MakeRelative(gd::String& filename,
+                            const gd::String& baseDirectory) {
+    return true;
+  };
+  virtual bool IsAbsolute(const gd::String& filename) {
+    return !filename.empty() && filename[0] == '/';
+  }
+  virtual bool CopyFile(const gd::String& file, const gd::String& destination) {
+    files[destination] = files[file];
+    return true;
+  }
+  virtual bool ClearDir(const gd::String& directory) { return true; }
+  virtual bool WriteToFile(const gd::String& file, const gd::String& content) {
+    files[file] = content;
+    return true;
+  }
+  virtual gd::String ReadFile(const gd::String& file) {
+    auto it = files.find(file);
+    return it != files.end() ? it->second : "";
+  }
+  virtual gd::String GetTempDir() { return "/tmp/"; }
+  virtual std::vector<gd::String> ReadDir(const gd::String& path,
+                                          const gd::String& extension = "") {
+    return std::vector<gd::String>();
+  }
+
+  MemoryFileSystem(){};
+  virtual ~MemoryFileSystem(){};
+
+  std::map<gd::String, gd::String> files;
+};
+
+/**
+ * \brief Fill the project with layouts containing a sprite object and events
+ * moving it.
+ */
+void FillProjectWithLayouts(gd::Project& project,
+                            std::size_t layoutsCount,
+                            std::size_t eventsCount) {
+  for (std::size_t i = 0; i < layoutsCount; ++i) {
+    auto& layout = project.InsertNewLayout("Scene " + gd::String::From(i),
+                                           project.GetLayoutsCount());
+    layout.InsertNewObject(project, "Sprite", "MySprite", 0);
+
+    for (std::size_t j = 0; j < eventsCount; ++j) {
+      auto& event = dynamic_cast<gd::StandardEvent&>(
+          layout.GetEvents().InsertNewEvent(
+              project, "BuiltinCommonInstructions::Standard", j));
+      gd::Instruction condition;
+      condition.SetType("PosX");
+      condition.SetParametersCount(3);
+      condition.SetParameter(0, gd::Expression("MySprite"));
+      condition.SetParameter(1, gd::Expression("<"));
+      condition.SetParameter(2, gd::Expression("100 + " + gd::String::From(j)));
+      event.GetConditions().Insert(condition);
+
+      gd::Instruction action;
+      action.SetType("MettreX");
+      action.SetParametersCount(3);
+      action.SetParameter(0, gd::Expression("MySprite"));
+      action.SetParameter(1, gd::Expression("+"));
+      action.SetParameter(
+          2, gd::Expression("MySprite.X() / 2 + " + gd::String::From(j)));
+      event.GetActions().Insert(action);
+    }
+  }
+}
+
+}  // namespace
+
+TEST_CASE("ExporterHelper - Benchmarks", "[benchmarks][game-engine]") {
+  SECTION("Events code is the same whatever the number of threads") {
+    gd::Project project;
+    project.AddPlatform(gdjs::JsPlatform::Get());
+    FillProjectWithLayouts(project, 200, 20);
+
+    MemoryFileSystem firstExportFs;
+    std::vector<gd::String> firstExportIncludes;
+    for (std::size_t threadsCount = 1; threadsCount <= 8; threadsCount *= 2) {
+      MemoryFileSystem fs;
+      gdjs::ExporterHelper helper(fs, "/gdjs", "/tmp/code");
+      helper.SetCodeGenerationThreadsCount(threadsCount);
+
+      std::vector<gd::String> includesFiles;
+      auto start = std::chrono::steady_clock::now();
+      REQUIRE(
+          helper.ExportEventsCode(project, "/tmp/code", includesFiles, true));
+      auto end = std::chrono::steady_clock::now();
+      std::cout << "Events code of 200 layouts generated with " << threadsCount
+                << " thread(s) in "
+                << std::chrono::duration_cast<std::chrono::microseconds>(
+                       end - start)
+                           .count() /
+                       1000.0
+                << "ms" << std::endl;
+
+      REQUIRE(fs.files.size() == 200);
+      REQUIRE(fs.files["/tmp/code/code199.js"].find("Scene_32199Code") !=
+              gd::String::npos);
+      REQUIRE(fs.files["/tmp/code/code199.js"].find("setX") !=
+              gd::String::npos);
+      if (threadsCount == 1) {
+        firstExportFs.files = fs.files;
+        firstExportIncludes = includesFiles;
+      } else {
+        REQUIRE(fs.files == firstExportFs.files);
+        REQUIRE(includesFiles == firstExportIncludes);
+      }
+    }
+  }
+}
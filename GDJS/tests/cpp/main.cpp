@@ -0,0 +1,12 @@
+/*
+ * GDevelop JS Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Main file for the tests of the C++ code of GDevelop JS Platform
+ *
+ * Please write any new test in a separate file.
+ */
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
@@ -2649,6 +2649,111 @@ describe('libGD.js', function() {
       previewExportOptions.delete();
       exporter.delete();
     });
+
+    it('should not generate again the code of unchanged layouts', function() {
+      var fs = new gd.AbstractFileSystemJS();
+      var project = new gd.ProjectHelper.createNewGDJSProject();
+      var layout1 = project.insertNewLayout('Scene', 0);
+      var layout2 = project.insertNewLayout('Scene 2', 1);
+      layout1
+        .getEvents()
+        .insertNewEvent(project, 'BuiltinCommonInstructions::Standard', 0);
+
+      var files = {};
+      fs.mkDir = fs.clearDir = function() {};
+      fs.getTempDir = function(path) {
+        return '/tmp/';
+      };
+      fs.fileNameFrom = function(fullpath) {
+        return path.basename(fullpath);
+      };
+      fs.dirNameFrom = function(fullpath) {
+        return path.dirname(fullpath);
+      };
+      fs.readDir = function() {
+        return new gd.VectorString();
+      };
+      fs.writeToFile = function(path, content) {
+        files[path] = content;
+        return true;
+      };
+      fs.readFile = function(path) {
+        return files[path] || '';
+      };
+      fs.fileExists = function(path) {
+        return files.hasOwnProperty(path);
+      };
+      fs.dirExists = function() {
+        return true;
+      };
+      fs.isAbsolute = function(fullpath) {
+        return path.isAbsolute(fullpath);
+      };
+      fs.makeAbsolute = fs.makeRelative = function(filename) {
+        return filename;
+      };
+      fs.copyFile = function(source, destination) {
+        files[destination] = files[source];
+        return true;
+      };
+
+      const eventsCodeCache = new gd.EventsCodeCache();
+      const exportPreview = () => {
+        const exporter = new gd.Exporter(fs);
+        const previewExportOptions = new gd.PreviewExportOptions(
+          project,
+          '/path/for/export/'
+        );
+        previewExportOptions.setLayoutName('Scene');
+        previewExportOptions.setEventsCodeCache(eventsCodeCache);
+        exporter.exportProjectForPixiPreview(previewExportOptions);
+        previewExportOptions.delete();
+        exporter.delete();
+      };
+
+      exportPreview();
+      expect(eventsCodeCache.getRegeneratedLayouts().toJSArray()).toEqual([
+        'Scene',
+        'Scene 2',
+      ]);
+
+      // Instances are not used by the events code.
+      layout2.getInitialInstances().insertNewInitialInstance();
+      exportPreview();
+      expect(eventsCodeCache.getRegeneratedLayouts().size()).toBe(0);
+      expect(eventsCodeCache.getReusedLayouts().size()).toBe(2);
+
+      layout2
+        .getEvents()
+        .insertNewEvent(project, 'BuiltinCommonInstructions::Standard', 0);
+      exportPreview();
+      expect(eventsCodeCache.getRegeneratedLayouts().toJSArray()).toEqual([
+        'Scene 2',
+      ]);
+
+      // Layouts linking to a changed layout are generated again.
+      gd.asLinkEvent(
+        layout1
+          .getEvents()
+          .insertNewEvent(project, 'BuiltinCommonInstructions::Link', 1)
+      ).setTarget('Scene 2');
+      exportPreview();
+      expect(eventsCodeCache.getRegeneratedLayouts().toJSArray()).toEqual([
+        'Scene',
+      ]);
+
+      layout2
+        .getEvents()
+        .insertNewEvent(project, 'BuiltinCommonInstructions::Standard', 1);
+      exportPreview();
+      expect(eventsCodeCache.getRegeneratedLayouts().toJSArray()).toEqual([
+        'Scene',
+        'Scene 2',
+      ]);
+
+      eventsCodeCache.delete();
+      project.delete();
+    });
   });
 
   describe('gd.EventsRemover', function() {
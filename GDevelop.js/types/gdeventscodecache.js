@@ -0,0 +1,9 @@
+// Automatically generated by GDevelop.js/scripts/generate-types.js
+declare class gdEventsCodeCache {
+  constructor(): void;
+  clear(): void;
+  getRegeneratedLayouts(): gdVectorString;
+  getReusedLayouts(): gdVectorString;
+  delete(): void;
+  ptr: number;
+};
\ No newline at end of file
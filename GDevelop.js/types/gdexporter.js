@@ -2,6 +2,7 @@
 declare class gdjsExporter {
   constructor(fs: gdAbstractFileSystem, gdjsRoot: string): void;
   setCodeOutputDirectory(path: string): void;
+  setCodeGenerationThreadsCount(threadsCount: number): void;
   exportProjectForPixiPreview(options: gdPreviewExportOptions): boolean;
   exportWholePixiProject(project: gdProject, exportDir: string, exportOptions: gdMapStringBoolean): boolean;
   exportWholeCocos2dProject(project: gdProject, debugMode: boolean, exportDir: string): boolean;
@@ -7,6 +7,7 @@ declare class gdPreviewExportOptions {
   setIncludeFileHash(includeFile: string, hash: number): gdPreviewExportOptions;
   setProjectDataOnlyExport(enable: boolean): gdPreviewExportOptions;
   setNonRuntimeScriptsCacheBurst(value: number): gdPreviewExportOptions;
+  setEventsCodeCache(cache: gdEventsCodeCache): gdPreviewExportOptions;
   delete(): void;
   ptr: number;
 };
\ No newline at end of file
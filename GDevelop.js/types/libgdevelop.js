@@ -185,6 +185,7 @@ declare class libGDevelop {
   LayoutCodeGenerator: Class<gdLayoutCodeGenerator>;
   BehaviorCodeGenerator: Class<gdBehaviorCodeGenerator>;
   EventsFunctionsExtensionCodeGenerator: Class<gdEventsFunctionsExtensionCodeGenerator>;
+  EventsCodeCache: Class<gdEventsCodeCache>;
   PreviewExportOptions: Class<gdPreviewExportOptions>;
   Exporter: Class<gdExporter>;
   JsCodeEvent: Class<gdJsCodeEvent>;
@@ -59,6 +59,16 @@ export default class LocalPreviewLauncher extends React.Component<
   };
   _networkPreviewSubscriptionChecker: ?SubscriptionChecker = null;
   _hotReloadSubscriptionChecker: ?SubscriptionChecker = null;
+  // Kept between previews to avoid generating again the events code of
+  // scenes that were not modified.
+  _eventsCodeCache: ?gdEventsCodeCache = null;
+
+  componentWillUnmount() {
+    if (this._eventsCodeCache) {
+      this._eventsCodeCache.delete();
+      this._eventsCodeCache = null;
+    }
+  }
 
   _openPreviewBrowserWindow = () => {
     if (
@@ -180,6 +190,10 @@ export default class LocalPreviewLauncher extends React.Component<
               outputDir
             );
             previewExportOptions.setLayoutName(layout.getName());
+            const eventsCodeCache =
+              this._eventsCodeCache || new gd.EventsCodeCache();
+            this._eventsCodeCache = eventsCodeCache;
+            previewExportOptions.setEventsCodeCache(eventsCodeCache);
             if (externalLayout) {
               previewExportOptions.setExternalLayoutName(
                 externalLayout.getName()
@@ -213,6 +227,15 @@ export default class LocalPreviewLauncher extends React.Component<
             previewExportOptions.delete();
             exporter.delete();
 
+            const regeneratedLayouts = eventsCodeCache
+              .getRegeneratedLayouts()
+              .toJSArray();
+            console.info(
+              `Events code generated for ${
+                regeneratedLayouts.length
+              } scene(s): ${regeneratedLayouts.join(', ')}`
+            );
+
             if (shouldHotReload) {
               debuggerIds.forEach(debuggerId => {
                 this.getPreviewDebuggerServer().sendMessage(debuggerId, {